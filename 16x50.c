@@ -5,6 +5,7 @@
 #include <unistd.h>
 #include "serialdevice.h"
 #include "16x50.h"
+#include "snapshot.h"
 
 /* UART: very mimimal for the moment */
 
@@ -75,7 +76,8 @@ static void uart16x50_clear_interrupt(struct uart16x50 *uptr, uint8_t n)
 	uart16x50_recalc_iir(uptr);
 }
 
-void uart16x50_event(struct uart16x50 *uptr)
+/* Returns non zero while a byte is on the move (as acia_timer) */
+int uart16x50_event(struct uart16x50 *uptr)
 {
 	uint8_t r = uptr->dev->ready(uptr->dev);
 	uint8_t old = uptr->lsr;
@@ -92,6 +94,7 @@ void uart16x50_event(struct uart16x50 *uptr)
 		uart16x50_interrupt(uptr, RXDA);
 	if (dhigh & 0x2)
 		uart16x50_interrupt(uptr, TEMT);
+	return (r & 5) || !(r & 2);
 }
 
 static void show_settings(struct uart16x50 *uptr)
@@ -300,3 +303,21 @@ void uart16x50_free(struct uart16x50 *d)
 {
 	free(d);
 }
+
+void uart16x50_snapshot(struct uart16x50 *uptr, struct snapshot *s)
+{
+	snapshot_u8(s, &uptr->ier);
+	snapshot_u8(s, &uptr->iir);
+	snapshot_u8(s, &uptr->fcr);
+	snapshot_u8(s, &uptr->lcr);
+	snapshot_u8(s, &uptr->mcr);
+	snapshot_u8(s, &uptr->lsr);
+	snapshot_u8(s, &uptr->msr);
+	snapshot_u8(s, &uptr->scratch);
+	snapshot_u8(s, &uptr->ls);
+	snapshot_u8(s, &uptr->ms);
+	snapshot_u8(s, &uptr->dlab);
+	snapshot_u8(s, &uptr->irq);
+	snapshot_u8(s, &uptr->irqline);
+	snapshot_uint(s, &uptr->clock);
+}
@@ -93,7 +93,7 @@ volatile int emulator_done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
 
 static uint8_t *map_addr(uint16_t addr, unsigned is_write)
 {
@@ -127,26 +127,7 @@ void mem_write(int unused, uint16_t addr, uint8_t val)
 
 uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate = 0;
-	uint8_t r = do_mem_read(addr, 0);
-
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r == 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
-	return r;
+	return do_mem_read(addr, 0);
 }
 
 static unsigned int nbytes;
@@ -560,7 +541,7 @@ static void poll_irq_event(void)
 	/* If a real IM2 source is live then the serial int won't be seen */
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	if (live_irq && (trace & TRACE_IRQ))
 		fprintf(stderr, "RETI\n");
@@ -721,6 +702,7 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
 
 	/* This is the wrong way to do it but it's easier for the moment. We
@@ -5,6 +5,7 @@
 #include <time.h>
 #include "system.h"
 #include "58174.h"
+#include "replay.h"
 
 /*
  *	MM58174 RTC. Nybble wide interface
@@ -41,7 +42,7 @@ uint8_t mm58174_read(struct mm58174 *rtc, uint8_t reg)
 	struct tm *tm;
 	static unsigned fake_tenths;
 
-	t = time(NULL);
+	t = replay_time();
 	tm = gmtime(&t);
 	if (tm == NULL)
 		return 0xFF;
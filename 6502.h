@@ -24,6 +24,7 @@ extern void write6502(uint16_t address, uint8_t value);
 
 extern int log_6502;
 extern uint8_t mempage;
+extern uint64_t instructions;
 
 #ifdef _6502_PRIVATE
 
@@ -22,6 +22,8 @@
 #include "16x50.h"
 #include "ds3234.h"
 #include "ide.h"
+#include "stats.h"
+#include "trigger.h"
 
 /* IDE controller */
 static struct ide_controller *ide;
@@ -212,11 +214,15 @@ void cpu_write_byte(unsigned int address, unsigned int value)
 	case 0x08:	/* Open bus */
 		return;
 	case 0x09:
+		if (trigger_pending & TRIGGER_IO)
+			trigger_io(address);
 		if (!(address & 1))
 			value >>= 8;
 		ide_write16(ide, (address & 0x0E) >> 1, value);
 		return;
 	case 0x0A:
+		if (trigger_pending & TRIGGER_IO)
+			trigger_io(address);
 		uart16x50_write(uart, (address & 0x1E) >> 1, value);
 		return;
 	case 0x0C:
@@ -238,6 +244,8 @@ void cpu_write_word(unsigned int address, unsigned int value)
 
 	/* Special case the ide as it matters */
 	if ((address & 0xF00000) == 0x900000) {
+		if (trigger_pending & TRIGGER_IO)
+			trigger_io(address);
 		ide_write16(ide, (address & 0x0E) >> 1, value);
 		return;
 	}
@@ -263,6 +271,9 @@ void cpu_write_pd(unsigned int address, unsigned int value)
 
 void cpu_instr_callback(void)
 {
+	stats.instructions++;
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(m68k_get_reg(NULL, M68K_REG_PC));
 	if (trace & TRACE_CPU) {
 		char buf[128];
 		unsigned int pc = m68k_get_reg(NULL, M68K_REG_PC);
@@ -297,7 +308,7 @@ static void take_a_nap(void)
 	struct timespec t;
 	t.tv_sec = 0;
 	t.tv_nsec = 100000;
-	if (nanosleep(&t, NULL))
+	if (stats_nap(&t))
 		perror("nanosleep");
 }
 
@@ -312,7 +323,7 @@ void cpu_set_fc(int fc)
 
 void usage(void)
 {
-	fprintf(stderr, "68knano: [-0][-1][-2][-e][-r rompath][-i idepath][-d debug].\n");
+	fprintf(stderr, "68knano: [-0][-1][-2][-e][-f][-t trigger][-r rompath][-i idepath][-d debug][-j text|json].\n");
 	exit(1);
 }
 
@@ -324,8 +335,9 @@ int main(int argc, char *argv[])
 	int opt;
 	const char *romname = "68knano.rom";
 	const char *diskname = "68knano.ide";
+	unsigned statsmode = STATS_OFF;
 
-	while((opt = getopt(argc, argv, "012efd:i:r:")) != -1) {
+	while((opt = getopt(argc, argv, "012efd:i:j:r:t:")) != -1) {
 		switch(opt) {
 		case '0':
 			cputype = M68K_CPU_TYPE_68000;
@@ -339,9 +351,16 @@ int main(int argc, char *argv[])
 		case 'e':
 			cputype = M68K_CPU_TYPE_68EC020;
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'd':
 			trace = atoi(optarg);
 			break;
@@ -414,6 +433,7 @@ int main(int argc, char *argv[])
 
 	/* Init devices */
 	device_init();
+	stats_init("68knano", fast ? 0 : 12, statsmode);
 
 	while (1) {
 		unsigned n = 0;
@@ -422,12 +442,16 @@ int main(int argc, char *argv[])
 			   We do a blind 0.01ns second sleep so we are actually
 			   emulating a bit under 12Mhz - which will do fine for
 			   testing this stuff */
-			m68k_execute(1200);
+			stats.cycles += m68k_execute(1200);
 			uart16x50_event(uart);
 			recalc_interrupts();
-			if (!fast)
+			if (trigger_pending & TRIGGER_TIME)
+				trigger_elapsed(100000);
+			if (!fast && !trigger_pending)
 				take_a_nap();
 		}
+		if (stats_wanted)
+			stats_report();
 		/* Toggle SQW at 1Hz (so two toggles a second) */
 		sqw_toggle();
 	}
@@ -6,6 +6,7 @@
 #include "serialdevice.h"
 #include "system.h"
 #include "acia.h"
+#include "snapshot.h"
 
 struct acia {
 	uint8_t status;
@@ -62,7 +63,9 @@ static void acia_transmit(struct acia *acia)
 	}
 }
 
-void acia_timer(struct acia *acia)
+/* Returns non zero while a byte is on the move either way, in which case
+   it wants another look a character time later */
+int acia_timer(struct acia *acia)
 {
 	int s = acia->dev->ready(acia->dev);
 	if (s & 1)
@@ -71,6 +74,7 @@ void acia_timer(struct acia *acia)
 		acia_transmit(acia);
 	if (s)
 		acia_irq_compute(acia);
+	return (s & 5) || !(acia->status & 2);
 }
 
 uint8_t acia_read(struct acia *acia, uint16_t addr)
@@ -169,3 +173,12 @@ void acia_trace(struct acia *acia, int onoff)
 {
 	acia->trace = onoff;
 }
+
+void acia_snapshot(struct acia *acia, struct snapshot *s)
+{
+	snapshot_u8(s, &acia->status);
+	snapshot_u8(s, &acia->config);
+	snapshot_u8(s, &acia->rxchar);
+	snapshot_u8(s, &acia->inint);
+	snapshot_u8(s, &acia->inreset);
+}
@@ -1,10 +1,12 @@
 struct acia;
+struct snapshot;
 
 extern struct acia *acia_create(void);
 extern void acia_free(struct acia *acia);
 extern void acia_trace(struct acia *acia, int onoff);
 extern uint8_t acia_read(struct acia *acia, uint16_t addr);
 extern void acia_write(struct acia *acia, uint16_t addr, uint8_t val);
-extern void acia_timer(struct acia *acia);
+extern int acia_timer(struct acia *acia);
 extern uint8_t acia_irq_pending(struct acia *acia);
 extern void acia_attach(struct acia *acia, struct serial_device *dev);
+extern void acia_snapshot(struct acia *acia, struct snapshot *s);
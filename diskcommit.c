@@ -0,0 +1,91 @@
+/*
+ *	Fold an overlay back into its base image, or write out the disk it
+ *	describes as a new plain image.
+ *
+ *	diskcommit overlay		write the blocks into the base and
+ *					empty the overlay
+ *	diskcommit overlay image	make image from the base and overlay
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "diskio.h"
+
+static int commit(const char *path, int fd)
+{
+	const char *base = disk_base(fd);
+	long n;
+	int bfd;
+
+	bfd = open(base, O_RDWR);
+	if (bfd == -1) {
+		perror(base);
+		return 1;
+	}
+	n = disk_commit(fd, bfd, 1);
+	if (n < 0) {
+		perror(path);
+		return 1;
+	}
+	close(bfd);
+	printf("%ld blocks written to %s.\n", n, base);
+	return 0;
+}
+
+static int flatten(const char *path, int fd, const char *image)
+{
+	static uint8_t buf[65536];
+	off_t size = disk_size(fd);
+	off_t pos = 0;
+	int ofd;
+
+	ofd = open(image, O_WRONLY|O_CREAT|O_EXCL, 0666);
+	if (ofd == -1) {
+		perror(image);
+		return 1;
+	}
+	while (pos < size) {
+		unsigned len = size - pos < sizeof(buf) ? size - pos : sizeof(buf);
+		if (disk_read(fd, buf, len, pos) != len) {
+			perror(path);
+			return 1;
+		}
+		if (write(ofd, buf, len) != len) {
+			perror(image);
+			return 1;
+		}
+		pos += len;
+	}
+	if (fsync(ofd) || close(ofd)) {
+		perror(image);
+		return 1;
+	}
+	return 0;
+}
+
+int main(int argc, const char *argv[])
+{
+	int fd, r;
+
+	if (argc != 2 && argc != 3) {
+		fprintf(stderr, "%s [overlay] {image}\n", argv[0]);
+		exit(1);
+	}
+	fd = open(argv[1], argc == 2 ? O_RDWR : O_RDONLY);
+	if (fd == -1) {
+		perror(argv[1]);
+		exit(1);
+	}
+	if (disk_base(fd) == NULL) {
+		fprintf(stderr, "%s: not an overlay.\n", argv[1]);
+		exit(1);
+	}
+	if (argc == 2)
+		r = commit(argv[1], fd);
+	else
+		r = flatten(argv[1], fd, argv[2]);
+	disk_close(fd);
+	return r;
+}
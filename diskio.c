@@ -0,0 +1,691 @@
+/*
+ *	Disk image I/O
+ *
+ *	Images are mapped into memory the first time they are used so a
+ *	sector transfer is a copy rather than a system call, and a reader that
+ *	only needs to look at a sector can use disk_peek to get a pointer to
+ *	it in the mapping. Anything that can't be mapped, or a transfer that
+ *	runs past the end of the image as it was when mapped, falls back to
+ *	pread/pwrite.
+ *
+ *	The mapping is shared so writes go to the page cache just as pwrite
+ *	would. When they are forced out to the image is set by the sync mode:
+ *	on a cache flush from the guest, on close and at exit, or after each
+ *	write.
+ *
+ *	Once disk_private() is called the images become copy on write: the
+ *	mappings are replaced with private ones and a block written past the
+ *	mapping is first copied into memory and from then on reads and writes
+ *	of it go to the copy. This is used by forked test runs so each one
+ *	sees its own writes and none of them change the image.
+ *
+ *	An overlay image holds just the blocks written to a disk whose other
+ *	blocks come from a base image that is never written, so many machines
+ *	can share one base. The file is
+ *
+ *	header		4K: "EMUOVL" 0 0, u32 version, u32 block size,
+ *			u64 blocks, u16 length and the path of the base
+ *	bitmap		a bit per block, set once the overlay holds the block,
+ *			padded to 4K
+ *	blocks		block n at the start of the area plus n * 512, left
+ *			as a hole until it is written
+ *
+ *	all little endian. Overlays are spotted by their header the first
+ *	time they are used so the controllers don't need to know about them.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "diskio.h"
+#include "stats.h"
+
+#define COW_BLOCK	512
+#define COW_HASH	4096
+
+#define OVL_VERSION	1
+#define OVL_HEADER	4096
+#define OVL_BLOCK	512
+#define OVL_PAGE	4096
+
+static const uint8_t ovl_magic[8] = "EMUOVL";
+
+struct overlay {
+	int base;		/* Only ever read */
+	char path[PATH_MAX];
+	uint8_t *image;		/* The base mapped */
+	off_t image_size;
+	uint64_t blocks;
+	uint8_t *bitmap;
+	off_t bitmap_size;
+	off_t mark_lo;		/* Bitmap bytes changed since it was written */
+	off_t mark_hi;
+	uint8_t *delta;		/* The block area of the overlay mapped */
+	off_t data;		/* Where the block area starts in the file */
+};
+
+struct cow_block {
+	struct cow_block *next;
+	int fd;
+	off_t pos;
+	uint8_t data[COW_BLOCK];
+};
+
+struct disk_map {
+	struct disk_map *next;
+	int fd;
+	uint8_t *base;		/* NULL if the image could not be mapped */
+	off_t size;
+	unsigned writable;
+	unsigned dirty;
+	struct overlay *ovl;	/* If this is an overlay, when base is NULL */
+};
+
+static struct cow_block **cow;
+static struct disk_map *maps;
+static struct disk_map *last_map;
+static unsigned sync_mode = DISK_SYNC_FLUSH;
+static unsigned exit_hooked;
+
+/* Write out the bitmap bytes changed since last time. Only called once
+   the blocks they mark are on disk */
+static void ovl_sync_bitmap(struct disk_map *m)
+{
+	struct overlay *o = m->ovl;
+
+	if (o->mark_lo < o->mark_hi)
+		pwrite(m->fd, o->bitmap + o->mark_lo, o->mark_hi - o->mark_lo,
+			OVL_HEADER + o->mark_lo);
+	o->mark_lo = o->bitmap_size;
+	o->mark_hi = 0;
+}
+
+static void disk_sync_map(struct disk_map *m)
+{
+	if (m->dirty && !cow) {
+		if (m->base)
+			msync(m->base, m->size, MS_SYNC);
+		else if (m->ovl) {
+			msync(m->ovl->delta, m->size, MS_SYNC);
+			ovl_sync_bitmap(m);
+		}
+		m->dirty = 0;
+	}
+}
+
+static void disk_exit(void)
+{
+	struct disk_map *m;
+	for (m = maps; m; m = m->next)
+		disk_sync_map(m);
+}
+
+static void disk_hook_exit(void)
+{
+	if (!exit_hooked) {
+		exit_hooked = 1;
+		atexit(disk_exit);
+	}
+}
+
+static void ovl_put32(uint8_t *p, uint32_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	p[2] = v >> 16;
+	p[3] = v >> 24;
+}
+
+static uint32_t ovl_get32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static off_t ovl_bitmap_size(uint64_t blocks)
+{
+	return ((blocks + 7) / 8 + OVL_PAGE - 1) & ~(off_t)(OVL_PAGE - 1);
+}
+
+/* Read the header if this is an overlay */
+static int ovl_header(int fd, uint8_t *h)
+{
+	if (pread(fd, h, OVL_HEADER, 0) != OVL_HEADER)
+		return -1;
+	return memcmp(h, ovl_magic, 8) ? -1 : 0;
+}
+
+static void ovl_fail(const char *what, const char *why)
+{
+	fprintf(stderr, "%s: %s.\n", what, why);
+	exit(1);
+}
+
+static void ovl_open(struct disk_map *m, const uint8_t *h)
+{
+	struct overlay *o = malloc(sizeof(struct overlay));
+	int flags = cow ? MAP_PRIVATE : MAP_SHARED;
+	unsigned len = h[24] | (h[25] << 8);
+	struct stat st;
+	void *p;
+
+	if (o == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	memset(o, 0, sizeof(*o));
+	if (ovl_get32(h + 8) != OVL_VERSION || ovl_get32(h + 12) != OVL_BLOCK ||
+		len == 0 || len >= sizeof(o->path) || len > OVL_HEADER - 26)
+		ovl_fail("overlay", "unsupported format");
+	memcpy(o->path, h + 26, len);
+	o->blocks = ovl_get32(h + 16) | ((uint64_t)ovl_get32(h + 20) << 32);
+	o->base = open(o->path, O_RDONLY);
+	if (o->base == -1) {
+		perror(o->path);
+		exit(1);
+	}
+	o->image_size = lseek(o->base, 0, SEEK_END);
+	if (o->image_size <= 0 || (o->image_size + OVL_BLOCK - 1) / OVL_BLOCK != o->blocks)
+		ovl_fail(o->path, "base image has changed size");
+	p = mmap(NULL, o->image_size, PROT_READ, MAP_PRIVATE, o->base, 0);
+	if (p == MAP_FAILED) {
+		perror(o->path);
+		exit(1);
+	}
+	o->image = p;
+	o->bitmap_size = ovl_bitmap_size(o->blocks);
+	o->bitmap = malloc(o->bitmap_size);
+	if (o->bitmap == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	o->data = OVL_HEADER + o->bitmap_size;
+	o->mark_lo = o->bitmap_size;
+	o->mark_hi = 0;
+	m->size = o->blocks * OVL_BLOCK;
+	if (pread(m->fd, o->bitmap, o->bitmap_size, OVL_HEADER) != o->bitmap_size ||
+		fstat(m->fd, &st) == -1 || st.st_size < o->data + m->size)
+		ovl_fail(o->path, "overlay is truncated");
+	/* Private if read only so it can still be used */
+	m->writable = 1;
+	p = mmap(NULL, m->size, PROT_READ | PROT_WRITE, flags, m->fd, o->data);
+	if (p == MAP_FAILED)
+		p = mmap(NULL, m->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, m->fd, o->data);
+	if (p == MAP_FAILED) {
+		perror("overlay");
+		exit(1);
+	}
+	o->delta = p;
+	m->ovl = o;
+	disk_hook_exit();
+}
+
+static unsigned ovl_has(struct overlay *o, uint64_t b)
+{
+	return o->bitmap[b / 8] & (1 << (b & 7));
+}
+
+/* The overlay now holds block b. The bitmap in the file is only updated
+   after the blocks have been synced, so it never claims a block whose
+   data didn't get to the disk. A crash between syncs loses the writes
+   since the last one, as it would with the disk's own write cache */
+static void ovl_mark(struct disk_map *m, uint64_t b)
+{
+	struct overlay *o = m->ovl;
+
+	o->bitmap[b / 8] |= 1 << (b & 7);
+	if (b / 8 < o->mark_lo)
+		o->mark_lo = b / 8;
+	if (b / 8 >= o->mark_hi)
+		o->mark_hi = b / 8 + 1;
+}
+
+/* Copy from the base, which may end part way through its last block */
+static void ovl_base(struct overlay *o, uint8_t *buf, unsigned len, off_t pos)
+{
+	unsigned n = 0;
+
+	if (pos < o->image_size)
+		n = o->image_size - pos < len ? o->image_size - pos : len;
+	memcpy(buf, o->image + pos, n);
+	memset(buf + n, 0, len - n);
+}
+
+static int ovl_xfer(struct disk_map *m, uint8_t *buf, unsigned len, off_t pos, int wr)
+{
+	struct overlay *o = m->ovl;
+	unsigned done = 0;
+	unsigned off, n;
+	uint64_t b;
+	uint8_t *blk;
+
+	if (pos < 0)
+		return -1;
+	while (done < len && pos < m->size) {
+		b = pos / OVL_BLOCK;
+		off = pos % OVL_BLOCK;
+		n = OVL_BLOCK - off;
+		if (n > len - done)
+			n = len - done;
+		blk = o->delta + b * OVL_BLOCK;
+		if (wr) {
+			if (!ovl_has(o, b)) {
+				/* Start from the base unless it is all replaced */
+				if (n != OVL_BLOCK)
+					ovl_base(o, blk, OVL_BLOCK, b * OVL_BLOCK);
+				ovl_mark(m, b);
+			}
+			memcpy(blk + off, buf, n);
+			m->dirty = 1;
+		} else if (ovl_has(o, b))
+			memcpy(buf, blk + off, n);
+		else
+			ovl_base(o, buf, n, pos);
+		done += n;
+		buf += n;
+		pos += n;
+	}
+	return done;
+}
+
+static void disk_map_image(struct disk_map *m)
+{
+	struct stat st;
+	int flags = cow ? MAP_PRIVATE : MAP_SHARED;
+	uint8_t h[OVL_HEADER];
+	void *p;
+
+	if (fstat(m->fd, &st) == -1 || !(S_ISREG(st.st_mode) || S_ISBLK(st.st_mode)))
+		return;
+	if (ovl_header(m->fd, h) == 0) {
+		ovl_open(m, h);
+		return;
+	}
+	m->size = lseek(m->fd, 0, SEEK_END);
+	if (m->size <= 0)
+		return;
+	/* A read only image can still have a private writable map */
+	m->writable = 1;
+	p = mmap(NULL, m->size, PROT_READ | PROT_WRITE, flags, m->fd, 0);
+	if (p == MAP_FAILED) {
+		m->writable = 0;
+		p = mmap(NULL, m->size, PROT_READ, flags, m->fd, 0);
+		if (p == MAP_FAILED)
+			return;
+	}
+	m->base = p;
+	disk_hook_exit();
+}
+
+static struct disk_map *disk_find(int fd)
+{
+	struct disk_map *m = last_map;
+
+	if (m && m->fd == fd)
+		return m;
+	for (m = maps; m; m = m->next)
+		if (m->fd == fd)
+			break;
+	if (m == NULL) {
+		m = malloc(sizeof(struct disk_map));
+		if (m == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+		memset(m, 0, sizeof(*m));
+		m->fd = fd;
+		disk_map_image(m);
+		m->next = maps;
+		maps = m;
+	}
+	last_map = m;
+	return m;
+}
+
+/* The mapping if the whole transfer lies within it */
+static uint8_t *disk_mapped(struct disk_map *m, unsigned len, off_t pos)
+{
+	if (m->base == NULL || pos < 0 || pos + len > m->size)
+		return NULL;
+	return m->base + pos;
+}
+
+void disk_sync(unsigned mode)
+{
+	sync_mode = mode;
+}
+
+/* The guest asked for its writes to be made safe */
+void disk_flush(int fd)
+{
+	struct disk_map *m = disk_find(fd);
+	disk_sync_map(m);
+	if (!cow)
+		fsync(fd);
+}
+
+void disk_private(void)
+{
+	struct disk_map *m;
+	void *p;
+
+	if (cow)
+		return;
+	cow = calloc(COW_HASH, sizeof(struct cow_block *));
+	if (cow == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	/* Swap each shared mapping for a private one in the same place */
+	for (m = maps; m; m = m->next) {
+		if (m->ovl)
+			p = mmap(m->ovl->delta, m->size, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_FIXED, m->fd, m->ovl->data);
+		else if (m->base)
+			p = mmap(m->base, m->size, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_FIXED, m->fd, 0);
+		else
+			continue;
+		if (p == MAP_FAILED) {
+			perror("disk_private");
+			exit(1);
+		}
+		m->writable = 1;
+	}
+}
+
+static unsigned cow_hash(int fd, off_t pos)
+{
+	return ((pos / COW_BLOCK) * 31 + fd) & (COW_HASH - 1);
+}
+
+static struct cow_block *cow_find(int fd, off_t pos)
+{
+	struct cow_block *b = cow[cow_hash(fd, pos)];
+	while (b) {
+		if (b->fd == fd && b->pos == pos)
+			return b;
+		b = b->next;
+	}
+	return NULL;
+}
+
+/* Make a private copy of the block, padding past the end of the image */
+static struct cow_block *cow_copy(int fd, off_t pos)
+{
+	struct cow_block *b = malloc(sizeof(struct cow_block));
+	unsigned h = cow_hash(fd, pos);
+	int l;
+
+	if (b == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	stats.disk_reads++;
+	l = pread(fd, b->data, COW_BLOCK, pos);
+	if (l < 0) {
+		free(b);
+		return NULL;
+	}
+	memset(b->data + l, 0, COW_BLOCK - l);
+	b->fd = fd;
+	b->pos = pos;
+	b->next = cow[h];
+	cow[h] = b;
+	return b;
+}
+
+/* Work through a transfer a block at a time */
+static int cow_xfer(int fd, uint8_t *buf, unsigned len, off_t pos, int wr)
+{
+	struct cow_block *b;
+	unsigned done = 0;
+	unsigned off, n;
+	int l;
+
+	while (done < len) {
+		off = pos % COW_BLOCK;
+		n = COW_BLOCK - off;
+		if (n > len - done)
+			n = len - done;
+		b = cow_find(fd, pos - off);
+		if (wr) {
+			if (b == NULL && (b = cow_copy(fd, pos - off)) == NULL)
+				return done ? done : -1;
+			memcpy(b->data + off, buf, n);
+		} else if (b)
+			memcpy(buf, b->data + off, n);
+		else {
+			stats.disk_reads++;
+			l = pread(fd, buf, n, pos);
+			if (l < 0)
+				return done ? done : -1;
+			if (l != n)
+				return done + l;
+		}
+		done += n;
+		buf += n;
+		pos += n;
+	}
+	return done;
+}
+
+/* Look at data in the image without copying it. NULL if it isn't mapped,
+   in which case use disk_read */
+const uint8_t *disk_peek(int fd, unsigned len, off_t pos)
+{
+	struct disk_map *m = disk_find(fd);
+	struct overlay *o = m->ovl;
+
+	if (o == NULL)
+		return disk_mapped(m, len, pos);
+	/* Only within a block as the next one may come from elsewhere */
+	if (pos < 0 || pos + len > m->size || pos % OVL_BLOCK + len > OVL_BLOCK)
+		return NULL;
+	if (ovl_has(o, pos / OVL_BLOCK))
+		return o->delta + pos;
+	if (pos + len > o->image_size)
+		return NULL;
+	return o->image + pos;
+}
+
+int disk_read(int fd, void *buf, unsigned len, off_t pos)
+{
+	struct disk_map *m = disk_find(fd);
+	uint8_t *p;
+
+	if (m->ovl)
+		return ovl_xfer(m, buf, len, pos, 0);
+	p = disk_mapped(m, len, pos);
+	if (p) {
+		memcpy(buf, p, len);
+		return len;
+	}
+	if (cow)
+		return cow_xfer(fd, buf, len, pos, 0);
+	stats.disk_reads++;
+	return pread(fd, buf, len, pos);
+}
+
+int disk_write(int fd, const void *buf, unsigned len, off_t pos)
+{
+	struct disk_map *m = disk_find(fd);
+	uint8_t *p = m->ovl ? m->ovl->delta : m->base;
+	int len2;
+
+	if (m->ovl)
+		len2 = ovl_xfer(m, (uint8_t *)buf, len, pos, 1);
+	else if (disk_mapped(m, len, pos) && m->writable) {
+		memcpy(p + pos, buf, len);
+		m->dirty = 1;
+		len2 = len;
+	} else if (cow)
+		return cow_xfer(fd, (uint8_t *)buf, len, pos, 1);
+	else {
+		stats.disk_writes++;
+		return pwrite(fd, buf, len, pos);
+	}
+	if (sync_mode == DISK_SYNC_WRITE && !cow && len2 > 0) {
+		/* msync wants the start on a page boundary */
+		off_t start = pos & ~(off_t)(sysconf(_SC_PAGESIZE) - 1);
+		msync(p + start, pos + len2 - start, MS_SYNC);
+		if (m->ovl)
+			ovl_sync_bitmap(m);
+	}
+	return len2;
+}
+
+/* Write back and drop the mapping before the descriptor is reused */
+void disk_close(int fd)
+{
+	struct disk_map **mp = &maps;
+	struct disk_map *m;
+
+	while ((m = *mp) != NULL) {
+		if (m->fd == fd) {
+			disk_sync_map(m);
+			if (m->base)
+				munmap(m->base, m->size);
+			if (m->ovl) {
+				munmap(m->ovl->delta, m->size);
+				munmap(m->ovl->image, m->ovl->image_size);
+				close(m->ovl->base);
+				free(m->ovl->bitmap);
+				free(m->ovl);
+			}
+			*mp = m->next;
+			if (last_map == m)
+				last_map = NULL;
+			free(m);
+			break;
+		}
+		mp = &m->next;
+	}
+	close(fd);
+}
+
+/* The size of the disk, which for an overlay is the size of its base */
+off_t disk_size(int fd)
+{
+	struct disk_map *m = disk_find(fd);
+	if (m->ovl)
+		return m->ovl->image_size;
+	if (m->base)
+		return m->size;
+	return lseek(fd, 0, SEEK_END);
+}
+
+/* Make an empty overlay on top of base */
+int disk_overlay(const char *base, const char *path)
+{
+	uint8_t h[OVL_HEADER];
+	char *real = realpath(base, NULL);
+	uint64_t blocks;
+	size_t len;
+	off_t size;
+	int fd;
+
+	if (real == NULL) {
+		perror(base);
+		return -1;
+	}
+	fd = open(real, O_RDONLY);
+	if (fd == -1) {
+		perror(base);
+		free(real);
+		return -1;
+	}
+	size = lseek(fd, 0, SEEK_END);
+	if (ovl_header(fd, h) == 0 || size <= 0) {
+		fprintf(stderr, "%s: not a plain disk image.\n", base);
+		close(fd);
+		free(real);
+		return -1;
+	}
+	close(fd);
+	len = strlen(real);
+	if (len > OVL_HEADER - 26) {
+		fprintf(stderr, "%s: path too long.\n", base);
+		free(real);
+		return -1;
+	}
+	blocks = (size + OVL_BLOCK - 1) / OVL_BLOCK;
+	memset(h, 0, sizeof(h));
+	memcpy(h, ovl_magic, 8);
+	ovl_put32(h + 8, OVL_VERSION);
+	ovl_put32(h + 12, OVL_BLOCK);
+	ovl_put32(h + 16, blocks);
+	ovl_put32(h + 20, blocks >> 32);
+	h[24] = len;
+	h[25] = len >> 8;
+	memcpy(h + 26, real, len);
+	free(real);
+
+	fd = open(path, O_WRONLY | O_CREAT | O_EXCL, 0666);
+	if (fd == -1) {
+		perror(path);
+		return -1;
+	}
+	/* The bitmap and blocks are left as a hole */
+	if (write(fd, h, OVL_HEADER) != OVL_HEADER ||
+		ftruncate(fd, OVL_HEADER + ovl_bitmap_size(blocks) + blocks * OVL_BLOCK)) {
+		perror(path);
+		close(fd);
+		return -1;
+	}
+	close(fd);
+	return 0;
+}
+
+/* The base image of an overlay, or NULL if fd is not one */
+const char *disk_base(int fd)
+{
+	struct disk_map *m = disk_find(fd);
+	return m->ovl ? m->ovl->path : NULL;
+}
+
+/* Write the blocks an overlay holds into target at the same place. If
+   empty is set the overlay is then emptied. Returns the blocks written or
+   -1 */
+long disk_commit(int fd, int target, int empty)
+{
+	struct disk_map *m = disk_find(fd);
+	struct overlay *o = m->ovl;
+	unsigned long n = 0;
+	uint64_t b;
+
+	if (o == NULL)
+		return -1;
+	for (b = 0; b < o->blocks; b++) {
+		off_t pos = b * OVL_BLOCK;
+		unsigned len = OVL_BLOCK;
+		if (!ovl_has(o, b))
+			continue;
+		/* Don't grow a base that ends part way through a block */
+		if (pos + len > o->image_size)
+			len = o->image_size - pos;
+		if (pwrite(target, o->delta + pos, len, pos) != len)
+			return -1;
+		n++;
+	}
+	if (fsync(target))
+		return -1;
+	if (empty) {
+		/* Truncating to the header and growing again clears the
+		   bitmap and gives back the space */
+		memset(o->bitmap, 0, o->bitmap_size);
+		o->mark_lo = o->bitmap_size;
+		o->mark_hi = 0;
+		if (ftruncate(fd, OVL_HEADER) || ftruncate(fd, o->data + m->size) ||
+			fsync(fd))
+			return -1;
+		m->dirty = 0;
+	}
+	return n;
+}
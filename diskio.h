@@ -0,0 +1,30 @@
+/*
+ *	Disk image I/O for the disk controllers. Transfers give their own
+ *	position so nothing relies on the file offset, which is shared with
+ *	any forked copy of the emulator.
+ *
+ *	Both return the bytes moved or -1 as pread/pwrite do.
+ */
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/* When mapped writes are forced out to the image */
+#define DISK_SYNC_FLUSH		0	/* On a flush cache, close or exit */
+#define DISK_SYNC_WRITE		1	/* After each write */
+
+int disk_read(int fd, void *buf, unsigned len, off_t pos);
+int disk_write(int fd, const void *buf, unsigned len, off_t pos);
+const uint8_t *disk_peek(int fd, unsigned len, off_t pos);
+void disk_flush(int fd);
+void disk_close(int fd);
+void disk_sync(unsigned mode);
+off_t disk_size(int fd);
+
+/* Overlays: the blocks written to a disk kept apart from a shared base */
+int disk_overlay(const char *base, const char *path);
+const char *disk_base(int fd);
+long disk_commit(int fd, int target, int empty);
+
+/* From now on keep writes in this process and leave the images alone */
+void disk_private(void);
@@ -3,6 +3,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include "serialdevice.h"
+#include "ttycon.h"
 #include "duart.h"
 
 /* 68681 DUART */
@@ -85,7 +87,7 @@ static void duart_output(struct duart *d, int port, int value)
 	if (d->port[port].sr & 0x04) {
 		if (d->input - 1 == port) {
 			uint8_t v = value & 0xFF;
-			write(1, &v, 1);
+			console.put(&console, v);
 		}
 		d->port[port].sr &= 0xF3;
 		duart_irq_calc(d);
@@ -0,0 +1,204 @@
+/*
+ *	Test fan out
+ *
+ *	The parent stops at the checkpoint and forks a child per case, up to
+ *	one per host CPU at a time. fork() gives each child its own copy on
+ *	write view of the machine memory and disk_private() does the same for
+ *	the disk images, so all the cases start from exactly the same state
+ *	and none of them can disturb another. Console input is taken in lock
+ *	step with the emulation so a case gives the same log every run.
+ *
+ *	A case passes if its emulator exits with 0, which the guest asks for
+ *	through fanout_exit. Cases that run past their timeout are killed by
+ *	the alarm.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "serialdevice.h"
+#include "ttycon.h"
+#include "diskio.h"
+#include "replay.h"
+#include "fanout.h"
+
+#define FANOUT_TIMEOUT	60	/* Seconds */
+
+struct fanout_case {
+	char *name;
+	char *script;
+	unsigned timeout;
+	pid_t pid;
+};
+
+unsigned fanout_pending;
+unsigned fanout_active;
+
+static struct fanout_case *cases;
+static unsigned ncases;
+
+static char *fanout_strdup(const char *p)
+{
+	char *n = strdup(p);
+	if (n == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	return n;
+}
+
+void fanout_load(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char buf[1024];
+	char name[256], script[512];
+	struct fanout_case *c;
+	unsigned line = 0;
+	int n;
+
+	if (f == NULL) {
+		perror(path);
+		exit(1);
+	}
+	while (fgets(buf, sizeof(buf), f)) {
+		line++;
+		if (*buf == '#' || strspn(buf, " \t\r\n") == strlen(buf))
+			continue;
+		cases = realloc(cases, (ncases + 1) * sizeof(struct fanout_case));
+		if (cases == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+		c = cases + ncases;
+		c->timeout = FANOUT_TIMEOUT;
+		n = sscanf(buf, "%255s %511s %u", name, script, &c->timeout);
+		if (n < 2) {
+			fprintf(stderr, "%s:%u: expected name script [timeout].\n", path, line);
+			exit(1);
+		}
+		c->name = fanout_strdup(name);
+		c->script = fanout_strdup(script);
+		c->pid = 0;
+		ncases++;
+	}
+	fclose(f);
+	if (ncases == 0) {
+		fprintf(stderr, "%s: no test cases.\n", path);
+		exit(1);
+	}
+	fanout_pending = 1;
+}
+
+/* In the child: swap the console over to the case files */
+static void fanout_child(struct fanout_case *c)
+{
+	char *log = malloc(strlen(c->name) + 5);
+	int fd;
+
+	if (log == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	sprintf(log, "%s.log", c->name);
+	fd = open(c->script, O_RDONLY);
+	if (fd == -1 || dup2(fd, 0) == -1) {
+		perror(c->script);
+		exit(1);
+	}
+	close(fd);
+	fd = open(log, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd == -1 || dup2(fd, 1) == -1) {
+		perror(log);
+		exit(1);
+	}
+	close(fd);
+	free(log);
+	console_forked();
+	console_lockstep();
+	disk_private();
+	/* The -y log is the parent's, a case is not part of it */
+	replay_mode = REPLAY_OFF;
+	signal(SIGALRM, SIG_DFL);
+	alarm(c->timeout);
+	fanout_pending = 0;
+	fanout_active = 1;
+}
+
+/* The guest has said how its case went. The console is drained at exit */
+void fanout_exit(unsigned status)
+{
+	exit(status & 0xFF);
+}
+
+static unsigned fanout_report(pid_t pid, int status)
+{
+	struct fanout_case *c;
+
+	for (c = cases; c < cases + ncases; c++)
+		if (c->pid == pid)
+			break;
+	if (c == cases + ncases)
+		return 0;
+	c->pid = 0;
+	if (WIFEXITED(status)) {
+		if (WEXITSTATUS(status) == 0) {
+			fprintf(stderr, "%s: passed\n", c->name);
+			return 0;
+		}
+		fprintf(stderr, "%s: failed (exit %d)\n", c->name, WEXITSTATUS(status));
+	} else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+		fprintf(stderr, "%s: failed (timed out)\n", c->name);
+	else
+		fprintf(stderr, "%s: failed (signal %d)\n", c->name, WTERMSIG(status));
+	return 1;
+}
+
+/* Returns only in the children */
+void fanout_run(void)
+{
+	long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned running = 0;
+	unsigned failed = 0;
+	unsigned i;
+	pid_t pid;
+	int status;
+
+	if (jobs < 1)
+		jobs = 1;
+	/* Anything still queued belongs to the boot not to the cases. That
+	   includes a -y log, which each child would otherwise write again */
+	console_drain();
+	fflush(NULL);
+
+	for (i = 0; i < ncases || running; ) {
+		if (i < ncases && running < jobs) {
+			pid = fork();
+			if (pid == -1) {
+				perror("fork");
+				exit(1);
+			}
+			if (pid == 0) {
+				fanout_child(cases + i);
+				return;
+			}
+			cases[i++].pid = pid;
+			running++;
+			continue;
+		}
+		pid = wait(&status);
+		if (pid == -1) {
+			perror("wait");
+			exit(1);
+		}
+		failed += fanout_report(pid, status);
+		running--;
+	}
+	fprintf(stderr, "%u of %u cases passed.\n", ncases - failed, ncases);
+	exit(failed ? 1 : 0);
+}
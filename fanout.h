@@ -0,0 +1,30 @@
+/*
+ *	Run a set of test cases from one booted machine. The manifest has a
+ *	line per case
+ *
+ *	name script [timeout]
+ *
+ *	When the board reaches its checkpoint it calls fanout_run. Each case
+ *	gets a forked copy of the machine reading its console input from the
+ *	script and writing its console output to name.log. Disk writes stay
+ *	in the copy. The parent reports how each case exited and exits.
+ *
+ *	The guest ends a case by writing its exit status to the board's
+ *	fanout port, 0 for a pass and anything else for a failure:
+ *
+ *	rc2014		I/O port 0xFB
+ *	rcbus-6809	$FEFC
+ *
+ *	The port is only there in a forked case. On rc2014 a HALT with
+ *	interrupts off also ends the case, as a pass. A case that does
+ *	neither is killed at its timeout and fails.
+ */
+
+/* Set while there is a manifest waiting to be run */
+extern unsigned fanout_pending;
+/* Set in a forked case, where the board decodes its fanout port */
+extern unsigned fanout_active;
+
+void fanout_load(const char *path);
+void fanout_run(void);
+void fanout_exit(unsigned status);
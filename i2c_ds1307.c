@@ -8,6 +8,7 @@
 #include "system.h"
 #include "i2c_bitbang.h"
 #include "i2c_ds1307.h"
+#include "replay.h"
 
 
 /* Real time clock state machine and related state.
@@ -96,7 +97,7 @@ static void rtc_write(struct ds1307 *rtc, uint8_t byte) {
 static void rtc_freeze(struct ds1307 *rtc) {
 uint8_t v, val;
 
-	time_t t = time(NULL);
+	time_t t = replay_time();
 	rtc->tm = localtime(&t);
 
 	if (rtc->tm == NULL) {
@@ -27,6 +27,8 @@
 #include <arpa/inet.h>
 
 #include "ide.h"
+#include "diskio.h"
+#include "snapshot.h"
 
 #define IDE_IDLE	0
 #define IDE_CMD		1
@@ -60,6 +62,8 @@
 #define DCL_SRST	4
 #define DCL_NIEN	2
 
+#define MAX_MULTIPLE	16	/* Largest READ/WRITE MULTIPLE block */
+
 #define IDE_CMD_CALIB		0x10
 #define IDE_CMD_READ		0x20
 #define IDE_CMD_READ_NR		0x21
@@ -70,6 +74,10 @@
 #define IDE_CMD_SEEK		0x70
 #define IDE_CMD_EDD		0x90
 #define IDE_CMD_INTPARAMS	0x91
+#define IDE_CMD_READ_MULTI	0xC4
+#define IDE_CMD_WRITE_MULTI	0xC5
+#define IDE_CMD_SET_MULTI	0xC6
+#define IDE_CMD_FLUSH		0xE7
 #define IDE_CMD_IDENTIFY	0xEC
 #define IDE_CMD_SETFEATURES	0xEF
 
@@ -197,7 +205,9 @@ static void data_in_state(struct ide_taskfile *tf)
 {
 	struct ide_drive *d = tf->drive;
 	d->state = IDE_DATA_IN;
+	d->buf = d->data;
 	d->dptr = d->data + 512;
+	d->block = 0;
 	/* We don't clear DRDY here, drives may well accept a command at this
 	   point and at least one firmware for RC2014 assumes this */
 	tf->status &= ~ST_BSY;
@@ -209,7 +219,9 @@ static void data_out_state(struct ide_taskfile *tf)
 {
 	struct ide_drive *d = tf->drive;
 	d->state = IDE_DATA_OUT;
+	d->buf = d->data;
 	d->dptr = d->data;
+	d->block = 0;
 	tf->status &= ~ST_BSY;
 	tf->status |= ST_DRQ | ST_DRDY;
 	d->intrq = 1;			/* Double check */
@@ -246,6 +258,8 @@ void ide_reset(struct ide_controller *c)
 
 void ide_reset_begin(struct ide_controller *c)
 {
+	c->drive[0].multiple = 0;
+	c->drive[1].multiple = 0;
 	if (c->drive[0].present)
 		c->drive[0].taskfile.status |= ST_BSY;
 	if (c->drive[1].present)
@@ -283,7 +297,12 @@ static void cmd_edd_complete(struct ide_taskfile *tf)
 static void cmd_identify_complete(struct ide_taskfile *tf)
 {
 	struct ide_drive *d = tf->drive;
+	uint16_t *ident = (uint16_t *)d->data;
+
 	memcpy(d->data, d->identify, 512);
+	/* Older images say no multiple mode so fill it in here */
+	ident[47] = le16(0x8000 | MAX_MULTIPLE);
+	ident[59] = le16(d->multiple ? 0x100 | d->multiple : 0);
 	data_in_state(tf);
 	/* Arrange to copy just the identify buffer */
 	d->dptr = d->data;
@@ -306,6 +325,25 @@ static void cmd_initparam_complete(struct ide_taskfile *tf)
 	completed(tf);
 }
 
+/* Sectors per DRQ block for the command, 0 if it can't be done */
+static unsigned block_size(struct ide_taskfile *tf)
+{
+	if (tf->command == IDE_CMD_READ_MULTI || tf->command == IDE_CMD_WRITE_MULTI)
+		return tf->drive->multiple;
+	return 1;
+}
+
+static int multiple_disabled(struct ide_taskfile *tf)
+{
+	tf->drive->bsize = block_size(tf);
+	if (tf->drive->bsize)
+		return 0;
+	tf->status |= ST_ERR;
+	tf->error |= ERR_ABRT;
+	completed(tf);
+	return 1;
+}
+
 static void cmd_readsectors_complete(struct ide_taskfile *tf)
 {
 	struct ide_drive *d = tf->drive;
@@ -314,6 +352,8 @@ static void cmd_readsectors_complete(struct ide_taskfile *tf)
 		drive_failed(tf);
 		return;
 	}
+	if (multiple_disabled(tf))
+		return;
 	d->offset = xlate_block(tf);
 	/* DRDY is not guaranteed here but at least one buggy RC2014 firmware
 	   expects it */
@@ -322,7 +362,7 @@ static void cmd_readsectors_complete(struct ide_taskfile *tf)
 	/* 0 = 256 sectors */
 	d->length = tf->count ? tf->count : 256;
 	/* fprintf(stderr, "READ %d SECTORS @ %ld\n", d->length, d->offset); */
-	if (d->offset == -1 ||  lseek(d->fd, 512 * d->offset, SEEK_SET) == -1) {
+	if (d->offset == -1) {
 		tf->status |= ST_ERR;
 		tf->status &= ~ST_DSC;
 		tf->error |= ERR_IDNF;
@@ -345,7 +385,7 @@ static void cmd_verifysectors_complete(struct ide_taskfile *tf)
 	d->offset = xlate_block(tf);
 	/* 0 = 256 sectors */
 	d->length = tf->count ? tf->count : 256;
-	if (d->offset == -1 || lseek(d->fd, 512 * (d->offset + d->length - 1), SEEK_SET) == -1) {
+	if (d->offset == -1) {
 		tf->status &= ~ST_DSC;
 		tf->status |= ST_ERR;
 		tf->error |= ERR_IDNF;
@@ -375,7 +415,7 @@ static void cmd_seek_complete(struct ide_taskfile *tf)
 	if (d->failed)
 		drive_failed(tf);
 	d->offset = xlate_block(tf);
-	if (d->offset == -1 || lseek(d->fd, 512 * d->offset, SEEK_SET) == -1) {
+	if (d->offset == -1) {
 		tf->status &= ~ST_DSC;
 		tf->status |= ST_ERR;
 		tf->error |= ERR_IDNF;
@@ -416,12 +456,14 @@ static void cmd_writesectors_complete(struct ide_taskfile *tf)
 		drive_failed(tf);
 		return;
 	}
+	if (multiple_disabled(tf))
+		return;
 	d->offset = xlate_block(tf);
 	tf->status |= ST_DRQ;
 	/* 0 = 256 sectors */
 	d->length = tf->count ? tf->count : 256;
 /*	fprintf(stderr, "WRITE %d SECTORS @ %ld\n", d->length, d->offset); */
-	if (d->offset == -1 ||  lseek(d->fd, 512 * d->offset, SEEK_SET) == -1) {
+	if (d->offset == -1) {
 		tf->status |= ST_ERR;
 		tf->error |= ERR_IDNF;
 		tf->status &= ~ST_DSC;
@@ -433,6 +475,17 @@ static void cmd_writesectors_complete(struct ide_taskfile *tf)
 	data_out_state(tf);
 }
 
+static void cmd_setmultiple_complete(struct ide_taskfile *tf)
+{
+	/* Any power of two up to the maximum, 0 turns it off */
+	if (tf->count > MAX_MULTIPLE || (tf->count & (tf->count - 1))) {
+		tf->status |= ST_ERR;
+		tf->error |= ERR_ABRT;
+	} else
+		tf->drive->multiple = tf->count;
+	completed(tf);
+}
+
 static void ide_set_error(struct ide_drive *d)
 {
 	d->taskfile.lba4 &= ~DEVH_HEAD;
@@ -460,16 +513,21 @@ static int ide_read_sector(struct ide_drive *d)
 {
 	int len;
 
-	d->dptr = d->data;
-	if ((len = read(d->fd, d->data, 512)) != 512) {
-		perror("ide_read_sector");
-		d->taskfile.status |= ST_ERR;
-		d->taskfile.status &= ~ST_DSC;
-		ide_xlate_errno(&d->taskfile, len);
-		return -1;
+	/* Read straight from the image if we can */
+	d->buf = (uint8_t *)disk_peek(d->fd, 512, 512 * d->offset);
+	if (d->buf == NULL) {
+		d->buf = d->data;
+		if ((len = disk_read(d->fd, d->data, 512, 512 * d->offset)) != 512) {
+			perror("ide_read_sector");
+			d->taskfile.status |= ST_ERR;
+			d->taskfile.status &= ~ST_DSC;
+			ide_xlate_errno(&d->taskfile, len);
+			return -1;
+		}
 	}
-	HEXDUMP_DATA(d->data)
-	d->offset += 512;
+	d->dptr = d->buf;
+	HEXDUMP_DATA(d->buf)
+	d->offset++;
 	return 0;
 }
 
@@ -478,22 +536,38 @@ static int ide_write_sector(struct ide_drive *d)
 	int len;
 
 	d->dptr = d->data;
-	if ((len = write(d->fd, d->data, 512)) != 512) {
+	if ((len = disk_write(d->fd, d->data, 512, 512 * d->offset)) != 512) {
 		d->taskfile.status |= ST_ERR;
 		d->taskfile.status &= ~ST_DSC;
 		ide_xlate_errno(&d->taskfile, len);
 		return -1;
 	}
 	HEXDUMP_DATA(d->data)
-	d->offset += 512;
+	d->offset++;
 	return 0;
 }
 
+/* A sector has been moved. The interrupt comes at the end of each block */
+static void ide_sector_done(struct ide_drive *d)
+{
+	d->length--;
+	if (++d->block == d->bsize || d->length == 0) {
+		d->block = 0;
+		d->intrq = 1;
+	}
+	if (d->length == 0) {
+		if (d->state == IDE_DATA_OUT)
+			d->taskfile.status |= ST_DSC;
+		d->state = IDE_IDLE;
+		completed(&d->taskfile);
+	}
+}
+
 static uint16_t ide_data_in(struct ide_drive *d, int len)
 {
 	uint16_t v;
 	if (d->state == IDE_DATA_IN) {
-		if (d->dptr == d->data + 512) {
+		if (d->dptr == d->buf + 512) {
 			if (ide_read_sector(d) < 0) {
 				ide_set_error(d); /* Set the LBA or CHS etc */
 				return 0xFFFF;	/* and error bits set by read_sector */
@@ -507,14 +581,8 @@ static uint16_t ide_data_in(struct ide_drive *d, int len)
 		} else
 			d->dptr++;
 		d->taskfile.data = v;
-		if (d->dptr == d->data + 512) {
-			d->length--;
-			d->intrq = 1;		/* we don't yet emulate multimode */
-			if (d->length == 0) {
-				d->state = IDE_IDLE;
-				completed(&d->taskfile);
-			}
-		}
+		if (d->dptr == d->buf + 512)
+			ide_sector_done(d);
 	} else
 		ide_fault(d, "bad data read");
 
@@ -542,17 +610,17 @@ static void ide_data_out(struct ide_drive *d, uint16_t v, int len)
 				ide_set_error(d);
 				return;
 			}
-			d->length--;
-			d->intrq = 1;
-			if (d->length == 0) {
-				d->state = IDE_IDLE;
-				d->taskfile.status |= ST_DSC;
-				completed(&d->taskfile);
-			}
+			ide_sector_done(d);
 		}
 	}
 }
 
+static void cmd_flush_complete(struct ide_taskfile *tf)
+{
+	disk_flush(tf->drive->fd);
+	completed(tf);
+}
+
 static void ide_issue_command(struct ide_taskfile *t)
 {
 	t->status &= ~(ST_ERR|ST_DRDY);
@@ -573,8 +641,12 @@ static void ide_issue_command(struct ide_taskfile *t)
 			break;
 		case IDE_CMD_READ:	/* 0x20 */
 		case IDE_CMD_READ_NR:	/* 0x21 */
+		case IDE_CMD_READ_MULTI: /* 0xC4 */
 			cmd_readsectors_complete(t);
 			break;
+		case IDE_CMD_FLUSH:	/* 0xE7 */
+			cmd_flush_complete(t);
+			break;
 		case IDE_CMD_SETFEATURES: /* 0xEF */
 			cmd_setfeatures_complete(t);
 			break;
@@ -584,8 +656,12 @@ static void ide_issue_command(struct ide_taskfile *t)
 			break;
 		case IDE_CMD_WRITE:	/* 0x30 */
 		case IDE_CMD_WRITE_NR:	/* 0x31 */
+		case IDE_CMD_WRITE_MULTI: /* 0xC5 */
 			cmd_writesectors_complete(t);
 			break;
+		case IDE_CMD_SET_MULTI:	/* 0xC6 */
+			cmd_setmultiple_complete(t);
+			break;
 		default:
 			if ((t->command & 0xF0) == IDE_CMD_CALIB)	/* 1x */
 				cmd_recalibrate_complete(t);
@@ -719,6 +795,71 @@ void ide_write16(struct ide_controller *c, uint8_t r, uint16_t v)
 		ide_write8(c, r, v);
 }
 
+/*
+ *	Bulk data transfers. These do what len / width data register reads
+ *	or writes of width bytes would, with words little endian in buf, but
+ *	whole runs within a sector are copied at once. They stop early if the
+ *	drive stops transferring data and return the bytes moved, so the
+ *	caller can do anything left the slow way and get the usual faults.
+ */
+unsigned ide_read_block(struct ide_controller *c, uint8_t *buf, unsigned len, unsigned width)
+{
+	struct ide_drive *d = &c->drive[c->selected];
+	unsigned step = d->eightbit ? 1 : 2;
+	unsigned done = 0;
+	unsigned n;
+	uint16_t v;
+
+	while (done + width <= len && d->state == IDE_DATA_IN) {
+		/* Copy up to but not including the last access of the sector,
+		   which goes the normal way to finish the sector off */
+		n = d->buf + 512 - d->dptr;
+		if (width == step && d->dptr != d->buf + 512 && n > step) {
+			n -= step;
+			if (n > len - done)
+				n = (len - done) & ~(step - 1);
+			memcpy(buf + done, d->dptr, n);
+			d->dptr += n;
+			done += n;
+			d->taskfile.data = step == 1 ? buf[done - 1] :
+				buf[done - 2] | (buf[done - 1] << 8);
+			continue;
+		}
+		v = ide_data_in(d, width);
+		buf[done++] = v;
+		if (width == 2)
+			buf[done++] = v >> 8;
+	}
+	return done;
+}
+
+unsigned ide_write_block(struct ide_controller *c, const uint8_t *buf, unsigned len, unsigned width)
+{
+	struct ide_drive *d = &c->drive[c->selected];
+	unsigned step = d->eightbit ? 1 : 2;
+	unsigned done = 0;
+	unsigned n;
+
+	if (d->taskfile.status & ST_BSY)
+		return 0;
+	while (done + width <= len && d->state == IDE_DATA_OUT) {
+		n = d->data + 512 - d->dptr;
+		if (width == step && n > step) {
+			n -= step;
+			if (n > len - done)
+				n = (len - done) & ~(step - 1);
+			memcpy(d->dptr, buf + done, n);
+			d->dptr += n;
+			done += n;
+			d->taskfile.data = buf[done - 1];
+			continue;
+		}
+		ide_data_out(d, width == 2 ? buf[done] | (buf[done + 1] << 8) : buf[done], width);
+		done += width;
+	}
+	return done;
+}
+
 /*
  *	Allocate a new IDE controller emulation
  */
@@ -750,8 +891,8 @@ int ide_attach(struct ide_controller *c, int drive, int fd)
 		return -1;
 	}
 	d->fd = fd;
-	if (read(d->fd, d->data, 512) != 512 ||
-			read(d->fd, d->identify, 512) != 512) {
+	if (disk_read(d->fd, d->data, 512, 0) != 512 ||
+			disk_read(d->fd, d->identify, 512, 512) != 512) {
 		ide_fault(d, "i/o error on attach");
 		return -1;
 	}
@@ -776,7 +917,7 @@ int ide_attach(struct ide_controller *c, int drive, int fd)
  */
 void ide_detach(struct ide_drive *d)
 {
-	close(d->fd);
+	disk_close(d->fd);
 	d->fd = -1;
 	d->present = 0;
 }
@@ -794,6 +935,63 @@ void ide_free(struct ide_controller *c)
 	free(c);
 }
 
+/*
+ *	Save or restore the controller and drive state. The media itself is
+ *	the attached file and the geometry comes from it when it is attached.
+ */
+void ide_snapshot(struct ide_controller *c, struct snapshot *s)
+{
+	struct ide_drive *d;
+	struct ide_taskfile *t;
+	uint8_t flags;
+	uint32_t dptr;
+	uint64_t offset;
+	unsigned i;
+
+	snapshot_int(s, &c->selected);
+	snapshot_u16(s, &c->data_latch);
+	for (i = 0; i < 2; i++) {
+		d = &c->drive[i];
+		t = &d->taskfile;
+		snapshot_u16(s, &t->data);
+		snapshot_u8(s, &t->error);
+		snapshot_u8(s, &t->feature);
+		snapshot_u8(s, &t->count);
+		snapshot_u8(s, &t->lba1);
+		snapshot_u8(s, &t->lba2);
+		snapshot_u8(s, &t->lba3);
+		snapshot_u8(s, &t->lba4);
+		snapshot_u8(s, &t->status);
+		snapshot_u8(s, &t->command);
+		snapshot_u8(s, &t->devctrl);
+		flags = d->intrq | (d->failed << 1) | (d->lba << 2) | (d->eightbit << 3);
+		snapshot_u8(s, &flags);
+		d->intrq = flags & 1;
+		d->failed = !!(flags & 2);
+		d->lba = !!(flags & 4);
+		d->eightbit = !!(flags & 8);
+		/* A sector being read from the image is saved as a copy */
+		if (d->buf && d->buf != d->data) {
+			memcpy(d->data, d->buf, 512);
+			d->dptr = d->data + (d->dptr - d->buf);
+			d->buf = d->data;
+		}
+		snapshot_bytes(s, d->data, sizeof(d->data));
+		dptr = d->dptr ? d->dptr - d->data : 512;
+		snapshot_u32(s, &dptr);
+		d->buf = d->data;
+		d->dptr = d->data + (dptr > 512 ? 512 : dptr);
+		snapshot_int(s, &d->state);
+		offset = d->offset;
+		snapshot_u64(s, &offset);
+		d->offset = offset;
+		snapshot_int(s, &d->length);
+		snapshot_u8(s, &d->multiple);
+		snapshot_u8(s, &d->bsize);
+		snapshot_u8(s, &d->block);
+	}
+}
+
 /*
  *	Emulation interface for an 8bit controller using latches on the
  *	data register
@@ -864,7 +1062,7 @@ int ide_make_drive(uint8_t type, int fd)
 	memset(ident, 0, 8);
 	ident[0] = le16((1 << 15) | (1 << 6));	/* Non removable */
 	make_serial(ident + 10);
-	ident[47] = 0; /* no read multi for now */
+	ident[47] = le16(0x8000 | MAX_MULTIPLE);	/* READ/WRITE MULTIPLE */
 	ident[51] = le16(240 /* PIO2 */ << 8);	/* PIO cycle time */
 	ident[53] = le16(1);		/* Geometry words are valid */
 
@@ -53,11 +53,15 @@ struct ide_drive {
 	uint8_t heads, sectors;
 	uint8_t data[512];
 	uint16_t identify[256];
+	uint8_t *buf;		/* Sector being read: data or the image itself */
 	uint8_t *dptr;
 	int state;
 	int fd;
 	off_t offset;
 	int length;
+	uint8_t multiple;	/* Sectors per READ/WRITE MULTIPLE block */
+	uint8_t bsize;		/* Sectors per block for this command */
+	uint8_t block;		/* Sectors done in this block */
 };
 
 struct ide_controller {
@@ -76,8 +80,12 @@ uint16_t ide_read16(struct ide_controller *c, uint8_t r);
 void ide_write16(struct ide_controller *c, uint8_t r, uint16_t v);
 uint8_t ide_read_latched(struct ide_controller *c, uint8_t r);
 void ide_write_latched(struct ide_controller *c, uint8_t r, uint8_t v);
+unsigned ide_read_block(struct ide_controller *c, uint8_t *buf, unsigned len, unsigned width);
+unsigned ide_write_block(struct ide_controller *c, const uint8_t *buf, unsigned len, unsigned width);
 
 struct ide_controller *ide_allocate(const char *name);
+struct snapshot;
+void ide_snapshot(struct ide_controller *c, struct snapshot *s);
 int ide_attach(struct ide_controller *c, int drive, int fd);
 void ide_detach(struct ide_drive *d);
 void ide_free(struct ide_controller *c);
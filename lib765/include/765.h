@@ -275,6 +275,8 @@ void fdc_set_terminal_count(FDC_PTR self, fdc_byte value);
 void fdc_set_motor(FDC_PTR self, fdc_byte running);
 /* Call this once every cycle round the emulator's main loop */
 void fdc_tick(FDC_PTR self);
+/* Non zero while fdc_tick has something to count down */
+int fdc_busy(FDC_PTR self);
 /* Write to the Digital Output Register. Write -1 to disable DOR emulation */
 void fdc_write_dor(FDC_PTR self, int value);
 /* Read from the Digital Input Register. */
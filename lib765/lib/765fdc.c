@@ -1004,6 +1004,12 @@ void fdc_tick(FDC_765 *self)
 	} 
 }
 
+/* So an emulator can skip calling fdc_tick while it would do nothing */
+int fdc_busy(FDC_765 *self)
+{
+	return self->fdc_isr_countdown != 0;
+}
+
 
 /* Simulate the Digital Output Register in the IBM PC and clones
  * This is not part of the uPD765A itself, but part of the support 
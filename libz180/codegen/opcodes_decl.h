@@ -0,0 +1,742 @@
+static void ADC_A_off_HL (Z180Context* ctx);
+static void ADC_A_off_IX_d (Z180Context* ctx);
+static void ADC_A_off_IY_d (Z180Context* ctx);
+static void ADC_A_A (Z180Context* ctx);
+static void ADC_A_B (Z180Context* ctx);
+static void ADC_A_C (Z180Context* ctx);
+static void ADC_A_D (Z180Context* ctx);
+static void ADC_A_E (Z180Context* ctx);
+static void ADC_A_H (Z180Context* ctx);
+static void ADC_A_L (Z180Context* ctx);
+static void ADC_A_n (Z180Context* ctx);
+static void ADC_HL_BC (Z180Context* ctx);
+static void ADC_HL_DE (Z180Context* ctx);
+static void ADC_HL_HL (Z180Context* ctx);
+static void ADC_HL_SP (Z180Context* ctx);
+static void ADD_A_off_HL (Z180Context* ctx);
+static void ADD_A_off_IX_d (Z180Context* ctx);
+static void ADD_A_off_IY_d (Z180Context* ctx);
+static void ADD_A_A (Z180Context* ctx);
+static void ADD_A_B (Z180Context* ctx);
+static void ADD_A_C (Z180Context* ctx);
+static void ADD_A_D (Z180Context* ctx);
+static void ADD_A_E (Z180Context* ctx);
+static void ADD_A_H (Z180Context* ctx);
+static void ADD_A_L (Z180Context* ctx);
+static void ADD_A_n (Z180Context* ctx);
+static void ADD_HL_BC (Z180Context* ctx);
+static void ADD_HL_DE (Z180Context* ctx);
+static void ADD_HL_HL (Z180Context* ctx);
+static void ADD_HL_SP (Z180Context* ctx);
+static void ADD_IX_BC (Z180Context* ctx);
+static void ADD_IX_DE (Z180Context* ctx);
+static void ADD_IX_IX (Z180Context* ctx);
+static void ADD_IX_SP (Z180Context* ctx);
+static void ADD_IY_BC (Z180Context* ctx);
+static void ADD_IY_DE (Z180Context* ctx);
+static void ADD_IY_IY (Z180Context* ctx);
+static void ADD_IY_SP (Z180Context* ctx);
+static void AND_off_HL (Z180Context* ctx);
+static void AND_off_IX_d (Z180Context* ctx);
+static void AND_off_IY_d (Z180Context* ctx);
+static void AND_A (Z180Context* ctx);
+static void AND_B (Z180Context* ctx);
+static void AND_C (Z180Context* ctx);
+static void AND_D (Z180Context* ctx);
+static void AND_E (Z180Context* ctx);
+static void AND_H (Z180Context* ctx);
+static void AND_L (Z180Context* ctx);
+static void AND_n (Z180Context* ctx);
+static void BIT_0_off_HL (Z180Context* ctx);
+static void BIT_0_off_IX_d (Z180Context* ctx);
+static void BIT_0_off_IY_d (Z180Context* ctx);
+static void BIT_0_A (Z180Context* ctx);
+static void BIT_0_B (Z180Context* ctx);
+static void BIT_0_C (Z180Context* ctx);
+static void BIT_0_D (Z180Context* ctx);
+static void BIT_0_E (Z180Context* ctx);
+static void BIT_0_H (Z180Context* ctx);
+static void BIT_0_L (Z180Context* ctx);
+static void BIT_1_off_HL (Z180Context* ctx);
+static void BIT_1_off_IX_d (Z180Context* ctx);
+static void BIT_1_off_IY_d (Z180Context* ctx);
+static void BIT_1_A (Z180Context* ctx);
+static void BIT_1_B (Z180Context* ctx);
+static void BIT_1_C (Z180Context* ctx);
+static void BIT_1_D (Z180Context* ctx);
+static void BIT_1_E (Z180Context* ctx);
+static void BIT_1_H (Z180Context* ctx);
+static void BIT_1_L (Z180Context* ctx);
+static void BIT_2_off_HL (Z180Context* ctx);
+static void BIT_2_off_IX_d (Z180Context* ctx);
+static void BIT_2_off_IY_d (Z180Context* ctx);
+static void BIT_2_A (Z180Context* ctx);
+static void BIT_2_B (Z180Context* ctx);
+static void BIT_2_C (Z180Context* ctx);
+static void BIT_2_D (Z180Context* ctx);
+static void BIT_2_E (Z180Context* ctx);
+static void BIT_2_H (Z180Context* ctx);
+static void BIT_2_L (Z180Context* ctx);
+static void BIT_3_off_HL (Z180Context* ctx);
+static void BIT_3_off_IX_d (Z180Context* ctx);
+static void BIT_3_off_IY_d (Z180Context* ctx);
+static void BIT_3_A (Z180Context* ctx);
+static void BIT_3_B (Z180Context* ctx);
+static void BIT_3_C (Z180Context* ctx);
+static void BIT_3_D (Z180Context* ctx);
+static void BIT_3_E (Z180Context* ctx);
+static void BIT_3_H (Z180Context* ctx);
+static void BIT_3_L (Z180Context* ctx);
+static void BIT_4_off_HL (Z180Context* ctx);
+static void BIT_4_off_IX_d (Z180Context* ctx);
+static void BIT_4_off_IY_d (Z180Context* ctx);
+static void BIT_4_A (Z180Context* ctx);
+static void BIT_4_B (Z180Context* ctx);
+static void BIT_4_C (Z180Context* ctx);
+static void BIT_4_D (Z180Context* ctx);
+static void BIT_4_E (Z180Context* ctx);
+static void BIT_4_H (Z180Context* ctx);
+static void BIT_4_L (Z180Context* ctx);
+static void BIT_5_off_HL (Z180Context* ctx);
+static void BIT_5_off_IX_d (Z180Context* ctx);
+static void BIT_5_off_IY_d (Z180Context* ctx);
+static void BIT_5_A (Z180Context* ctx);
+static void BIT_5_B (Z180Context* ctx);
+static void BIT_5_C (Z180Context* ctx);
+static void BIT_5_D (Z180Context* ctx);
+static void BIT_5_E (Z180Context* ctx);
+static void BIT_5_H (Z180Context* ctx);
+static void BIT_5_L (Z180Context* ctx);
+static void BIT_6_off_HL (Z180Context* ctx);
+static void BIT_6_off_IX_d (Z180Context* ctx);
+static void BIT_6_off_IY_d (Z180Context* ctx);
+static void BIT_6_A (Z180Context* ctx);
+static void BIT_6_B (Z180Context* ctx);
+static void BIT_6_C (Z180Context* ctx);
+static void BIT_6_D (Z180Context* ctx);
+static void BIT_6_E (Z180Context* ctx);
+static void BIT_6_H (Z180Context* ctx);
+static void BIT_6_L (Z180Context* ctx);
+static void BIT_7_off_HL (Z180Context* ctx);
+static void BIT_7_off_IX_d (Z180Context* ctx);
+static void BIT_7_off_IY_d (Z180Context* ctx);
+static void BIT_7_A (Z180Context* ctx);
+static void BIT_7_B (Z180Context* ctx);
+static void BIT_7_C (Z180Context* ctx);
+static void BIT_7_D (Z180Context* ctx);
+static void BIT_7_E (Z180Context* ctx);
+static void BIT_7_H (Z180Context* ctx);
+static void BIT_7_L (Z180Context* ctx);
+static void CALL_off_nn (Z180Context* ctx);
+static void CALL_C_off_nn (Z180Context* ctx);
+static void CALL_M_off_nn (Z180Context* ctx);
+static void CALL_NC_off_nn (Z180Context* ctx);
+static void CALL_NZ_off_nn (Z180Context* ctx);
+static void CALL_P_off_nn (Z180Context* ctx);
+static void CALL_PE_off_nn (Z180Context* ctx);
+static void CALL_PO_off_nn (Z180Context* ctx);
+static void CALL_Z_off_nn (Z180Context* ctx);
+static void CCF (Z180Context* ctx);
+static void CP_off_HL (Z180Context* ctx);
+static void CP_off_IX_d (Z180Context* ctx);
+static void CP_off_IY_d (Z180Context* ctx);
+static void CP_A (Z180Context* ctx);
+static void CP_B (Z180Context* ctx);
+static void CP_C (Z180Context* ctx);
+static void CP_D (Z180Context* ctx);
+static void CP_E (Z180Context* ctx);
+static void CP_H (Z180Context* ctx);
+static void CP_L (Z180Context* ctx);
+static void CP_n (Z180Context* ctx);
+static void CPD (Z180Context* ctx);
+static void CPDR (Z180Context* ctx);
+static void CPI (Z180Context* ctx);
+static void CPIR (Z180Context* ctx);
+static void CPL (Z180Context* ctx);
+static void DAA (Z180Context* ctx);
+static void DEC_off_HL (Z180Context* ctx);
+static void DEC_off_IX_d (Z180Context* ctx);
+static void DEC_off_IY_d (Z180Context* ctx);
+static void DEC_A (Z180Context* ctx);
+static void DEC_B (Z180Context* ctx);
+static void DEC_BC (Z180Context* ctx);
+static void DEC_C (Z180Context* ctx);
+static void DEC_D (Z180Context* ctx);
+static void DEC_DE (Z180Context* ctx);
+static void DEC_E (Z180Context* ctx);
+static void DEC_H (Z180Context* ctx);
+static void DEC_HL (Z180Context* ctx);
+static void DEC_IX (Z180Context* ctx);
+static void DEC_IY (Z180Context* ctx);
+static void DEC_L (Z180Context* ctx);
+static void DEC_SP (Z180Context* ctx);
+static void DI (Z180Context* ctx);
+static void DJNZ_off_PC_e (Z180Context* ctx);
+static void EI (Z180Context* ctx);
+static void EX_off_SP_HL (Z180Context* ctx);
+static void EX_off_SP_IX (Z180Context* ctx);
+static void EX_off_SP_IY (Z180Context* ctx);
+static void EX_AF_AF_ (Z180Context* ctx);
+static void EX_DE_HL (Z180Context* ctx);
+static void EXX (Z180Context* ctx);
+static void HALT (Z180Context* ctx);
+static void IM_0 (Z180Context* ctx);
+static void IM_1 (Z180Context* ctx);
+static void IM_2 (Z180Context* ctx);
+static void IN_A_off_C (Z180Context* ctx);
+static void IN_A_off_n (Z180Context* ctx);
+static void IN_B_off_C (Z180Context* ctx);
+static void IN_C_off_C (Z180Context* ctx);
+static void IN_D_off_C (Z180Context* ctx);
+static void IN_E_off_C (Z180Context* ctx);
+static void IN_F_off_C (Z180Context* ctx);
+static void IN_H_off_C (Z180Context* ctx);
+static void IN_L_off_C (Z180Context* ctx);
+static void INC_off_HL (Z180Context* ctx);
+static void INC_off_IX_d (Z180Context* ctx);
+static void INC_off_IY_d (Z180Context* ctx);
+static void INC_A (Z180Context* ctx);
+static void INC_B (Z180Context* ctx);
+static void INC_BC (Z180Context* ctx);
+static void INC_C (Z180Context* ctx);
+static void INC_D (Z180Context* ctx);
+static void INC_DE (Z180Context* ctx);
+static void INC_E (Z180Context* ctx);
+static void INC_H (Z180Context* ctx);
+static void INC_HL (Z180Context* ctx);
+static void INC_IX (Z180Context* ctx);
+static void INC_IY (Z180Context* ctx);
+static void INC_L (Z180Context* ctx);
+static void INC_SP (Z180Context* ctx);
+static void IND (Z180Context* ctx);
+static void INDR (Z180Context* ctx);
+static void INI (Z180Context* ctx);
+static void INIR (Z180Context* ctx);
+static void JP_off_HL (Z180Context* ctx);
+static void JP_off_IX (Z180Context* ctx);
+static void JP_off_IY (Z180Context* ctx);
+static void JP_off_nn (Z180Context* ctx);
+static void JP_C_off_nn (Z180Context* ctx);
+static void JP_M_off_nn (Z180Context* ctx);
+static void JP_NC_off_nn (Z180Context* ctx);
+static void JP_NZ_off_nn (Z180Context* ctx);
+static void JP_P_off_nn (Z180Context* ctx);
+static void JP_PE_off_nn (Z180Context* ctx);
+static void JP_PO_off_nn (Z180Context* ctx);
+static void JP_Z_off_nn (Z180Context* ctx);
+static void JR_off_PC_e (Z180Context* ctx);
+static void JR_C_off_PC_e (Z180Context* ctx);
+static void JR_NC_off_PC_e (Z180Context* ctx);
+static void JR_NZ_off_PC_e (Z180Context* ctx);
+static void JR_Z_off_PC_e (Z180Context* ctx);
+static void LD_off_BC_A (Z180Context* ctx);
+static void LD_off_DE_A (Z180Context* ctx);
+static void LD_off_HL_A (Z180Context* ctx);
+static void LD_off_HL_B (Z180Context* ctx);
+static void LD_off_HL_C (Z180Context* ctx);
+static void LD_off_HL_D (Z180Context* ctx);
+static void LD_off_HL_E (Z180Context* ctx);
+static void LD_off_HL_H (Z180Context* ctx);
+static void LD_off_HL_L (Z180Context* ctx);
+static void LD_off_HL_n (Z180Context* ctx);
+static void LD_off_IX_d_A (Z180Context* ctx);
+static void LD_off_IX_d_B (Z180Context* ctx);
+static void LD_off_IX_d_C (Z180Context* ctx);
+static void LD_off_IX_d_D (Z180Context* ctx);
+static void LD_off_IX_d_E (Z180Context* ctx);
+static void LD_off_IX_d_H (Z180Context* ctx);
+static void LD_off_IX_d_L (Z180Context* ctx);
+static void LD_off_IX_d_n (Z180Context* ctx);
+static void LD_off_IY_d_A (Z180Context* ctx);
+static void LD_off_IY_d_B (Z180Context* ctx);
+static void LD_off_IY_d_C (Z180Context* ctx);
+static void LD_off_IY_d_D (Z180Context* ctx);
+static void LD_off_IY_d_E (Z180Context* ctx);
+static void LD_off_IY_d_H (Z180Context* ctx);
+static void LD_off_IY_d_L (Z180Context* ctx);
+static void LD_off_IY_d_n (Z180Context* ctx);
+static void LD_off_nn_A (Z180Context* ctx);
+static void LD_off_nn_BC (Z180Context* ctx);
+static void LD_off_nn_DE (Z180Context* ctx);
+static void LD_off_nn_HL (Z180Context* ctx);
+static void LD_off_nn_IX (Z180Context* ctx);
+static void LD_off_nn_IY (Z180Context* ctx);
+static void LD_off_nn_SP (Z180Context* ctx);
+static void LD_A_off_BC (Z180Context* ctx);
+static void LD_A_off_DE (Z180Context* ctx);
+static void LD_A_off_HL (Z180Context* ctx);
+static void LD_A_off_IX_d (Z180Context* ctx);
+static void LD_A_off_IY_d (Z180Context* ctx);
+static void LD_A_off_nn (Z180Context* ctx);
+static void LD_A_A (Z180Context* ctx);
+static void LD_A_B (Z180Context* ctx);
+static void LD_A_C (Z180Context* ctx);
+static void LD_A_D (Z180Context* ctx);
+static void LD_A_E (Z180Context* ctx);
+static void LD_A_H (Z180Context* ctx);
+static void LD_A_I (Z180Context* ctx);
+static void LD_A_L (Z180Context* ctx);
+static void LD_A_n (Z180Context* ctx);
+static void LD_A_R (Z180Context* ctx);
+static void LD_B_off_HL (Z180Context* ctx);
+static void LD_B_off_IX_d (Z180Context* ctx);
+static void LD_B_off_IY_d (Z180Context* ctx);
+static void LD_B_A (Z180Context* ctx);
+static void LD_B_B (Z180Context* ctx);
+static void LD_B_C (Z180Context* ctx);
+static void LD_B_D (Z180Context* ctx);
+static void LD_B_E (Z180Context* ctx);
+static void LD_B_H (Z180Context* ctx);
+static void LD_B_L (Z180Context* ctx);
+static void LD_B_n (Z180Context* ctx);
+static void LD_BC_off_nn (Z180Context* ctx);
+static void LD_BC_nn (Z180Context* ctx);
+static void LD_C_off_HL (Z180Context* ctx);
+static void LD_C_off_IX_d (Z180Context* ctx);
+static void LD_C_off_IY_d (Z180Context* ctx);
+static void LD_C_A (Z180Context* ctx);
+static void LD_C_B (Z180Context* ctx);
+static void LD_C_C (Z180Context* ctx);
+static void LD_C_D (Z180Context* ctx);
+static void LD_C_E (Z180Context* ctx);
+static void LD_C_H (Z180Context* ctx);
+static void LD_C_L (Z180Context* ctx);
+static void LD_C_n (Z180Context* ctx);
+static void LD_D_off_HL (Z180Context* ctx);
+static void LD_D_off_IX_d (Z180Context* ctx);
+static void LD_D_off_IY_d (Z180Context* ctx);
+static void LD_D_A (Z180Context* ctx);
+static void LD_D_B (Z180Context* ctx);
+static void LD_D_C (Z180Context* ctx);
+static void LD_D_D (Z180Context* ctx);
+static void LD_D_E (Z180Context* ctx);
+static void LD_D_H (Z180Context* ctx);
+static void LD_D_L (Z180Context* ctx);
+static void LD_D_n (Z180Context* ctx);
+static void LD_DE_off_nn (Z180Context* ctx);
+static void LD_DE_nn (Z180Context* ctx);
+static void LD_E_off_HL (Z180Context* ctx);
+static void LD_E_off_IX_d (Z180Context* ctx);
+static void LD_E_off_IY_d (Z180Context* ctx);
+static void LD_E_A (Z180Context* ctx);
+static void LD_E_B (Z180Context* ctx);
+static void LD_E_C (Z180Context* ctx);
+static void LD_E_D (Z180Context* ctx);
+static void LD_E_E (Z180Context* ctx);
+static void LD_E_H (Z180Context* ctx);
+static void LD_E_L (Z180Context* ctx);
+static void LD_E_n (Z180Context* ctx);
+static void LD_H_off_HL (Z180Context* ctx);
+static void LD_H_off_IX_d (Z180Context* ctx);
+static void LD_H_off_IY_d (Z180Context* ctx);
+static void LD_H_A (Z180Context* ctx);
+static void LD_H_B (Z180Context* ctx);
+static void LD_H_C (Z180Context* ctx);
+static void LD_H_D (Z180Context* ctx);
+static void LD_H_E (Z180Context* ctx);
+static void LD_H_H (Z180Context* ctx);
+static void LD_H_L (Z180Context* ctx);
+static void LD_H_n (Z180Context* ctx);
+static void LD_HL_off_nn (Z180Context* ctx);
+static void LD_HL_nn (Z180Context* ctx);
+static void LD_I_A (Z180Context* ctx);
+static void LD_IX_off_nn (Z180Context* ctx);
+static void LD_IX_nn (Z180Context* ctx);
+static void LD_IY_off_nn (Z180Context* ctx);
+static void LD_IY_nn (Z180Context* ctx);
+static void LD_L_off_HL (Z180Context* ctx);
+static void LD_L_off_IX_d (Z180Context* ctx);
+static void LD_L_off_IY_d (Z180Context* ctx);
+static void LD_L_A (Z180Context* ctx);
+static void LD_L_B (Z180Context* ctx);
+static void LD_L_C (Z180Context* ctx);
+static void LD_L_D (Z180Context* ctx);
+static void LD_L_E (Z180Context* ctx);
+static void LD_L_H (Z180Context* ctx);
+static void LD_L_L (Z180Context* ctx);
+static void LD_L_n (Z180Context* ctx);
+static void LD_R_A (Z180Context* ctx);
+static void LD_SP_off_nn (Z180Context* ctx);
+static void LD_SP_HL (Z180Context* ctx);
+static void LD_SP_IX (Z180Context* ctx);
+static void LD_SP_IY (Z180Context* ctx);
+static void LD_SP_nn (Z180Context* ctx);
+static void LDD (Z180Context* ctx);
+static void LDDR (Z180Context* ctx);
+static void LDI (Z180Context* ctx);
+static void LDIR (Z180Context* ctx);
+static void NEG (Z180Context* ctx);
+static void NOP (Z180Context* ctx);
+static void OR_off_HL (Z180Context* ctx);
+static void OR_off_IX_d (Z180Context* ctx);
+static void OR_off_IY_d (Z180Context* ctx);
+static void OR_A (Z180Context* ctx);
+static void OR_B (Z180Context* ctx);
+static void OR_C (Z180Context* ctx);
+static void OR_D (Z180Context* ctx);
+static void OR_E (Z180Context* ctx);
+static void OR_H (Z180Context* ctx);
+static void OR_L (Z180Context* ctx);
+static void OR_n (Z180Context* ctx);
+static void OTDR (Z180Context* ctx);
+static void OTIR (Z180Context* ctx);
+static void OUT_off_C_A (Z180Context* ctx);
+static void OUT_off_C_B (Z180Context* ctx);
+static void OUT_off_C_C (Z180Context* ctx);
+static void OUT_off_C_D (Z180Context* ctx);
+static void OUT_off_C_E (Z180Context* ctx);
+static void OUT_off_C_H (Z180Context* ctx);
+static void OUT_off_C_L (Z180Context* ctx);
+static void OUT_off_n_A (Z180Context* ctx);
+static void OUTD (Z180Context* ctx);
+static void OUTI (Z180Context* ctx);
+static void POP_AF (Z180Context* ctx);
+static void POP_BC (Z180Context* ctx);
+static void POP_DE (Z180Context* ctx);
+static void POP_HL (Z180Context* ctx);
+static void POP_IX (Z180Context* ctx);
+static void POP_IY (Z180Context* ctx);
+static void PUSH_AF (Z180Context* ctx);
+static void PUSH_BC (Z180Context* ctx);
+static void PUSH_DE (Z180Context* ctx);
+static void PUSH_HL (Z180Context* ctx);
+static void PUSH_IX (Z180Context* ctx);
+static void PUSH_IY (Z180Context* ctx);
+static void RES_0_off_HL (Z180Context* ctx);
+static void RES_0_off_IX_d (Z180Context* ctx);
+static void RES_0_off_IY_d (Z180Context* ctx);
+static void RES_0_A (Z180Context* ctx);
+static void RES_0_B (Z180Context* ctx);
+static void RES_0_C (Z180Context* ctx);
+static void RES_0_D (Z180Context* ctx);
+static void RES_0_E (Z180Context* ctx);
+static void RES_0_H (Z180Context* ctx);
+static void RES_0_L (Z180Context* ctx);
+static void RES_1_off_HL (Z180Context* ctx);
+static void RES_1_off_IX_d (Z180Context* ctx);
+static void RES_1_off_IY_d (Z180Context* ctx);
+static void RES_1_A (Z180Context* ctx);
+static void RES_1_B (Z180Context* ctx);
+static void RES_1_C (Z180Context* ctx);
+static void RES_1_D (Z180Context* ctx);
+static void RES_1_E (Z180Context* ctx);
+static void RES_1_H (Z180Context* ctx);
+static void RES_1_L (Z180Context* ctx);
+static void RES_2_off_HL (Z180Context* ctx);
+static void RES_2_off_IX_d (Z180Context* ctx);
+static void RES_2_off_IY_d (Z180Context* ctx);
+static void RES_2_A (Z180Context* ctx);
+static void RES_2_B (Z180Context* ctx);
+static void RES_2_C (Z180Context* ctx);
+static void RES_2_D (Z180Context* ctx);
+static void RES_2_E (Z180Context* ctx);
+static void RES_2_H (Z180Context* ctx);
+static void RES_2_L (Z180Context* ctx);
+static void RES_3_off_HL (Z180Context* ctx);
+static void RES_3_off_IX_d (Z180Context* ctx);
+static void RES_3_off_IY_d (Z180Context* ctx);
+static void RES_3_A (Z180Context* ctx);
+static void RES_3_B (Z180Context* ctx);
+static void RES_3_C (Z180Context* ctx);
+static void RES_3_D (Z180Context* ctx);
+static void RES_3_E (Z180Context* ctx);
+static void RES_3_H (Z180Context* ctx);
+static void RES_3_L (Z180Context* ctx);
+static void RES_4_off_HL (Z180Context* ctx);
+static void RES_4_off_IX_d (Z180Context* ctx);
+static void RES_4_off_IY_d (Z180Context* ctx);
+static void RES_4_A (Z180Context* ctx);
+static void RES_4_B (Z180Context* ctx);
+static void RES_4_C (Z180Context* ctx);
+static void RES_4_D (Z180Context* ctx);
+static void RES_4_E (Z180Context* ctx);
+static void RES_4_H (Z180Context* ctx);
+static void RES_4_L (Z180Context* ctx);
+static void RES_5_off_HL (Z180Context* ctx);
+static void RES_5_off_IX_d (Z180Context* ctx);
+static void RES_5_off_IY_d (Z180Context* ctx);
+static void RES_5_A (Z180Context* ctx);
+static void RES_5_B (Z180Context* ctx);
+static void RES_5_C (Z180Context* ctx);
+static void RES_5_D (Z180Context* ctx);
+static void RES_5_E (Z180Context* ctx);
+static void RES_5_H (Z180Context* ctx);
+static void RES_5_L (Z180Context* ctx);
+static void RES_6_off_HL (Z180Context* ctx);
+static void RES_6_off_IX_d (Z180Context* ctx);
+static void RES_6_off_IY_d (Z180Context* ctx);
+static void RES_6_A (Z180Context* ctx);
+static void RES_6_B (Z180Context* ctx);
+static void RES_6_C (Z180Context* ctx);
+static void RES_6_D (Z180Context* ctx);
+static void RES_6_E (Z180Context* ctx);
+static void RES_6_H (Z180Context* ctx);
+static void RES_6_L (Z180Context* ctx);
+static void RES_7_off_HL (Z180Context* ctx);
+static void RES_7_off_IX_d (Z180Context* ctx);
+static void RES_7_off_IY_d (Z180Context* ctx);
+static void RES_7_A (Z180Context* ctx);
+static void RES_7_B (Z180Context* ctx);
+static void RES_7_C (Z180Context* ctx);
+static void RES_7_D (Z180Context* ctx);
+static void RES_7_E (Z180Context* ctx);
+static void RES_7_H (Z180Context* ctx);
+static void RES_7_L (Z180Context* ctx);
+static void RET (Z180Context* ctx);
+static void RET_C (Z180Context* ctx);
+static void RET_M (Z180Context* ctx);
+static void RET_NC (Z180Context* ctx);
+static void RET_NZ (Z180Context* ctx);
+static void RET_P (Z180Context* ctx);
+static void RET_PE (Z180Context* ctx);
+static void RET_PO (Z180Context* ctx);
+static void RET_Z (Z180Context* ctx);
+static void RETI (Z180Context* ctx);
+static void RETN (Z180Context* ctx);
+static void RL_off_HL (Z180Context* ctx);
+static void RL_off_IX_d (Z180Context* ctx);
+static void RL_off_IY_d (Z180Context* ctx);
+static void RL_A (Z180Context* ctx);
+static void RL_B (Z180Context* ctx);
+static void RL_C (Z180Context* ctx);
+static void RL_D (Z180Context* ctx);
+static void RL_E (Z180Context* ctx);
+static void RL_H (Z180Context* ctx);
+static void RL_L (Z180Context* ctx);
+static void RLA (Z180Context* ctx);
+static void RLC_off_HL (Z180Context* ctx);
+static void RLC_off_IX_d (Z180Context* ctx);
+static void RLC_off_IY_d (Z180Context* ctx);
+static void RLC_A (Z180Context* ctx);
+static void RLC_B (Z180Context* ctx);
+static void RLC_C (Z180Context* ctx);
+static void RLC_D (Z180Context* ctx);
+static void RLC_E (Z180Context* ctx);
+static void RLC_H (Z180Context* ctx);
+static void RLC_L (Z180Context* ctx);
+static void RLCA (Z180Context* ctx);
+static void RLD (Z180Context* ctx);
+static void RR_off_HL (Z180Context* ctx);
+static void RR_off_IX_d (Z180Context* ctx);
+static void RR_off_IY_d (Z180Context* ctx);
+static void RR_A (Z180Context* ctx);
+static void RR_B (Z180Context* ctx);
+static void RR_C (Z180Context* ctx);
+static void RR_D (Z180Context* ctx);
+static void RR_E (Z180Context* ctx);
+static void RR_H (Z180Context* ctx);
+static void RR_L (Z180Context* ctx);
+static void RRA (Z180Context* ctx);
+static void RRC_off_HL (Z180Context* ctx);
+static void RRC_off_IX_d (Z180Context* ctx);
+static void RRC_off_IY_d (Z180Context* ctx);
+static void RRC_A (Z180Context* ctx);
+static void RRC_B (Z180Context* ctx);
+static void RRC_C (Z180Context* ctx);
+static void RRC_D (Z180Context* ctx);
+static void RRC_E (Z180Context* ctx);
+static void RRC_H (Z180Context* ctx);
+static void RRC_L (Z180Context* ctx);
+static void RRCA (Z180Context* ctx);
+static void RRD (Z180Context* ctx);
+static void RST_0H (Z180Context* ctx);
+static void RST_10H (Z180Context* ctx);
+static void RST_18H (Z180Context* ctx);
+static void RST_20H (Z180Context* ctx);
+static void RST_28H (Z180Context* ctx);
+static void RST_30H (Z180Context* ctx);
+static void RST_38H (Z180Context* ctx);
+static void RST_8H (Z180Context* ctx);
+static void SBC_A_off_HL (Z180Context* ctx);
+static void SBC_A_off_IX_d (Z180Context* ctx);
+static void SBC_A_off_IY_d (Z180Context* ctx);
+static void SBC_A_A (Z180Context* ctx);
+static void SBC_A_B (Z180Context* ctx);
+static void SBC_A_C (Z180Context* ctx);
+static void SBC_A_D (Z180Context* ctx);
+static void SBC_A_E (Z180Context* ctx);
+static void SBC_A_H (Z180Context* ctx);
+static void SBC_A_L (Z180Context* ctx);
+static void SBC_A_n (Z180Context* ctx);
+static void SBC_HL_BC (Z180Context* ctx);
+static void SBC_HL_DE (Z180Context* ctx);
+static void SBC_HL_HL (Z180Context* ctx);
+static void SBC_HL_SP (Z180Context* ctx);
+static void SCF (Z180Context* ctx);
+static void SET_0_off_HL (Z180Context* ctx);
+static void SET_0_off_IX_d (Z180Context* ctx);
+static void SET_0_off_IY_d (Z180Context* ctx);
+static void SET_0_A (Z180Context* ctx);
+static void SET_0_B (Z180Context* ctx);
+static void SET_0_C (Z180Context* ctx);
+static void SET_0_D (Z180Context* ctx);
+static void SET_0_E (Z180Context* ctx);
+static void SET_0_H (Z180Context* ctx);
+static void SET_0_L (Z180Context* ctx);
+static void SET_1_off_HL (Z180Context* ctx);
+static void SET_1_off_IX_d (Z180Context* ctx);
+static void SET_1_off_IY_d (Z180Context* ctx);
+static void SET_1_A (Z180Context* ctx);
+static void SET_1_B (Z180Context* ctx);
+static void SET_1_C (Z180Context* ctx);
+static void SET_1_D (Z180Context* ctx);
+static void SET_1_E (Z180Context* ctx);
+static void SET_1_H (Z180Context* ctx);
+static void SET_1_L (Z180Context* ctx);
+static void SET_2_off_HL (Z180Context* ctx);
+static void SET_2_off_IX_d (Z180Context* ctx);
+static void SET_2_off_IY_d (Z180Context* ctx);
+static void SET_2_A (Z180Context* ctx);
+static void SET_2_B (Z180Context* ctx);
+static void SET_2_C (Z180Context* ctx);
+static void SET_2_D (Z180Context* ctx);
+static void SET_2_E (Z180Context* ctx);
+static void SET_2_H (Z180Context* ctx);
+static void SET_2_L (Z180Context* ctx);
+static void SET_3_off_HL (Z180Context* ctx);
+static void SET_3_off_IX_d (Z180Context* ctx);
+static void SET_3_off_IY_d (Z180Context* ctx);
+static void SET_3_A (Z180Context* ctx);
+static void SET_3_B (Z180Context* ctx);
+static void SET_3_C (Z180Context* ctx);
+static void SET_3_D (Z180Context* ctx);
+static void SET_3_E (Z180Context* ctx);
+static void SET_3_H (Z180Context* ctx);
+static void SET_3_L (Z180Context* ctx);
+static void SET_4_off_HL (Z180Context* ctx);
+static void SET_4_off_IX_d (Z180Context* ctx);
+static void SET_4_off_IY_d (Z180Context* ctx);
+static void SET_4_A (Z180Context* ctx);
+static void SET_4_B (Z180Context* ctx);
+static void SET_4_C (Z180Context* ctx);
+static void SET_4_D (Z180Context* ctx);
+static void SET_4_E (Z180Context* ctx);
+static void SET_4_H (Z180Context* ctx);
+static void SET_4_L (Z180Context* ctx);
+static void SET_5_off_HL (Z180Context* ctx);
+static void SET_5_off_IX_d (Z180Context* ctx);
+static void SET_5_off_IY_d (Z180Context* ctx);
+static void SET_5_A (Z180Context* ctx);
+static void SET_5_B (Z180Context* ctx);
+static void SET_5_C (Z180Context* ctx);
+static void SET_5_D (Z180Context* ctx);
+static void SET_5_E (Z180Context* ctx);
+static void SET_5_H (Z180Context* ctx);
+static void SET_5_L (Z180Context* ctx);
+static void SET_6_off_HL (Z180Context* ctx);
+static void SET_6_off_IX_d (Z180Context* ctx);
+static void SET_6_off_IY_d (Z180Context* ctx);
+static void SET_6_A (Z180Context* ctx);
+static void SET_6_B (Z180Context* ctx);
+static void SET_6_C (Z180Context* ctx);
+static void SET_6_D (Z180Context* ctx);
+static void SET_6_E (Z180Context* ctx);
+static void SET_6_H (Z180Context* ctx);
+static void SET_6_L (Z180Context* ctx);
+static void SET_7_off_HL (Z180Context* ctx);
+static void SET_7_off_IX_d (Z180Context* ctx);
+static void SET_7_off_IY_d (Z180Context* ctx);
+static void SET_7_A (Z180Context* ctx);
+static void SET_7_B (Z180Context* ctx);
+static void SET_7_C (Z180Context* ctx);
+static void SET_7_D (Z180Context* ctx);
+static void SET_7_E (Z180Context* ctx);
+static void SET_7_H (Z180Context* ctx);
+static void SET_7_L (Z180Context* ctx);
+static void SLA_off_HL (Z180Context* ctx);
+static void SLA_off_IX_d (Z180Context* ctx);
+static void SLA_off_IY_d (Z180Context* ctx);
+static void SLA_A (Z180Context* ctx);
+static void SLA_B (Z180Context* ctx);
+static void SLA_C (Z180Context* ctx);
+static void SLA_D (Z180Context* ctx);
+static void SLA_E (Z180Context* ctx);
+static void SLA_H (Z180Context* ctx);
+static void SLA_L (Z180Context* ctx);
+static void SLL_off_HL (Z180Context* ctx);
+static void SLL_off_IX_d (Z180Context* ctx);
+static void SLL_off_IY_d (Z180Context* ctx);
+static void SLL_A (Z180Context* ctx);
+static void SLL_B (Z180Context* ctx);
+static void SLL_C (Z180Context* ctx);
+static void SLL_D (Z180Context* ctx);
+static void SLL_E (Z180Context* ctx);
+static void SLL_H (Z180Context* ctx);
+static void SLL_L (Z180Context* ctx);
+static void SRA_off_HL (Z180Context* ctx);
+static void SRA_off_IX_d (Z180Context* ctx);
+static void SRA_off_IY_d (Z180Context* ctx);
+static void SRA_A (Z180Context* ctx);
+static void SRA_B (Z180Context* ctx);
+static void SRA_C (Z180Context* ctx);
+static void SRA_D (Z180Context* ctx);
+static void SRA_E (Z180Context* ctx);
+static void SRA_H (Z180Context* ctx);
+static void SRA_L (Z180Context* ctx);
+static void SRL_off_HL (Z180Context* ctx);
+static void SRL_off_IX_d (Z180Context* ctx);
+static void SRL_off_IY_d (Z180Context* ctx);
+static void SRL_A (Z180Context* ctx);
+static void SRL_B (Z180Context* ctx);
+static void SRL_C (Z180Context* ctx);
+static void SRL_D (Z180Context* ctx);
+static void SRL_E (Z180Context* ctx);
+static void SRL_H (Z180Context* ctx);
+static void SRL_L (Z180Context* ctx);
+static void SUB_A_off_HL (Z180Context* ctx);
+static void SUB_A_off_IX_d (Z180Context* ctx);
+static void SUB_A_off_IY_d (Z180Context* ctx);
+static void SUB_A_A (Z180Context* ctx);
+static void SUB_A_B (Z180Context* ctx);
+static void SUB_A_C (Z180Context* ctx);
+static void SUB_A_D (Z180Context* ctx);
+static void SUB_A_E (Z180Context* ctx);
+static void SUB_A_H (Z180Context* ctx);
+static void SUB_A_L (Z180Context* ctx);
+static void SUB_A_n (Z180Context* ctx);
+static void XOR_off_HL (Z180Context* ctx);
+static void XOR_off_IX_d (Z180Context* ctx);
+static void XOR_off_IY_d (Z180Context* ctx);
+static void XOR_A (Z180Context* ctx);
+static void XOR_B (Z180Context* ctx);
+static void XOR_C (Z180Context* ctx);
+static void XOR_D (Z180Context* ctx);
+static void XOR_E (Z180Context* ctx);
+static void XOR_H (Z180Context* ctx);
+static void XOR_L (Z180Context* ctx);
+static void XOR_n (Z180Context* ctx);
+static void IN0_B_off_n (Z180Context* ctx);
+static void IN0_C_off_n (Z180Context* ctx);
+static void IN0_D_off_n (Z180Context* ctx);
+static void IN0_E_off_n (Z180Context* ctx);
+static void IN0_H_off_n (Z180Context* ctx);
+static void IN0_L_off_n (Z180Context* ctx);
+static void IN0_F_off_n (Z180Context* ctx);
+static void IN0_A_off_n (Z180Context* ctx);
+static void MLT_BC (Z180Context* ctx);
+static void MLT_DE (Z180Context* ctx);
+static void MLT_HL (Z180Context* ctx);
+static void MLT_SP (Z180Context* ctx);
+static void OTDM (Z180Context* ctx);
+static void OTDMR (Z180Context* ctx);
+static void OTIM (Z180Context* ctx);
+static void OTIMR (Z180Context* ctx);
+static void OUT0_off_n_B (Z180Context* ctx);
+static void OUT0_off_n_C (Z180Context* ctx);
+static void OUT0_off_n_D (Z180Context* ctx);
+static void OUT0_off_n_E (Z180Context* ctx);
+static void OUT0_off_n_H (Z180Context* ctx);
+static void OUT0_off_n_L (Z180Context* ctx);
+static void OUT0_off_n_0 (Z180Context* ctx);
+static void OUT0_off_n_A (Z180Context* ctx);
+static void SLP (Z180Context* ctx);
+static void TST_B (Z180Context* ctx);
+static void TST_C (Z180Context* ctx);
+static void TST_D (Z180Context* ctx);
+static void TST_E (Z180Context* ctx);
+static void TST_H (Z180Context* ctx);
+static void TST_L (Z180Context* ctx);
+static void TST_off_HL (Z180Context* ctx);
+static void TST_A (Z180Context* ctx);
+static void TST_n (Z180Context* ctx);
+static void TSTIO_off_C_n (Z180Context* ctx);
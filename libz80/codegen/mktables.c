@@ -24,6 +24,7 @@
 #define MAX_REGEX	1000		/**< Max patterns. */
 #define MAX_LINES	20			/**< Max code lines per pattern. */
 #define MAX_MATCH	5			/**< Max parameters per matching opcode. */
+#define MAX_BODIES	2000		/**< Max opcode implementations. */
 #define MAX_LINE	100			/**< Max line length */
 #define OPCODE_OFFSET	11		/**< Offset of an opcode from the list, from the start of the line */
 
@@ -32,6 +33,7 @@
 #define OPCODES_HEADER	"opcodes_decl.h"
 #define OPCODES_IMPL	"opcodes_impl.c"
 #define OPCODES_TABLE	"opcodes_table.h"
+#define OPCODES_SWITCH	"opcodes_switch.c"
 
 
 /* =========================================================
@@ -142,6 +144,19 @@ Item*	items;		/**< The patterns. */
 int		nItems;		/**< Number of defined patterns. */
 
 
+/** An opcode implementation, kept so it can be emitted more than once. */
+typedef struct
+{
+	char*	name;
+	char*	line;
+	Item*	item;
+	regmatch_t	matches[MAX_MATCH];
+} Body;
+
+Body*	bodies;		/**< The generated opcode implementations. */
+int		nBodies;	/**< Number of generated implementations. */
+
+
 /** Reads the specification file. */
 int readSpec (FILE* in)
 {
@@ -229,21 +244,70 @@ int printCall (char* s, FILE* code)
 }
 
 
+/** Prints the code of an opcode implementation, each line prefixed by indent */
+void printBody (Body* body, FILE* code, char* indent)
+{
+	char tmp[MAX_LINE];
+	char parm[5], subst[20];
+	char** cmds;
+	regmatch_t* matches = body->matches;
+	int i;
+
+	/* Substitute submatches in each output line and print the code */
+	cmds = body->item->line;
+	strcpy(parm, "%0");
+	while (*cmds)
+	{
+		fprintf(code, "%s", indent);
+		if (!printCall(*cmds, code))
+		{
+			strncpy(tmp, *cmds, MAX_LINE);
+
+			for (i = 1; i < MAX_MATCH; i++)
+			{
+				parm[1] = i + '0';
+				strncpy(subst, &body->line[matches[i].rm_so], matches[i].rm_eo - matches[i].rm_so);
+				subst[matches[i].rm_eo - matches[i].rm_so] = 0;
+
+				substStr(tmp, parm, subst);
+			}
+			fprintf(code, "%s\n", tmp);
+		}
+
+		cmds++;
+	}
+}
+
+
+/** Finds the implementation generated for a function name */
+Body* findBody (char* name)
+{
+	int i;
+
+	for (i = 0; i < nBodies; i++)
+		if (strcmp(bodies[i].name, name) == 0)
+			return &bodies[i];
+
+	fatal2("No implementation for ", name);
+	return NULL;
+}
+
+
 /** Reads the opcode list and generates output code based on the spec */
 void generateCodeTable (FILE* opcodes, FILE* code)
 {
 	char line[MAX_LINE];
 	char last[MAX_LINE];
-	char tmp[MAX_LINE];
 	char name[MAX_LINE];
-	char parm[5], subst[20];
 	int i;
 	char* p, *q;
-	char** cmds;
 	regmatch_t matches[MAX_MATCH];
-	Item* item;
+	Body* body;
 
 	printf("Generating opcode implementations...");
+	bodies = calloc(MAX_BODIES, sizeof(Body));
+	if (!bodies)
+		fatal("Not enough memory");
 	last[0] = 0;
 	do
 	{			
@@ -276,37 +340,21 @@ void generateCodeTable (FILE* opcodes, FILE* code)
 		
 		if (i >= nItems)
 			fatal2(line, " didn't match anything");
-			
-		item = &items[i];
-		
-		/* Print function stub */
+
+		if (nBodies >= MAX_BODIES)
+			fatal("Too many opcode implementations");
+
+		/* Remember the implementation for the switch interpreter */
 		fixName(line, name);
+		body = &bodies[nBodies++];
+		body->name = strdup(name);
+		body->line = strdup(line);
+		body->item = &items[i];
+		memcpy(body->matches, matches, sizeof(matches));
+
+		/* Print function stub */
 		fprintf(code, "static void %s (Z80Context* ctx)\n{\n", name);
-				
-		/* Substitute submatches in each output line and print the code */
-		cmds = item->line;
-		strcpy(parm, "%0");
-		while (*cmds)
-		{
-			if (!printCall(*cmds, code))
-			{
-				strncpy(tmp, *cmds, MAX_LINE);
-				q = tmp;
-		
-				for (i = 1; i < MAX_MATCH; i++)
-				{
-					parm[1] = i + '0';
-					strncpy(subst, &line[matches[i].rm_so], matches[i].rm_eo - matches[i].rm_so);
-					subst[matches[i].rm_eo - matches[i].rm_so] = 0;
-					
-					substStr(tmp, parm, subst);
-				}
-				fprintf(code, "%s\n", tmp);
-			}
-			
-			cmds++;	
-		}
-		
+		printBody(body, code, "");
 		fprintf(code, "}\n\n\n");
 	} while(1);
 	printf("done\n");
@@ -661,26 +709,111 @@ void outputTable(struct Z80OpcodeTable* table, FILE* file)
 }
 	
 
-void generateParserTables(FILE* opcodes, FILE* table)
+struct Z80OpcodeTable* generateParserTables(FILE* opcodes, FILE* table)
 {
 	struct Z80OpcodeTable* mainTable = createTableTree(opcodes, table);
 	scanOpcodes(opcodes, mainTable);
 	fprintf(table, "\n\n");
 	outputTable(mainTable, table);
+	return mainTable;
+}
+
+
+/* =========================================================
+ *  Switch interpreter generator
+ * ========================================================= */
+
+/** Outputs the decoding of one table as a switch, with the opcode bodies inlined */
+void outputSwitch(struct Z80OpcodeTable* table, FILE* file)
+{
+	int i, j;
+	int offset = table->opcode_offset;
+	struct Z80OpcodeEntry* opc;
+	struct Z80OpcodeTable* tbl;
+	char done[256];
+
+	printf("Outputting switch %s...", table->name);
+
+	if (table->name[0] != 0 && strcmp(table->name, "main"))
+		fprintf(file, "table_%s:\n", table->name);
+	if (offset > 0)
+		fprintf(file, "\tDECR;\n");
+	fprintf(file, "\topcode = fetchOpcode(ctx, %d);\n", offset);
+	fprintf(file, "\tswitch (opcode)\n\t{\n");
+
+	memset(done, 0, sizeof(done));
+	for (i = 0, opc = table->entries; i < 256; i++, opc++)
+	{
+		if (done[i])
+			continue;
+		if (opc->table)
+		{
+			fprintf(file, "\tcase 0x%02X:\n\t\tgoto table_%s;\n", i, opc->table->name);
+			continue;
+		}
+		if (opc->func == NULL)
+			continue;
+
+		/* Opcodes sharing an implementation share a case */
+		for (j = i; j < 256; j++)
+		{
+			if (table->entries[j].table == NULL && table->entries[j].func &&
+				strcmp(table->entries[j].func, opc->func) == 0)
+			{
+				fprintf(file, "\tcase 0x%02X:\n", j);
+				done[j] = 1;
+			}
+		}
+		if (offset > 0)
+			fprintf(file, "\t\tctx->PC -= %d;\n", offset);
+		fprintf(file, "\t\tTRACE_OPCODE();\n");
+		fprintf(file, "\t\t{\n");
+		printBody(findBody(opc->func), file, "\t\t");
+		fprintf(file, "\t\t}\n");
+		if (offset > 0)
+			fprintf(file, "\t\tctx->PC += %d;\n", offset);
+		fprintf(file, "\t\treturn;\n");
+	}
+	/* Anything else is ignored as a NOP */
+	fprintf(file, "\t}\n\treturn;\n\n");
+
+	printf("done\n");
+
+	for (i = 0, opc = table->entries; i < 256; i++, opc++)
+	{
+		tbl = opc->table;
+		if (tbl)
+			outputSwitch(tbl, file);
+	}
+}
+
+
+void generateSwitch(struct Z80OpcodeTable* mainTable, FILE* file)
+{
+	fprintf(file, "static void do_execute_switch (Z80Context* ctx)\n{\n");
+	fprintf(file, "\tbyte opcode;\n\n");
+	fprintf(file, "\tctx->M1PC = ctx->PC;\n");
+	outputSwitch(mainTable, file);
+	fprintf(file, "}\n");
 }
 
 
 void generateParser(void)
 {
-	FILE* table, *opcodes;
+	FILE* table, *opcodes, *sw;
+	struct Z80OpcodeTable* mainTable;
 	
 	opcodes = openOrDie(OPCODES_LIST, "rb");
 	table = openOrDie(OPCODES_TABLE, "wb");
 	
-	generateParserTables(opcodes, table);
+	mainTable = generateParserTables(opcodes, table);
 	
 	fclose(table);
 	fclose(opcodes);
+
+	sw = openOrDie(OPCODES_SWITCH, "wb");
+	generateSwitch(mainTable, sw);
+	fclose(sw);
 }
 
 
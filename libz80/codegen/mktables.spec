@@ -105,6 +105,8 @@ JR (C|NZ|NC|Z)?,?\(PC\+e\)
 	}
 
 RETI
+	if (ctx->on_reti)
+		ctx->on_reti(ctx->ioParam);
 	ctx->IFF1 = ctx->IFF2;
 	%RET		
 		
@@ -0,0 +1,9819 @@
+static void do_execute_switch (Z80Context* ctx)
+{
+	byte opcode;
+
+	ctx->M1PC = ctx->PC;
+	opcode = fetchOpcode(ctx, 0);
+	switch (opcode)
+	{
+	case 0x00:
+		TRACE_OPCODE();
+		{
+			/* NOP */
+			
+		}
+		return;
+	case 0x01:
+		TRACE_OPCODE();
+		{
+			WR.BC = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x02:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.BC, BR.A);
+		}
+		return;
+	case 0x03:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.BC++;
+		}
+		return;
+	case 0x04:
+		TRACE_OPCODE();
+		{
+			BR.B = doIncDec(ctx, BR.B, ID_INC);
+		}
+		return;
+	case 0x05:
+		TRACE_OPCODE();
+		{
+			BR.B = doIncDec(ctx, BR.B, ID_DEC);
+		}
+		return;
+	case 0x06:
+		TRACE_OPCODE();
+		{
+			BR.B = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x07:
+		TRACE_OPCODE();
+		{
+			BR.A = doRLC(ctx, 0, BR.A);
+			
+			
+		}
+		return;
+	case 0x08:
+		TRACE_OPCODE();
+		{
+			ushort tmp = ctx->R1.wr.AF;
+			ctx->R1.wr.AF = ctx->R2.wr.AF;
+			ctx->R2.wr.AF = tmp;
+		}
+		return;
+	case 0x09:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.BC, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x0A:
+		TRACE_OPCODE();
+		{
+			BR.A = read8(ctx, WR.BC);
+		}
+		return;
+	case 0x0B:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.BC--;
+		}
+		return;
+	case 0x0C:
+		TRACE_OPCODE();
+		{
+			BR.C = doIncDec(ctx, BR.C, ID_INC);
+		}
+		return;
+	case 0x0D:
+		TRACE_OPCODE();
+		{
+			BR.C = doIncDec(ctx, BR.C, ID_DEC);
+		}
+		return;
+	case 0x0E:
+		TRACE_OPCODE();
+		{
+			BR.C = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x0F:
+		TRACE_OPCODE();
+		{
+			BR.A = doRRC(ctx, 0, BR.A);
+			
+			
+		}
+		return;
+	case 0x10:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B--;
+			if (BR.B)
+			{
+				ctx->tstates += 5;
+				ctx->PC += off;
+			}
+		}
+		return;
+	case 0x11:
+		TRACE_OPCODE();
+		{
+			WR.DE = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x12:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.DE, BR.A);
+		}
+		return;
+	case 0x13:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.DE++;
+		}
+		return;
+	case 0x14:
+		TRACE_OPCODE();
+		{
+			BR.D = doIncDec(ctx, BR.D, ID_INC);
+		}
+		return;
+	case 0x15:
+		TRACE_OPCODE();
+		{
+			BR.D = doIncDec(ctx, BR.D, ID_DEC);
+		}
+		return;
+	case 0x16:
+		TRACE_OPCODE();
+		{
+			BR.D = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x17:
+		TRACE_OPCODE();
+		{
+			BR.A = doRL(ctx, 0, BR.A);
+			
+			
+		}
+		return;
+	case 0x18:
+		TRACE_OPCODE();
+		{
+			int off = doComplement(read8(ctx, ctx->PC++));
+			if (condition(ctx, C_))
+			{
+				ctx->tstates += 5;
+				ctx->PC += off;
+			}
+		}
+		return;
+	case 0x19:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.DE, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x1A:
+		TRACE_OPCODE();
+		{
+			BR.A = read8(ctx, WR.DE);
+		}
+		return;
+	case 0x1B:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.DE--;
+		}
+		return;
+	case 0x1C:
+		TRACE_OPCODE();
+		{
+			BR.E = doIncDec(ctx, BR.E, ID_INC);
+		}
+		return;
+	case 0x1D:
+		TRACE_OPCODE();
+		{
+			BR.E = doIncDec(ctx, BR.E, ID_DEC);
+		}
+		return;
+	case 0x1E:
+		TRACE_OPCODE();
+		{
+			BR.E = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x1F:
+		TRACE_OPCODE();
+		{
+			BR.A = doRR(ctx, 0, BR.A);
+			
+			
+		}
+		return;
+	case 0x20:
+		TRACE_OPCODE();
+		{
+			int off = doComplement(read8(ctx, ctx->PC++));
+			if (condition(ctx, C_NZ))
+			{
+				ctx->tstates += 5;
+				ctx->PC += off;
+			}
+		}
+		return;
+	case 0x21:
+		TRACE_OPCODE();
+		{
+			WR.HL = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x22:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.HL);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x23:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.HL++;
+		}
+		return;
+	case 0x24:
+		TRACE_OPCODE();
+		{
+			BR.H = doIncDec(ctx, BR.H, ID_INC);
+		}
+		return;
+	case 0x25:
+		TRACE_OPCODE();
+		{
+			BR.H = doIncDec(ctx, BR.H, ID_DEC);
+		}
+		return;
+	case 0x26:
+		TRACE_OPCODE();
+		{
+			BR.H = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x27:
+		TRACE_OPCODE();
+		{
+			doDAA(ctx);
+			
+		}
+		return;
+	case 0x28:
+		TRACE_OPCODE();
+		{
+			int off = doComplement(read8(ctx, ctx->PC++));
+			if (condition(ctx, C_Z))
+			{
+				ctx->tstates += 5;
+				ctx->PC += off;
+			}
+		}
+		return;
+	case 0x29:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.HL, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x2A:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.HL = read16(ctx, addr);	
+		}
+		return;
+	case 0x2B:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.HL--;
+		}
+		return;
+	case 0x2C:
+		TRACE_OPCODE();
+		{
+			BR.L = doIncDec(ctx, BR.L, ID_INC);
+		}
+		return;
+	case 0x2D:
+		TRACE_OPCODE();
+		{
+			BR.L = doIncDec(ctx, BR.L, ID_DEC);
+		}
+		return;
+	case 0x2E:
+		TRACE_OPCODE();
+		{
+			BR.L = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x2F:
+		TRACE_OPCODE();
+		{
+			BR.A = ~BR.A;
+			SETFLAG(F_H | F_N);
+			adjustFlags(ctx, BR.A);
+			
+		}
+		return;
+	case 0x30:
+		TRACE_OPCODE();
+		{
+			int off = doComplement(read8(ctx, ctx->PC++));
+			if (condition(ctx, C_NC))
+			{
+				ctx->tstates += 5;
+				ctx->PC += off;
+			}
+		}
+		return;
+	case 0x31:
+		TRACE_OPCODE();
+		{
+			WR.SP = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x32:
+		TRACE_OPCODE();
+		{
+			write8(ctx, read16(ctx, ctx->PC), BR.A);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x33:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.SP++;
+		}
+		return;
+	case 0x34:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			byte value = read8(ctx, WR.HL);
+			write8(ctx, WR.HL, doIncDec(ctx, value, ID_INC));
+		}
+		return;
+	case 0x35:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			byte value = read8(ctx, WR.HL);
+			write8(ctx, WR.HL, doIncDec(ctx, value, ID_DEC));
+		}
+		return;
+	case 0x36:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, read8(ctx, ctx->PC++));
+			
+		}
+		return;
+	case 0x37:
+		TRACE_OPCODE();
+		{
+			SETFLAG(F_C);
+			RESFLAG(F_N | F_H);
+			adjustFlags(ctx, BR.A);
+		}
+		return;
+	case 0x38:
+		TRACE_OPCODE();
+		{
+			int off = doComplement(read8(ctx, ctx->PC++));
+			if (condition(ctx, C_C))
+			{
+				ctx->tstates += 5;
+				ctx->PC += off;
+			}
+		}
+		return;
+	case 0x39:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.SP, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x3A:
+		TRACE_OPCODE();
+		{
+			BR.A = read8(ctx, read16(ctx, ctx->PC));
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x3B:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.SP--;
+		}
+		return;
+	case 0x3C:
+		TRACE_OPCODE();
+		{
+			BR.A = doIncDec(ctx, BR.A, ID_INC);
+		}
+		return;
+	case 0x3D:
+		TRACE_OPCODE();
+		{
+			BR.A = doIncDec(ctx, BR.A, ID_DEC);
+		}
+		return;
+	case 0x3E:
+		TRACE_OPCODE();
+		{
+			BR.A = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x3F:
+		TRACE_OPCODE();
+		{
+			VALFLAG(F_C, (1 - (byte)GETFLAG(F_C) != 0));
+			RESFLAG(F_N);
+			adjustFlags(ctx, BR.A);
+		}
+		return;
+	case 0x40:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.B;
+		}
+		return;
+	case 0x41:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.C;
+		}
+		return;
+	case 0x42:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.D;
+		}
+		return;
+	case 0x43:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.E;
+		}
+		return;
+	case 0x44:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.H;
+		}
+		return;
+	case 0x45:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.L;
+		}
+		return;
+	case 0x46:
+		TRACE_OPCODE();
+		{
+			BR.B = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x47:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.A;
+		}
+		return;
+	case 0x48:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.B;
+		}
+		return;
+	case 0x49:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.C;
+		}
+		return;
+	case 0x4A:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.D;
+		}
+		return;
+	case 0x4B:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.E;
+		}
+		return;
+	case 0x4C:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.H;
+		}
+		return;
+	case 0x4D:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.L;
+		}
+		return;
+	case 0x4E:
+		TRACE_OPCODE();
+		{
+			BR.C = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x4F:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.A;
+		}
+		return;
+	case 0x50:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.B;
+		}
+		return;
+	case 0x51:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.C;
+		}
+		return;
+	case 0x52:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.D;
+		}
+		return;
+	case 0x53:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.E;
+		}
+		return;
+	case 0x54:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.H;
+		}
+		return;
+	case 0x55:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.L;
+		}
+		return;
+	case 0x56:
+		TRACE_OPCODE();
+		{
+			BR.D = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x57:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.A;
+		}
+		return;
+	case 0x58:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.B;
+		}
+		return;
+	case 0x59:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.C;
+		}
+		return;
+	case 0x5A:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.D;
+		}
+		return;
+	case 0x5B:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.E;
+		}
+		return;
+	case 0x5C:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.H;
+		}
+		return;
+	case 0x5D:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.L;
+		}
+		return;
+	case 0x5E:
+		TRACE_OPCODE();
+		{
+			BR.E = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x5F:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.A;
+		}
+		return;
+	case 0x60:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.B;
+		}
+		return;
+	case 0x61:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.C;
+		}
+		return;
+	case 0x62:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.D;
+		}
+		return;
+	case 0x63:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.E;
+		}
+		return;
+	case 0x64:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.H;
+		}
+		return;
+	case 0x65:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.L;
+		}
+		return;
+	case 0x66:
+		TRACE_OPCODE();
+		{
+			BR.H = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x67:
+		TRACE_OPCODE();
+		{
+			BR.H = BR.A;
+		}
+		return;
+	case 0x68:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.B;
+		}
+		return;
+	case 0x69:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.C;
+		}
+		return;
+	case 0x6A:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.D;
+		}
+		return;
+	case 0x6B:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.E;
+		}
+		return;
+	case 0x6C:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.H;
+		}
+		return;
+	case 0x6D:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.L;
+		}
+		return;
+	case 0x6E:
+		TRACE_OPCODE();
+		{
+			BR.L = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x6F:
+		TRACE_OPCODE();
+		{
+			BR.L = BR.A;
+		}
+		return;
+	case 0x70:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.B);
+		}
+		return;
+	case 0x71:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.C);
+		}
+		return;
+	case 0x72:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.D);
+		}
+		return;
+	case 0x73:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.E);
+		}
+		return;
+	case 0x74:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.H);
+		}
+		return;
+	case 0x75:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.L);
+		}
+		return;
+	case 0x76:
+		TRACE_OPCODE();
+		{
+			ctx->halted = 1;
+			ctx->PC--;
+		}
+		return;
+	case 0x77:
+		TRACE_OPCODE();
+		{
+			write8(ctx, WR.HL, BR.A);
+		}
+		return;
+	case 0x78:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.B;
+		}
+		return;
+	case 0x79:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.C;
+		}
+		return;
+	case 0x7A:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.D;
+		}
+		return;
+	case 0x7B:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.E;
+		}
+		return;
+	case 0x7C:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.H;
+		}
+		return;
+	case 0x7D:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.L;
+		}
+		return;
+	case 0x7E:
+		TRACE_OPCODE();
+		{
+			BR.A = read8(ctx, WR.HL);
+		}
+		return;
+	case 0x7F:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.A;
+		}
+		return;
+	case 0x80:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.B, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x81:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.C, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x82:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.D, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x83:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.E, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x84:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.H, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x85:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.L, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x86:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, WR.HL), F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x87:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.A, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x88:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.B, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x89:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.C, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8A:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.D, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8B:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.E, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8C:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.H, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8D:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.L, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8E:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, WR.HL), F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8F:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.A, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x90:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.B, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x91:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.C, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x92:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.D, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x93:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.E, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x94:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.H, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x95:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.L, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x96:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, WR.HL), F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x97:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.A, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x98:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.B, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x99:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.C, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9A:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.D, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9B:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.E, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9C:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.H, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9D:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.L, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9E:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, WR.HL), F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9F:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.A, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0xA0:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.B);
+		}
+		return;
+	case 0xA1:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.C);
+		}
+		return;
+	case 0xA2:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.D);
+		}
+		return;
+	case 0xA3:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.E);
+		}
+		return;
+	case 0xA4:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.H);
+		}
+		return;
+	case 0xA5:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.L);
+		}
+		return;
+	case 0xA6:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, read8(ctx, WR.HL));
+		}
+		return;
+	case 0xA7:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.A);
+		}
+		return;
+	case 0xA8:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.B);
+		}
+		return;
+	case 0xA9:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.C);
+		}
+		return;
+	case 0xAA:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.D);
+		}
+		return;
+	case 0xAB:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.E);
+		}
+		return;
+	case 0xAC:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.H);
+		}
+		return;
+	case 0xAD:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.L);
+		}
+		return;
+	case 0xAE:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, read8(ctx, WR.HL));
+		}
+		return;
+	case 0xAF:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.A);
+		}
+		return;
+	case 0xB0:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.B);
+		}
+		return;
+	case 0xB1:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.C);
+		}
+		return;
+	case 0xB2:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.D);
+		}
+		return;
+	case 0xB3:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.E);
+		}
+		return;
+	case 0xB4:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.H);
+		}
+		return;
+	case 0xB5:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.L);
+		}
+		return;
+	case 0xB6:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, read8(ctx, WR.HL));
+		}
+		return;
+	case 0xB7:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.A);
+		}
+		return;
+	case 0xB8:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.B, 0, 1);	
+			adjustFlags(ctx, BR.B);
+		}
+		return;
+	case 0xB9:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.C, 0, 1);	
+			adjustFlags(ctx, BR.C);
+		}
+		return;
+	case 0xBA:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.D, 0, 1);	
+			adjustFlags(ctx, BR.D);
+		}
+		return;
+	case 0xBB:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.E, 0, 1);	
+			adjustFlags(ctx, BR.E);
+		}
+		return;
+	case 0xBC:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.H, 0, 1);	
+			adjustFlags(ctx, BR.H);
+		}
+		return;
+	case 0xBD:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.L, 0, 1);	
+			adjustFlags(ctx, BR.L);
+		}
+		return;
+	case 0xBE:
+		TRACE_OPCODE();
+		{
+			doCP_HL(ctx);
+		}
+		return;
+	case 0xBF:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.A, 0, 1);	
+			adjustFlags(ctx, BR.A);
+		}
+		return;
+	case 0xC0:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_NZ))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xC1:
+		TRACE_OPCODE();
+		{
+			WR.BC = doPop(ctx);
+		}
+		return;
+	case 0xC2:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_NZ))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xC3:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xC4:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_NZ))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xC5:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, WR.BC);
+		}
+		return;
+	case 0xC6:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, ctx->PC++), F1_ADD, F2_ADD);
+		}
+		return;
+	case 0xC7:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x00;
+			
+			
+		}
+		return;
+	case 0xC8:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_Z))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xC9:
+		TRACE_OPCODE();
+		{
+			ctx->PC = doPop(ctx);
+		}
+		return;
+	case 0xCA:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_Z))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xCB:
+		goto table_CB;
+	case 0xCC:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_Z))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xCD:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xCE:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, ctx->PC++), F1_ADC, F2_ADC);
+		}
+		return;
+	case 0xCF:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x08;
+			
+			
+		}
+		return;
+	case 0xD0:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_NC))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xD1:
+		TRACE_OPCODE();
+		{
+			WR.DE = doPop(ctx);
+		}
+		return;
+	case 0xD2:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_NC))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xD3:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, BR.A << 8 | read8(ctx, ctx->PC++), BR.A);
+		}
+		return;
+	case 0xD4:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_NC))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xD5:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, WR.DE);
+		}
+		return;
+	case 0xD6:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, ctx->PC++), F1_SUB, F2_SUB);
+		}
+		return;
+	case 0xD7:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x010;
+			
+			
+		}
+		return;
+	case 0xD8:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_C))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xD9:
+		TRACE_OPCODE();
+		{
+			ushort tmp;	
+			tmp = ctx->R1.wr.BC;
+			ctx->R1.wr.BC = ctx->R2.wr.BC;
+			ctx->R2.wr.BC = tmp;	
+			
+			tmp = ctx->R1.wr.DE;
+			ctx->R1.wr.DE = ctx->R2.wr.DE;
+			ctx->R2.wr.DE = tmp;	
+			
+			tmp = ctx->R1.wr.HL;
+			ctx->R1.wr.HL = ctx->R2.wr.HL;
+			ctx->R2.wr.HL = tmp;
+		}
+		return;
+	case 0xDA:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_C))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xDB:
+		TRACE_OPCODE();
+		{
+			byte port = read8(ctx, ctx->PC++);	
+			BR.A = ioRead(ctx, BR.A << 8 | port);
+		}
+		return;
+	case 0xDC:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_C))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xDD:
+		goto table_DD;
+	case 0xDE:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, read8(ctx, ctx->PC++), F1_SBC, F2_SBC);
+		}
+		return;
+	case 0xDF:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x018;
+			
+			
+		}
+		return;
+	case 0xE0:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_PO))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xE1:
+		TRACE_OPCODE();
+		{
+			WR.HL = doPop(ctx);
+		}
+		return;
+	case 0xE2:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_PO))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xE3:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 3;
+			ushort tmp = read16(ctx, WR.SP);
+			write16(ctx, WR.SP, WR.HL);
+			WR.HL = tmp;
+		}
+		return;
+	case 0xE4:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_PO))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xE5:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, WR.HL);
+		}
+		return;
+	case 0xE6:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0xE7:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x020;
+			
+			
+		}
+		return;
+	case 0xE8:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_PE))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xE9:
+		TRACE_OPCODE();
+		{
+			ctx->PC = WR.HL;
+			
+		}
+		return;
+	case 0xEA:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_PE))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xEB:
+		TRACE_OPCODE();
+		{
+			ushort tmp = WR.DE;
+			WR.DE = WR.HL;
+			WR.HL = tmp;
+		}
+		return;
+	case 0xEC:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_PE))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xED:
+		goto table_ED;
+	case 0xEE:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0xEF:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x028;
+			
+			
+		}
+		return;
+	case 0xF0:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_P))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xF1:
+		TRACE_OPCODE();
+		{
+			WR.AF = doPop(ctx);
+		}
+		return;
+	case 0xF2:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_P))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xF3:
+		TRACE_OPCODE();
+		{
+			ctx->IFF1 = ctx->IFF2 = IE_DI;
+			ctx->defer_int = 1;
+		}
+		return;
+	case 0xF4:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_P))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xF5:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, WR.AF);
+		}
+		return;
+	case 0xF6:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0xF7:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x030;
+			
+			
+		}
+		return;
+	case 0xF8:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			if (condition(ctx, C_M))
+				ctx->PC = doPop(ctx);
+				
+		}
+		return;
+	case 0xF9:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.SP = WR.HL;
+		}
+		return;
+	case 0xFA:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_M))
+				ctx->PC = addr;
+			
+		}
+		return;
+	case 0xFB:
+		TRACE_OPCODE();
+		{
+			ctx->IFF1 = ctx->IFF2 = IE_EI;
+			ctx->defer_int = 1;
+		}
+		return;
+	case 0xFC:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			if (condition(ctx, C_M))
+			{
+				ctx->tstates += 1;
+				doPush(ctx, ctx->PC);
+				ctx->PC = addr;
+			}
+			
+		}
+		return;
+	case 0xFD:
+		goto table_FD;
+	case 0xFE:
+		TRACE_OPCODE();
+		{
+			byte val = read8(ctx, ctx->PC++);
+			doArithmetic(ctx, val, 0, 1);	
+			adjustFlags(ctx, val);
+		}
+		return;
+	case 0xFF:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, ctx->PC);
+			ctx->PC = 0x038;
+			
+			
+		}
+		return;
+	}
+	return;
+
+table_CB:
+	opcode = fetchOpcode(ctx, 0);
+	switch (opcode)
+	{
+	case 0x00:
+		TRACE_OPCODE();
+		{
+			BR.B = doRLC(ctx, 1, BR.B);
+		}
+		return;
+	case 0x01:
+		TRACE_OPCODE();
+		{
+			BR.C = doRLC(ctx, 1, BR.C);
+		}
+		return;
+	case 0x02:
+		TRACE_OPCODE();
+		{
+			BR.D = doRLC(ctx, 1, BR.D);
+		}
+		return;
+	case 0x03:
+		TRACE_OPCODE();
+		{
+			BR.E = doRLC(ctx, 1, BR.E);
+		}
+		return;
+	case 0x04:
+		TRACE_OPCODE();
+		{
+			BR.H = doRLC(ctx, 1, BR.H);
+		}
+		return;
+	case 0x05:
+		TRACE_OPCODE();
+		{
+			BR.L = doRLC(ctx, 1, BR.L);
+		}
+		return;
+	case 0x06:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doRLC(ctx, 1, read8(ctx, WR.HL)));
+			
+		}
+		return;
+	case 0x07:
+		TRACE_OPCODE();
+		{
+			BR.A = doRLC(ctx, 1, BR.A);
+		}
+		return;
+	case 0x08:
+		TRACE_OPCODE();
+		{
+			BR.B = doRRC(ctx, 1, BR.B);
+		}
+		return;
+	case 0x09:
+		TRACE_OPCODE();
+		{
+			BR.C = doRRC(ctx, 1, BR.C);
+		}
+		return;
+	case 0x0A:
+		TRACE_OPCODE();
+		{
+			BR.D = doRRC(ctx, 1, BR.D);
+		}
+		return;
+	case 0x0B:
+		TRACE_OPCODE();
+		{
+			BR.E = doRRC(ctx, 1, BR.E);
+		}
+		return;
+	case 0x0C:
+		TRACE_OPCODE();
+		{
+			BR.H = doRRC(ctx, 1, BR.H);
+		}
+		return;
+	case 0x0D:
+		TRACE_OPCODE();
+		{
+			BR.L = doRRC(ctx, 1, BR.L);
+		}
+		return;
+	case 0x0E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doRRC(ctx, 1, read8(ctx, WR.HL)));
+			
+		}
+		return;
+	case 0x0F:
+		TRACE_OPCODE();
+		{
+			BR.A = doRRC(ctx, 1, BR.A);
+		}
+		return;
+	case 0x10:
+		TRACE_OPCODE();
+		{
+			BR.B = doRL(ctx, 1, BR.B);
+		}
+		return;
+	case 0x11:
+		TRACE_OPCODE();
+		{
+			BR.C = doRL(ctx, 1, BR.C);
+		}
+		return;
+	case 0x12:
+		TRACE_OPCODE();
+		{
+			BR.D = doRL(ctx, 1, BR.D);
+		}
+		return;
+	case 0x13:
+		TRACE_OPCODE();
+		{
+			BR.E = doRL(ctx, 1, BR.E);
+		}
+		return;
+	case 0x14:
+		TRACE_OPCODE();
+		{
+			BR.H = doRL(ctx, 1, BR.H);
+		}
+		return;
+	case 0x15:
+		TRACE_OPCODE();
+		{
+			BR.L = doRL(ctx, 1, BR.L);
+		}
+		return;
+	case 0x16:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doRL(ctx, 1, read8(ctx, WR.HL)));
+			
+		}
+		return;
+	case 0x17:
+		TRACE_OPCODE();
+		{
+			BR.A = doRL(ctx, 1, BR.A);
+		}
+		return;
+	case 0x18:
+		TRACE_OPCODE();
+		{
+			BR.B = doRR(ctx, 1, BR.B);
+		}
+		return;
+	case 0x19:
+		TRACE_OPCODE();
+		{
+			BR.C = doRR(ctx, 1, BR.C);
+		}
+		return;
+	case 0x1A:
+		TRACE_OPCODE();
+		{
+			BR.D = doRR(ctx, 1, BR.D);
+		}
+		return;
+	case 0x1B:
+		TRACE_OPCODE();
+		{
+			BR.E = doRR(ctx, 1, BR.E);
+		}
+		return;
+	case 0x1C:
+		TRACE_OPCODE();
+		{
+			BR.H = doRR(ctx, 1, BR.H);
+		}
+		return;
+	case 0x1D:
+		TRACE_OPCODE();
+		{
+			BR.L = doRR(ctx, 1, BR.L);
+		}
+		return;
+	case 0x1E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doRR(ctx, 1, read8(ctx, WR.HL)));
+			
+		}
+		return;
+	case 0x1F:
+		TRACE_OPCODE();
+		{
+			BR.A = doRR(ctx, 1, BR.A);
+		}
+		return;
+	case 0x20:
+		TRACE_OPCODE();
+		{
+			BR.B = doSL(ctx, BR.B, IA_A);
+			
+			
+		}
+		return;
+	case 0x21:
+		TRACE_OPCODE();
+		{
+			BR.C = doSL(ctx, BR.C, IA_A);
+			
+			
+		}
+		return;
+	case 0x22:
+		TRACE_OPCODE();
+		{
+			BR.D = doSL(ctx, BR.D, IA_A);
+			
+			
+		}
+		return;
+	case 0x23:
+		TRACE_OPCODE();
+		{
+			BR.E = doSL(ctx, BR.E, IA_A);
+			
+			
+		}
+		return;
+	case 0x24:
+		TRACE_OPCODE();
+		{
+			BR.H = doSL(ctx, BR.H, IA_A);
+			
+			
+		}
+		return;
+	case 0x25:
+		TRACE_OPCODE();
+		{
+			BR.L = doSL(ctx, BR.L, IA_A);
+			
+			
+		}
+		return;
+	case 0x26:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSL(ctx, read8(ctx, WR.HL), IA_A));
+		}
+		return;
+	case 0x27:
+		TRACE_OPCODE();
+		{
+			BR.A = doSL(ctx, BR.A, IA_A);
+			
+			
+		}
+		return;
+	case 0x28:
+		TRACE_OPCODE();
+		{
+			BR.B = doSR(ctx, BR.B, IA_A);
+			
+			
+		}
+		return;
+	case 0x29:
+		TRACE_OPCODE();
+		{
+			BR.C = doSR(ctx, BR.C, IA_A);
+			
+			
+		}
+		return;
+	case 0x2A:
+		TRACE_OPCODE();
+		{
+			BR.D = doSR(ctx, BR.D, IA_A);
+			
+			
+		}
+		return;
+	case 0x2B:
+		TRACE_OPCODE();
+		{
+			BR.E = doSR(ctx, BR.E, IA_A);
+			
+			
+		}
+		return;
+	case 0x2C:
+		TRACE_OPCODE();
+		{
+			BR.H = doSR(ctx, BR.H, IA_A);
+			
+			
+		}
+		return;
+	case 0x2D:
+		TRACE_OPCODE();
+		{
+			BR.L = doSR(ctx, BR.L, IA_A);
+			
+			
+		}
+		return;
+	case 0x2E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSR(ctx, read8(ctx, WR.HL), IA_A));
+		}
+		return;
+	case 0x2F:
+		TRACE_OPCODE();
+		{
+			BR.A = doSR(ctx, BR.A, IA_A);
+			
+			
+		}
+		return;
+	case 0x30:
+		TRACE_OPCODE();
+		{
+			BR.B = doSL(ctx, BR.B, IA_L);
+			
+			
+		}
+		return;
+	case 0x31:
+		TRACE_OPCODE();
+		{
+			BR.C = doSL(ctx, BR.C, IA_L);
+			
+			
+		}
+		return;
+	case 0x32:
+		TRACE_OPCODE();
+		{
+			BR.D = doSL(ctx, BR.D, IA_L);
+			
+			
+		}
+		return;
+	case 0x33:
+		TRACE_OPCODE();
+		{
+			BR.E = doSL(ctx, BR.E, IA_L);
+			
+			
+		}
+		return;
+	case 0x34:
+		TRACE_OPCODE();
+		{
+			BR.H = doSL(ctx, BR.H, IA_L);
+			
+			
+		}
+		return;
+	case 0x35:
+		TRACE_OPCODE();
+		{
+			BR.L = doSL(ctx, BR.L, IA_L);
+			
+			
+		}
+		return;
+	case 0x36:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSL(ctx, read8(ctx, WR.HL), IA_L));
+		}
+		return;
+	case 0x37:
+		TRACE_OPCODE();
+		{
+			BR.A = doSL(ctx, BR.A, IA_L);
+			
+			
+		}
+		return;
+	case 0x38:
+		TRACE_OPCODE();
+		{
+			BR.B = doSR(ctx, BR.B, IA_L);
+			
+			
+		}
+		return;
+	case 0x39:
+		TRACE_OPCODE();
+		{
+			BR.C = doSR(ctx, BR.C, IA_L);
+			
+			
+		}
+		return;
+	case 0x3A:
+		TRACE_OPCODE();
+		{
+			BR.D = doSR(ctx, BR.D, IA_L);
+			
+			
+		}
+		return;
+	case 0x3B:
+		TRACE_OPCODE();
+		{
+			BR.E = doSR(ctx, BR.E, IA_L);
+			
+			
+		}
+		return;
+	case 0x3C:
+		TRACE_OPCODE();
+		{
+			BR.H = doSR(ctx, BR.H, IA_L);
+			
+			
+		}
+		return;
+	case 0x3D:
+		TRACE_OPCODE();
+		{
+			BR.L = doSR(ctx, BR.L, IA_L);
+			
+			
+		}
+		return;
+	case 0x3E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSR(ctx, read8(ctx, WR.HL), IA_L));
+		}
+		return;
+	case 0x3F:
+		TRACE_OPCODE();
+		{
+			BR.A = doSR(ctx, BR.A, IA_L);
+			
+			
+		}
+		return;
+	case 0x40:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.B);
+		}
+		return;
+	case 0x41:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.C);
+		}
+		return;
+	case 0x42:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.D);
+		}
+		return;
+	case 0x43:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.E);
+		}
+		return;
+	case 0x44:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.H);
+		}
+		return;
+	case 0x45:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.L);
+		}
+		return;
+	case 0x46:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 0, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x47:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 0, BR.A);
+		}
+		return;
+	case 0x48:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.B);
+		}
+		return;
+	case 0x49:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.C);
+		}
+		return;
+	case 0x4A:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.D);
+		}
+		return;
+	case 0x4B:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.E);
+		}
+		return;
+	case 0x4C:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.H);
+		}
+		return;
+	case 0x4D:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.L);
+		}
+		return;
+	case 0x4E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 1, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x4F:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 1, BR.A);
+		}
+		return;
+	case 0x50:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.B);
+		}
+		return;
+	case 0x51:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.C);
+		}
+		return;
+	case 0x52:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.D);
+		}
+		return;
+	case 0x53:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.E);
+		}
+		return;
+	case 0x54:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.H);
+		}
+		return;
+	case 0x55:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.L);
+		}
+		return;
+	case 0x56:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 2, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x57:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 2, BR.A);
+		}
+		return;
+	case 0x58:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.B);
+		}
+		return;
+	case 0x59:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.C);
+		}
+		return;
+	case 0x5A:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.D);
+		}
+		return;
+	case 0x5B:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.E);
+		}
+		return;
+	case 0x5C:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.H);
+		}
+		return;
+	case 0x5D:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.L);
+		}
+		return;
+	case 0x5E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 3, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x5F:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 3, BR.A);
+		}
+		return;
+	case 0x60:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.B);
+		}
+		return;
+	case 0x61:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.C);
+		}
+		return;
+	case 0x62:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.D);
+		}
+		return;
+	case 0x63:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.E);
+		}
+		return;
+	case 0x64:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.H);
+		}
+		return;
+	case 0x65:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.L);
+		}
+		return;
+	case 0x66:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 4, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x67:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 4, BR.A);
+		}
+		return;
+	case 0x68:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.B);
+		}
+		return;
+	case 0x69:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.C);
+		}
+		return;
+	case 0x6A:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.D);
+		}
+		return;
+	case 0x6B:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.E);
+		}
+		return;
+	case 0x6C:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.H);
+		}
+		return;
+	case 0x6D:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.L);
+		}
+		return;
+	case 0x6E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 5, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x6F:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 5, BR.A);
+		}
+		return;
+	case 0x70:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.B);
+		}
+		return;
+	case 0x71:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.C);
+		}
+		return;
+	case 0x72:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.D);
+		}
+		return;
+	case 0x73:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.E);
+		}
+		return;
+	case 0x74:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.H);
+		}
+		return;
+	case 0x75:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.L);
+		}
+		return;
+	case 0x76:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 6, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x77:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 6, BR.A);
+		}
+		return;
+	case 0x78:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.B);
+		}
+		return;
+	case 0x79:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.C);
+		}
+		return;
+	case 0x7A:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.D);
+		}
+		return;
+	case 0x7B:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.E);
+		}
+		return;
+	case 0x7C:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.H);
+		}
+		return;
+	case 0x7D:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.L);
+		}
+		return;
+	case 0x7E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doBIT_r(ctx, 7, read8(ctx, WR.HL));
+		}
+		return;
+	case 0x7F:
+		TRACE_OPCODE();
+		{
+			doBIT_r(ctx, 7, BR.A);
+		}
+		return;
+	case 0x80:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 0, BR.B);
+		}
+		return;
+	case 0x81:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 0, BR.C);
+		}
+		return;
+	case 0x82:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 0, BR.D);
+		}
+		return;
+	case 0x83:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 0, BR.E);
+		}
+		return;
+	case 0x84:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 0, BR.H);
+		}
+		return;
+	case 0x85:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 0, BR.L);
+		}
+		return;
+	case 0x86:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 0, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0x87:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 0, BR.A);
+		}
+		return;
+	case 0x88:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 1, BR.B);
+		}
+		return;
+	case 0x89:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 1, BR.C);
+		}
+		return;
+	case 0x8A:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 1, BR.D);
+		}
+		return;
+	case 0x8B:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 1, BR.E);
+		}
+		return;
+	case 0x8C:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 1, BR.H);
+		}
+		return;
+	case 0x8D:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 1, BR.L);
+		}
+		return;
+	case 0x8E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 1, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0x8F:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 1, BR.A);
+		}
+		return;
+	case 0x90:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 2, BR.B);
+		}
+		return;
+	case 0x91:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 2, BR.C);
+		}
+		return;
+	case 0x92:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 2, BR.D);
+		}
+		return;
+	case 0x93:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 2, BR.E);
+		}
+		return;
+	case 0x94:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 2, BR.H);
+		}
+		return;
+	case 0x95:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 2, BR.L);
+		}
+		return;
+	case 0x96:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 2, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0x97:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 2, BR.A);
+		}
+		return;
+	case 0x98:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 3, BR.B);
+		}
+		return;
+	case 0x99:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 3, BR.C);
+		}
+		return;
+	case 0x9A:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 3, BR.D);
+		}
+		return;
+	case 0x9B:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 3, BR.E);
+		}
+		return;
+	case 0x9C:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 3, BR.H);
+		}
+		return;
+	case 0x9D:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 3, BR.L);
+		}
+		return;
+	case 0x9E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 3, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0x9F:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 3, BR.A);
+		}
+		return;
+	case 0xA0:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 4, BR.B);
+		}
+		return;
+	case 0xA1:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 4, BR.C);
+		}
+		return;
+	case 0xA2:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 4, BR.D);
+		}
+		return;
+	case 0xA3:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 4, BR.E);
+		}
+		return;
+	case 0xA4:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 4, BR.H);
+		}
+		return;
+	case 0xA5:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 4, BR.L);
+		}
+		return;
+	case 0xA6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 4, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xA7:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 4, BR.A);
+		}
+		return;
+	case 0xA8:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 5, BR.B);
+		}
+		return;
+	case 0xA9:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 5, BR.C);
+		}
+		return;
+	case 0xAA:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 5, BR.D);
+		}
+		return;
+	case 0xAB:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 5, BR.E);
+		}
+		return;
+	case 0xAC:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 5, BR.H);
+		}
+		return;
+	case 0xAD:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 5, BR.L);
+		}
+		return;
+	case 0xAE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 5, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xAF:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 5, BR.A);
+		}
+		return;
+	case 0xB0:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 6, BR.B);
+		}
+		return;
+	case 0xB1:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 6, BR.C);
+		}
+		return;
+	case 0xB2:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 6, BR.D);
+		}
+		return;
+	case 0xB3:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 6, BR.E);
+		}
+		return;
+	case 0xB4:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 6, BR.H);
+		}
+		return;
+	case 0xB5:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 6, BR.L);
+		}
+		return;
+	case 0xB6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 6, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xB7:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 6, BR.A);
+		}
+		return;
+	case 0xB8:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_RES, 7, BR.B);
+		}
+		return;
+	case 0xB9:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_RES, 7, BR.C);
+		}
+		return;
+	case 0xBA:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_RES, 7, BR.D);
+		}
+		return;
+	case 0xBB:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_RES, 7, BR.E);
+		}
+		return;
+	case 0xBC:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_RES, 7, BR.H);
+		}
+		return;
+	case 0xBD:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_RES, 7, BR.L);
+		}
+		return;
+	case 0xBE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_RES, 7, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xBF:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_RES, 7, BR.A);
+		}
+		return;
+	case 0xC0:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 0, BR.B);
+		}
+		return;
+	case 0xC1:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 0, BR.C);
+		}
+		return;
+	case 0xC2:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 0, BR.D);
+		}
+		return;
+	case 0xC3:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 0, BR.E);
+		}
+		return;
+	case 0xC4:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 0, BR.H);
+		}
+		return;
+	case 0xC5:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 0, BR.L);
+		}
+		return;
+	case 0xC6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 0, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xC7:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 0, BR.A);
+		}
+		return;
+	case 0xC8:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 1, BR.B);
+		}
+		return;
+	case 0xC9:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 1, BR.C);
+		}
+		return;
+	case 0xCA:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 1, BR.D);
+		}
+		return;
+	case 0xCB:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 1, BR.E);
+		}
+		return;
+	case 0xCC:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 1, BR.H);
+		}
+		return;
+	case 0xCD:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 1, BR.L);
+		}
+		return;
+	case 0xCE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 1, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xCF:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 1, BR.A);
+		}
+		return;
+	case 0xD0:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 2, BR.B);
+		}
+		return;
+	case 0xD1:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 2, BR.C);
+		}
+		return;
+	case 0xD2:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 2, BR.D);
+		}
+		return;
+	case 0xD3:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 2, BR.E);
+		}
+		return;
+	case 0xD4:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 2, BR.H);
+		}
+		return;
+	case 0xD5:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 2, BR.L);
+		}
+		return;
+	case 0xD6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 2, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xD7:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 2, BR.A);
+		}
+		return;
+	case 0xD8:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 3, BR.B);
+		}
+		return;
+	case 0xD9:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 3, BR.C);
+		}
+		return;
+	case 0xDA:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 3, BR.D);
+		}
+		return;
+	case 0xDB:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 3, BR.E);
+		}
+		return;
+	case 0xDC:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 3, BR.H);
+		}
+		return;
+	case 0xDD:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 3, BR.L);
+		}
+		return;
+	case 0xDE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 3, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xDF:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 3, BR.A);
+		}
+		return;
+	case 0xE0:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 4, BR.B);
+		}
+		return;
+	case 0xE1:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 4, BR.C);
+		}
+		return;
+	case 0xE2:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 4, BR.D);
+		}
+		return;
+	case 0xE3:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 4, BR.E);
+		}
+		return;
+	case 0xE4:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 4, BR.H);
+		}
+		return;
+	case 0xE5:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 4, BR.L);
+		}
+		return;
+	case 0xE6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 4, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xE7:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 4, BR.A);
+		}
+		return;
+	case 0xE8:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 5, BR.B);
+		}
+		return;
+	case 0xE9:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 5, BR.C);
+		}
+		return;
+	case 0xEA:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 5, BR.D);
+		}
+		return;
+	case 0xEB:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 5, BR.E);
+		}
+		return;
+	case 0xEC:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 5, BR.H);
+		}
+		return;
+	case 0xED:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 5, BR.L);
+		}
+		return;
+	case 0xEE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 5, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xEF:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 5, BR.A);
+		}
+		return;
+	case 0xF0:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 6, BR.B);
+		}
+		return;
+	case 0xF1:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 6, BR.C);
+		}
+		return;
+	case 0xF2:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 6, BR.D);
+		}
+		return;
+	case 0xF3:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 6, BR.E);
+		}
+		return;
+	case 0xF4:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 6, BR.H);
+		}
+		return;
+	case 0xF5:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 6, BR.L);
+		}
+		return;
+	case 0xF6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 6, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xF7:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 6, BR.A);
+		}
+		return;
+	case 0xF8:
+		TRACE_OPCODE();
+		{
+			BR.B = doSetRes(ctx, SR_SET, 7, BR.B);
+		}
+		return;
+	case 0xF9:
+		TRACE_OPCODE();
+		{
+			BR.C = doSetRes(ctx, SR_SET, 7, BR.C);
+		}
+		return;
+	case 0xFA:
+		TRACE_OPCODE();
+		{
+			BR.D = doSetRes(ctx, SR_SET, 7, BR.D);
+		}
+		return;
+	case 0xFB:
+		TRACE_OPCODE();
+		{
+			BR.E = doSetRes(ctx, SR_SET, 7, BR.E);
+		}
+		return;
+	case 0xFC:
+		TRACE_OPCODE();
+		{
+			BR.H = doSetRes(ctx, SR_SET, 7, BR.H);
+		}
+		return;
+	case 0xFD:
+		TRACE_OPCODE();
+		{
+			BR.L = doSetRes(ctx, SR_SET, 7, BR.L);
+		}
+		return;
+	case 0xFE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			write8(ctx, WR.HL, doSetRes(ctx, SR_SET, 7, read8(ctx, WR.HL)));
+		}
+		return;
+	case 0xFF:
+		TRACE_OPCODE();
+		{
+			BR.A = doSetRes(ctx, SR_SET, 7, BR.A);
+		}
+		return;
+	}
+	return;
+
+table_DD:
+	opcode = fetchOpcode(ctx, 0);
+	switch (opcode)
+	{
+	case 0x09:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IX = doAddWord(ctx, WR.IX, WR.BC, 0, 0);
+		}
+		return;
+	case 0x19:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IX = doAddWord(ctx, WR.IX, WR.DE, 0, 0);
+		}
+		return;
+	case 0x21:
+		TRACE_OPCODE();
+		{
+			WR.IX = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x22:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.IX);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x23:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.IX++;
+		}
+		return;
+	case 0x24:
+		TRACE_OPCODE();
+		{
+			BR.IXh = doIncDec(ctx, BR.IXh, ID_INC);
+		}
+		return;
+	case 0x25:
+		TRACE_OPCODE();
+		{
+			BR.IXh = doIncDec(ctx, BR.IXh, ID_DEC);
+		}
+		return;
+	case 0x26:
+		TRACE_OPCODE();
+		{
+			BR.IXh = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x29:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IX = doAddWord(ctx, WR.IX, WR.IX, 0, 0);
+		}
+		return;
+	case 0x2A:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.IX = read16(ctx, addr);	
+		}
+		return;
+	case 0x2B:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.IX--;
+		}
+		return;
+	case 0x2C:
+		TRACE_OPCODE();
+		{
+			BR.IXl = doIncDec(ctx, BR.IXl, ID_INC);
+		}
+		return;
+	case 0x2D:
+		TRACE_OPCODE();
+		{
+			BR.IXl = doIncDec(ctx, BR.IXl, ID_DEC);
+		}
+		return;
+	case 0x2E:
+		TRACE_OPCODE();
+		{
+			BR.IXl = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x34:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 6;
+			signed char off = read8(ctx, ctx->PC++);
+			byte value = read8(ctx, WR.IX + off);
+			write8(ctx, WR.IX + off, doIncDec(ctx, value, ID_INC));
+			
+		}
+		return;
+	case 0x35:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 6;
+			signed char off = read8(ctx, ctx->PC++);
+			byte value = read8(ctx, WR.IX + off);
+			write8(ctx, WR.IX + off, doIncDec(ctx, value, ID_DEC));
+			
+		}
+		return;
+	case 0x36:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char offset = read8(ctx, ctx->PC++);
+			byte n = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + offset, n);
+			
+		}
+		return;
+	case 0x39:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IX = doAddWord(ctx, WR.IX, WR.SP, 0, 0);
+		}
+		return;
+	case 0x44:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.IXh;
+		}
+		return;
+	case 0x45:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.IXl;
+		}
+		return;
+	case 0x46:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.B = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x4C:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.IXh;
+		}
+		return;
+	case 0x4D:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.IXl;
+		}
+		return;
+	case 0x4E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.C = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x54:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.IXh;
+		}
+		return;
+	case 0x55:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.IXl;
+		}
+		return;
+	case 0x56:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.D = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x5C:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.IXh;
+		}
+		return;
+	case 0x5D:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.IXl;
+		}
+		return;
+	case 0x5E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.E = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x60:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.B;
+		}
+		return;
+	case 0x61:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.C;
+		}
+		return;
+	case 0x62:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.D;
+		}
+		return;
+	case 0x63:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.E;
+		}
+		return;
+	case 0x64:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.IXh;
+		}
+		return;
+	case 0x65:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.IXl;
+		}
+		return;
+	case 0x66:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.H = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x67:
+		TRACE_OPCODE();
+		{
+			BR.IXh = BR.A;
+		}
+		return;
+	case 0x68:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.B;
+		}
+		return;
+	case 0x69:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.C;
+		}
+		return;
+	case 0x6A:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.D;
+		}
+		return;
+	case 0x6B:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.E;
+		}
+		return;
+	case 0x6C:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.IXh;
+		}
+		return;
+	case 0x6D:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.IXl;
+		}
+		return;
+	case 0x6E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.L = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x6F:
+		TRACE_OPCODE();
+		{
+			BR.IXl = BR.A;
+		}
+		return;
+	case 0x70:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.B);
+			
+		}
+		return;
+	case 0x71:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.C);
+			
+		}
+		return;
+	case 0x72:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.D);
+			
+		}
+		return;
+	case 0x73:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.E);
+			
+		}
+		return;
+	case 0x74:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.H);
+			
+		}
+		return;
+	case 0x75:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.L);
+			
+		}
+		return;
+	case 0x77:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++), BR.A);
+			
+		}
+		return;
+	case 0x7C:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.IXh;
+		}
+		return;
+	case 0x7D:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.IXl;
+		}
+		return;
+	case 0x7E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.A = read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x84:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXh, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x85:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXl, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x86:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IX + displacement), F1_ADD, F2_ADD);
+			
+		}
+		return;
+	case 0x8C:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXh, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8D:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXl, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IX + displacement), F1_ADC, F2_ADC);
+			
+		}
+		return;
+	case 0x94:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXh, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x95:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXl, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x96:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IX + displacement), F1_SUB, F2_SUB);
+			
+		}
+		return;
+	case 0x9C:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXh, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9D:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IXl, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IX + displacement), F1_SBC, F2_SBC);
+			
+		}
+		return;
+	case 0xA4:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.IXh);
+		}
+		return;
+	case 0xA5:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.IXl);
+		}
+		return;
+	case 0xA6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			doAND(ctx, read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++)));
+		}
+		return;
+	case 0xAC:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.IXh);
+		}
+		return;
+	case 0xAD:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.IXl);
+		}
+		return;
+	case 0xAE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			doXOR(ctx, read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++)));
+		}
+		return;
+	case 0xB4:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.IXh);
+		}
+		return;
+	case 0xB5:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.IXl);
+		}
+		return;
+	case 0xB6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			doOR(ctx, read8(ctx, WR.IX + (signed char) read8(ctx, ctx->PC++)));
+		}
+		return;
+	case 0xBC:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.IXh, 0, 1);	
+			adjustFlags(ctx, BR.IXh);
+		}
+		return;
+	case 0xBD:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.IXl, 0, 1);	
+			adjustFlags(ctx, BR.IXl);
+		}
+		return;
+	case 0xBE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			byte val = read8(ctx, WR.IX + displacement);
+			doArithmetic(ctx, val, 0, 1);	
+			adjustFlags(ctx, val);
+		}
+		return;
+	case 0xCB:
+		goto table_DDCB;
+	case 0xE1:
+		TRACE_OPCODE();
+		{
+			WR.IX = doPop(ctx);
+		}
+		return;
+	case 0xE3:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 3;
+			ushort tmp = read16(ctx, WR.SP);
+			write16(ctx, WR.SP, WR.IX);
+			WR.IX = tmp;
+		}
+		return;
+	case 0xE5:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, WR.IX);
+		}
+		return;
+	case 0xE9:
+		TRACE_OPCODE();
+		{
+			ctx->PC = WR.IX;
+			
+		}
+		return;
+	case 0xF9:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.SP = WR.IX;
+		}
+		return;
+	}
+	return;
+
+table_DDCB:
+	DECR;
+	opcode = fetchOpcode(ctx, 1);
+	switch (opcode)
+	{
+	case 0x00:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x01:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x02:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x03:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x04:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x05:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x06:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doRLC(ctx, 1, read8(ctx, WR.IX + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x07:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRLC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x08:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x09:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doRRC(ctx, 1, read8(ctx, WR.IX + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRRC(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x10:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x11:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x12:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x13:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x14:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x15:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x16:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doRL(ctx, 1, read8(ctx, WR.IX + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x17:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRL(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x18:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x19:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doRR(ctx, 1, read8(ctx, WR.IX + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRR(ctx, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x20:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.B);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x21:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.C);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x22:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.D);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x23:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.E);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x24:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.H);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x25:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.L);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x26:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSL(ctx, read8(ctx, WR.IX + off), IA_A));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x27:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSL(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.A);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x28:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.B);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x29:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.C);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.D);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.E);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.H);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.L);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSR(ctx, read8(ctx, WR.IX + off), IA_A));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSR(ctx, read8(ctx, WR.IX + off), 1);
+			write8(ctx, WR.IX + off, BR.A);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x30:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.B);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x31:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.C);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x32:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.D);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x33:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.E);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x34:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.H);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x35:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.L);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x36:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSL(ctx, read8(ctx, WR.IX + off), IA_L));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x37:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSL(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.A);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x38:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.B);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x39:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.C);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.D);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.E);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.H);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.L);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSR(ctx, read8(ctx, WR.IX + off), IA_L));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSR(ctx, read8(ctx, WR.IX + off), 0);
+			write8(ctx, WR.IX + off, BR.A);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x40:
+	case 0x41:
+	case 0x42:
+	case 0x43:
+	case 0x44:
+	case 0x45:
+	case 0x46:
+	case 0x47:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 0, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x48:
+	case 0x49:
+	case 0x4A:
+	case 0x4B:
+	case 0x4C:
+	case 0x4D:
+	case 0x4E:
+	case 0x4F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 1, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x50:
+	case 0x51:
+	case 0x52:
+	case 0x53:
+	case 0x54:
+	case 0x55:
+	case 0x56:
+	case 0x57:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 2, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x58:
+	case 0x59:
+	case 0x5A:
+	case 0x5B:
+	case 0x5C:
+	case 0x5D:
+	case 0x5E:
+	case 0x5F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 3, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x60:
+	case 0x61:
+	case 0x62:
+	case 0x63:
+	case 0x64:
+	case 0x65:
+	case 0x66:
+	case 0x67:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 4, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x68:
+	case 0x69:
+	case 0x6A:
+	case 0x6B:
+	case 0x6C:
+	case 0x6D:
+	case 0x6E:
+	case 0x6F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 5, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x70:
+	case 0x71:
+	case 0x72:
+	case 0x73:
+	case 0x74:
+	case 0x75:
+	case 0x76:
+	case 0x77:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 6, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x78:
+	case 0x79:
+	case 0x7A:
+	case 0x7B:
+	case 0x7C:
+	case 0x7D:
+	case 0x7E:
+	case 0x7F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IX + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 7, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x80:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x81:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x82:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x83:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x84:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x85:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x86:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x87:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x88:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x89:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x90:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x91:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x92:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x93:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x94:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x95:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x96:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x97:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x98:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x99:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xED:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IX + off, doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IX + off));
+			write8(ctx, WR.IX + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	}
+	return;
+
+table_ED:
+	opcode = fetchOpcode(ctx, 0);
+	switch (opcode)
+	{
+	case 0x40:
+		TRACE_OPCODE();
+		{
+			BR.B = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.B);
+			adjustFlags(ctx, BR.B);
+		}
+		return;
+	case 0x41:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.B);
+		}
+		return;
+	case 0x42:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.BC, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x43:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.BC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x44:
+	case 0x4C:
+	case 0x54:
+	case 0x5C:
+	case 0x64:
+	case 0x6C:
+	case 0x74:
+	case 0x7C:
+		TRACE_OPCODE();
+		{
+			int temp = BR.A;
+			BR.A = 0;
+			BR.A = doArithmetic(ctx, temp, 0, 1);
+			SETFLAG(F_N);
+		}
+		return;
+	case 0x45:
+	case 0x55:
+	case 0x5D:
+	case 0x65:
+	case 0x6D:
+	case 0x75:
+	case 0x7D:
+		TRACE_OPCODE();
+		{
+			ctx->IFF1 = ctx->IFF2;
+			RET(ctx);
+		}
+		return;
+	case 0x46:
+	case 0x4E:
+	case 0x66:
+	case 0x6E:
+		TRACE_OPCODE();
+		{
+			ctx->IM = 0;
+		}
+		return;
+	case 0x47:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			ctx->I = BR.A;
+		}
+		return;
+	case 0x48:
+		TRACE_OPCODE();
+		{
+			BR.C = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.C);
+			adjustFlags(ctx, BR.C);
+		}
+		return;
+	case 0x49:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.C);
+		}
+		return;
+	case 0x4A:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.BC, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x4B:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.BC = read16(ctx, addr);	
+		}
+		return;
+	case 0x4D:
+		TRACE_OPCODE();
+		{
+			if (ctx->on_reti)
+				ctx->on_reti(ctx->ioParam);
+			ctx->IFF1 = ctx->IFF2;
+			RET		(ctx);
+				
+		}
+		return;
+	case 0x4F:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			ctx->R = BR.A;
+		}
+		return;
+	case 0x50:
+		TRACE_OPCODE();
+		{
+			BR.D = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.D);
+			adjustFlags(ctx, BR.D);
+		}
+		return;
+	case 0x51:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.D);
+		}
+		return;
+	case 0x52:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.DE, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x53:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.DE);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x56:
+	case 0x76:
+		TRACE_OPCODE();
+		{
+			ctx->IM = 1;
+		}
+		return;
+	case 0x57:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			BR.A = ctx->I;
+			adjustFlags(ctx, BR.A);
+			RESFLAG(F_H | F_N);
+			VALFLAG(F_PV, ctx->IFF2);
+			VALFLAG(F_S, (BR.A & 0x80) != 0);
+			VALFLAG(F_Z, (BR.A == 0));
+			
+		}
+		return;
+	case 0x58:
+		TRACE_OPCODE();
+		{
+			BR.E = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.E);
+			adjustFlags(ctx, BR.E);
+		}
+		return;
+	case 0x59:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.E);
+		}
+		return;
+	case 0x5A:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.DE, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x5B:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.DE = read16(ctx, addr);	
+		}
+		return;
+	case 0x5E:
+	case 0x7E:
+		TRACE_OPCODE();
+		{
+			ctx->IM = 2;
+		}
+		return;
+	case 0x5F:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			BR.A = ctx->R;
+			adjustFlags(ctx, BR.A);
+			RESFLAG(F_H | F_N);
+			VALFLAG(F_PV, ctx->IFF2);
+			VALFLAG(F_S, (BR.A & 0x80) != 0);
+			VALFLAG(F_Z, (BR.A == 0));
+			
+		}
+		return;
+	case 0x60:
+		TRACE_OPCODE();
+		{
+			BR.H = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.H);
+			adjustFlags(ctx, BR.H);
+		}
+		return;
+	case 0x61:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.H);
+		}
+		return;
+	case 0x62:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.HL, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x63:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.HL);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x67:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 4;
+			byte Ah = BR.A & 0x0f;
+			byte hl = read8(ctx, WR.HL);
+			BR.A = (BR.A & 0xf0) | (hl & 0x0f);
+			hl = (hl >> 4) | (Ah << 4);
+			write8(ctx, WR.HL, hl);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.A);
+		}
+		return;
+	case 0x68:
+		TRACE_OPCODE();
+		{
+			BR.L = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.L);
+			adjustFlags(ctx, BR.L);
+		}
+		return;
+	case 0x69:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.L);
+		}
+		return;
+	case 0x6A:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.HL, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x6B:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.HL = read16(ctx, addr);	
+		}
+		return;
+	case 0x6F:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 4;
+			byte Ah = BR.A & 0x0f;
+			byte hl = read8(ctx, WR.HL);
+			BR.A = (BR.A & 0xf0) | ((hl & 0xf0) >> 4);
+			hl = (hl << 4) | Ah;
+			write8(ctx, WR.HL, hl);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.A);
+			adjustFlags(ctx, BR.A);
+		}
+		return;
+	case 0x70:
+		TRACE_OPCODE();
+		{
+			BR.F = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.F);
+			adjustFlags(ctx, BR.F);
+		}
+		return;
+	case 0x71:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, 0);
+			
+		}
+		return;
+	case 0x72:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.SP, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x73:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.SP);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x78:
+		TRACE_OPCODE();
+		{
+			BR.A = ioRead(ctx, WR.BC);
+			RESFLAG(F_H | F_N);
+			adjustFlagSZP(ctx, BR.A);
+			adjustFlags(ctx, BR.A);
+		}
+		return;
+	case 0x79:
+		TRACE_OPCODE();
+		{
+			ioWrite(ctx, WR.BC, BR.A);
+		}
+		return;
+	case 0x7A:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.HL = doAddWord(ctx, WR.HL, WR.SP, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x7B:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.SP = read16(ctx, addr);	
+		}
+		return;
+	case 0xA0:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			byte val = read8(ctx, WR.HL);
+			write8(ctx, WR.DE, val);
+			WR.DE++;
+			WR.HL++;
+			WR.BC--;
+			VALFLAG(F_5, (BR.A + val) & 0x02);
+			VALFLAG(F_3, ((BR.A + val) & F_3) != 0);
+			RESFLAG(F_H | F_N);
+			VALFLAG(F_PV, WR.BC != 0);
+		}
+		return;
+	case 0xA1:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			int carry = GETFLAG(F_C);
+			byte value = doCP_HL(ctx);
+			if(GETFLAG(F_H))
+				value--;
+			WR.HL++;
+			WR.BC--;
+			VALFLAG(F_PV, WR.BC != 0);
+			VALFLAG(F_C, carry);
+			VALFLAG(F_5, value & (1 << 2));
+			VALFLAG(F_3, value & (1 << 3));
+		}
+		return;
+	case 0xA2:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			byte val = ioRead(ctx, WR.BC);
+			write8(ctx, WR.HL, val);
+			WR.HL++;
+			BR.B = doIncDec(ctx, BR.B, ID_DEC);
+			VALFLAG(F_N, (val & 0x80) != 0);
+			int flagval = val + ((BR.C + 1) & 0xff);
+			VALFLAG(F_H, flagval > 0xff);
+			VALFLAG(F_C, flagval > 0xff);
+			VALFLAG(F_PV, parityBit[(flagval & 7) ^ BR.B]);
+		}
+		return;
+	case 0xA3:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			byte value = read8(ctx, WR.HL);
+			BR.B = doIncDec(ctx, BR.B, 1);
+			ioWrite(ctx, WR.BC, value);
+			WR.HL++;
+			int flag_value = value + BR.L;
+			VALFLAG(F_N, value & 0x80);
+			VALFLAG(F_H, flag_value > 0xff);
+			VALFLAG(F_C, flag_value > 0xff);
+			VALFLAG(F_PV, parityBit[(flag_value & 7) ^ BR.B]);
+			adjustFlags(ctx, BR.B);
+		}
+		return;
+	case 0xA8:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			byte val = read8(ctx, WR.HL);
+			write8(ctx, WR.DE, val);
+			WR.DE--;
+			WR.HL--;
+			WR.BC--;
+			VALFLAG(F_5, ((BR.A + val) & 0x02) != 0);
+			VALFLAG(F_3, ((BR.A + val) & F_3) != 0);
+			RESFLAG(F_H | F_N);
+			VALFLAG(F_PV, WR.BC != 0);
+		}
+		return;
+	case 0xA9:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			int carry = GETFLAG(F_C);
+			byte value = doCP_HL(ctx);
+			if(GETFLAG(F_H))
+				value--;
+			WR.HL--;
+			WR.BC--;
+			VALFLAG(F_PV, WR.BC != 0);
+			if(carry)
+				SETFLAG(F_C);
+			else
+				RESFLAG(F_C);
+			VALFLAG(F_5, value & (1 << 1));
+			VALFLAG(F_3, value & (1 << 3));
+		}
+		return;
+	case 0xAA:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			byte val = ioRead(ctx, WR.BC);
+			write8(ctx, WR.HL, val);
+			WR.HL--;
+			BR.B = doIncDec(ctx, BR.B, ID_DEC);
+			VALFLAG(F_N, (val & 0x80) != 0);
+			int flagval = val + ((BR.C - 1) & 0xff);
+			VALFLAG(F_H, flagval > 0xff);
+			VALFLAG(F_C, flagval > 0xff);
+			VALFLAG(F_PV, parityBit[(flagval & 7) ^ BR.B]);
+		}
+		return;
+	case 0xAB:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			byte value = read8(ctx, WR.HL);
+			BR.B = doIncDec(ctx, BR.B, 1);
+			ioWrite(ctx, WR.BC, value);
+			WR.HL--;
+			int flag_value = value + BR.L;
+			VALFLAG(F_N, value & 0x80);
+			VALFLAG(F_H, flag_value > 0xff);
+			VALFLAG(F_C, flag_value > 0xff);
+			VALFLAG(F_PV, parityBit[(flag_value & 7) ^ BR.B]);
+			adjustFlags(ctx, BR.B);
+		}
+		return;
+	case 0xB0:
+		TRACE_OPCODE();
+		{
+			LDI(ctx);
+			if (WR.BC != 0)
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xB1:
+		TRACE_OPCODE();
+		{
+			CPI(ctx);
+			if (WR.BC != 0 && !GETFLAG(F_Z))
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xB2:
+		TRACE_OPCODE();
+		{
+			INI(ctx);
+			if (BR.B != 0)
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xB3:
+		TRACE_OPCODE();
+		{
+			OUTI(ctx);
+			if (BR.B != 0)
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xB8:
+		TRACE_OPCODE();
+		{
+			LDD(ctx);
+			if (WR.BC != 0)
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xB9:
+		TRACE_OPCODE();
+		{
+			CPD(ctx);
+			if (WR.BC != 0 && !GETFLAG(F_Z))
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xBA:
+		TRACE_OPCODE();
+		{
+			IND(ctx);
+			if (BR.B != 0)
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	case 0xBB:
+		TRACE_OPCODE();
+		{
+			OUTD(ctx);
+			if (BR.B != 0)
+			{
+				ctx->tstates += 5;
+				ctx->PC -= 2;
+			}
+		}
+		return;
+	}
+	return;
+
+table_FD:
+	opcode = fetchOpcode(ctx, 0);
+	switch (opcode)
+	{
+	case 0x09:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IY = doAddWord(ctx, WR.IY, WR.BC, 0, 0);
+		}
+		return;
+	case 0x19:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IY = doAddWord(ctx, WR.IY, WR.DE, 0, 0);
+		}
+		return;
+	case 0x21:
+		TRACE_OPCODE();
+		{
+			WR.IY = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x22:
+		TRACE_OPCODE();
+		{
+			write16(ctx, read16(ctx, ctx->PC), WR.IY);
+			ctx->PC += 2;
+			
+		}
+		return;
+	case 0x23:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.IY++;
+		}
+		return;
+	case 0x24:
+		TRACE_OPCODE();
+		{
+			BR.IYh = doIncDec(ctx, BR.IYh, ID_INC);
+		}
+		return;
+	case 0x25:
+		TRACE_OPCODE();
+		{
+			BR.IYh = doIncDec(ctx, BR.IYh, ID_DEC);
+		}
+		return;
+	case 0x26:
+		TRACE_OPCODE();
+		{
+			BR.IYh = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x29:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IY = doAddWord(ctx, WR.IY, WR.IY, 0, 0);
+		}
+		return;
+	case 0x2A:
+		TRACE_OPCODE();
+		{
+			ushort addr = read16(ctx, ctx->PC);
+			ctx->PC += 2;
+			WR.IY = read16(ctx, addr);	
+		}
+		return;
+	case 0x2B:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.IY--;
+		}
+		return;
+	case 0x2C:
+		TRACE_OPCODE();
+		{
+			BR.IYl = doIncDec(ctx, BR.IYl, ID_INC);
+		}
+		return;
+	case 0x2D:
+		TRACE_OPCODE();
+		{
+			BR.IYl = doIncDec(ctx, BR.IYl, ID_DEC);
+		}
+		return;
+	case 0x2E:
+		TRACE_OPCODE();
+		{
+			BR.IYl = read8(ctx, ctx->PC++);
+			
+		}
+		return;
+	case 0x34:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 6;
+			signed char off = read8(ctx, ctx->PC++);
+			byte value = read8(ctx, WR.IY + off);
+			write8(ctx, WR.IY + off, doIncDec(ctx, value, ID_INC));
+			
+		}
+		return;
+	case 0x35:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 6;
+			signed char off = read8(ctx, ctx->PC++);
+			byte value = read8(ctx, WR.IY + off);
+			write8(ctx, WR.IY + off, doIncDec(ctx, value, ID_DEC));
+			
+		}
+		return;
+	case 0x36:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char offset = read8(ctx, ctx->PC++);
+			byte n = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + offset, n);
+			
+		}
+		return;
+	case 0x39:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 7;
+			WR.IY = doAddWord(ctx, WR.IY, WR.SP, 0, 0);
+		}
+		return;
+	case 0x44:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.IYh;
+		}
+		return;
+	case 0x45:
+		TRACE_OPCODE();
+		{
+			BR.B = BR.IYl;
+		}
+		return;
+	case 0x46:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.B = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x4C:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.IYh;
+		}
+		return;
+	case 0x4D:
+		TRACE_OPCODE();
+		{
+			BR.C = BR.IYl;
+		}
+		return;
+	case 0x4E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.C = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x54:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.IYh;
+		}
+		return;
+	case 0x55:
+		TRACE_OPCODE();
+		{
+			BR.D = BR.IYl;
+		}
+		return;
+	case 0x56:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.D = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x5C:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.IYh;
+		}
+		return;
+	case 0x5D:
+		TRACE_OPCODE();
+		{
+			BR.E = BR.IYl;
+		}
+		return;
+	case 0x5E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.E = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x60:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.B;
+		}
+		return;
+	case 0x61:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.C;
+		}
+		return;
+	case 0x62:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.D;
+		}
+		return;
+	case 0x63:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.E;
+		}
+		return;
+	case 0x64:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.IYh;
+		}
+		return;
+	case 0x65:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.IYl;
+		}
+		return;
+	case 0x66:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.H = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x67:
+		TRACE_OPCODE();
+		{
+			BR.IYh = BR.A;
+		}
+		return;
+	case 0x68:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.B;
+		}
+		return;
+	case 0x69:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.C;
+		}
+		return;
+	case 0x6A:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.D;
+		}
+		return;
+	case 0x6B:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.E;
+		}
+		return;
+	case 0x6C:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.IYh;
+		}
+		return;
+	case 0x6D:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.IYl;
+		}
+		return;
+	case 0x6E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.L = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x6F:
+		TRACE_OPCODE();
+		{
+			BR.IYl = BR.A;
+		}
+		return;
+	case 0x70:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.B);
+			
+		}
+		return;
+	case 0x71:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.C);
+			
+		}
+		return;
+	case 0x72:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.D);
+			
+		}
+		return;
+	case 0x73:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.E);
+			
+		}
+		return;
+	case 0x74:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.H);
+			
+		}
+		return;
+	case 0x75:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.L);
+			
+		}
+		return;
+	case 0x77:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			write8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++), BR.A);
+			
+		}
+		return;
+	case 0x7C:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.IYh;
+		}
+		return;
+	case 0x7D:
+		TRACE_OPCODE();
+		{
+			BR.A = BR.IYl;
+		}
+		return;
+	case 0x7E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			BR.A = read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++));
+		}
+		return;
+	case 0x84:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYh, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x85:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYl, F1_ADD, F2_ADD);
+		}
+		return;
+	case 0x86:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IY + displacement), F1_ADD, F2_ADD);
+			
+		}
+		return;
+	case 0x8C:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYh, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8D:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYl, F1_ADC, F2_ADC);
+		}
+		return;
+	case 0x8E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IY + displacement), F1_ADC, F2_ADC);
+			
+		}
+		return;
+	case 0x94:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYh, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x95:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYl, F1_SUB, F2_SUB);
+		}
+		return;
+	case 0x96:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IY + displacement), F1_SUB, F2_SUB);
+			
+		}
+		return;
+	case 0x9C:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYh, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9D:
+		TRACE_OPCODE();
+		{
+			BR.A = doArithmetic(ctx, BR.IYl, F1_SBC, F2_SBC);
+		}
+		return;
+	case 0x9E:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			BR.A = doArithmetic(ctx, read8(ctx, WR.IY + displacement), F1_SBC, F2_SBC);
+			
+		}
+		return;
+	case 0xA4:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.IYh);
+		}
+		return;
+	case 0xA5:
+		TRACE_OPCODE();
+		{
+			doAND(ctx, BR.IYl);
+		}
+		return;
+	case 0xA6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			doAND(ctx, read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++)));
+		}
+		return;
+	case 0xAC:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.IYh);
+		}
+		return;
+	case 0xAD:
+		TRACE_OPCODE();
+		{
+			doXOR(ctx, BR.IYl);
+		}
+		return;
+	case 0xAE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			doXOR(ctx, read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++)));
+		}
+		return;
+	case 0xB4:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.IYh);
+		}
+		return;
+	case 0xB5:
+		TRACE_OPCODE();
+		{
+			doOR(ctx, BR.IYl);
+		}
+		return;
+	case 0xB6:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			doOR(ctx, read8(ctx, WR.IY + (signed char) read8(ctx, ctx->PC++)));
+		}
+		return;
+	case 0xBC:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.IYh, 0, 1);	
+			adjustFlags(ctx, BR.IYh);
+		}
+		return;
+	case 0xBD:
+		TRACE_OPCODE();
+		{
+			doArithmetic(ctx, BR.IYl, 0, 1);	
+			adjustFlags(ctx, BR.IYl);
+		}
+		return;
+	case 0xBE:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 5;
+			signed char displacement = read8(ctx, ctx->PC++);
+			byte val = read8(ctx, WR.IY + displacement);
+			doArithmetic(ctx, val, 0, 1);	
+			adjustFlags(ctx, val);
+		}
+		return;
+	case 0xCB:
+		goto table_FDCB;
+	case 0xE1:
+		TRACE_OPCODE();
+		{
+			WR.IY = doPop(ctx);
+		}
+		return;
+	case 0xE3:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 3;
+			ushort tmp = read16(ctx, WR.SP);
+			write16(ctx, WR.SP, WR.IY);
+			WR.IY = tmp;
+		}
+		return;
+	case 0xE5:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 1;
+			doPush(ctx, WR.IY);
+		}
+		return;
+	case 0xE9:
+		TRACE_OPCODE();
+		{
+			ctx->PC = WR.IY;
+			
+		}
+		return;
+	case 0xF9:
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			WR.SP = WR.IY;
+		}
+		return;
+	}
+	return;
+
+table_FDCB:
+	DECR;
+	opcode = fetchOpcode(ctx, 1);
+	switch (opcode)
+	{
+	case 0x00:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x01:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x02:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x03:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x04:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x05:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x06:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doRLC(ctx, 1, read8(ctx, WR.IY + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x07:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRLC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x08:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x09:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doRRC(ctx, 1, read8(ctx, WR.IY + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x0F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRRC(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x10:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x11:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x12:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x13:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x14:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x15:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x16:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doRL(ctx, 1, read8(ctx, WR.IY + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x17:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRL(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x18:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x19:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doRR(ctx, 1, read8(ctx, WR.IY + off)));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x1F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doRR(ctx, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x20:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.B);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x21:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.C);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x22:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.D);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x23:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.E);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x24:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.H);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x25:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.L);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x26:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSL(ctx, read8(ctx, WR.IY + off), IA_A));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x27:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSL(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.A);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x28:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.B);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x29:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.C);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.D);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.E);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.H);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.L);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSR(ctx, read8(ctx, WR.IY + off), IA_A));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x2F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSR(ctx, read8(ctx, WR.IY + off), 1);
+			write8(ctx, WR.IY + off, BR.A);	
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x30:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.B);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x31:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.C);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x32:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.D);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x33:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.E);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x34:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.H);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x35:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.L);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x36:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSL(ctx, read8(ctx, WR.IY + off), IA_L));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x37:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSL(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.A);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x38:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.B);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x39:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.C);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.D);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.E);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.H);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.L);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSR(ctx, read8(ctx, WR.IY + off), IA_L));
+		}
+		ctx->PC += 1;
+		return;
+	case 0x3F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSR(ctx, read8(ctx, WR.IY + off), 0);
+			write8(ctx, WR.IY + off, BR.A);	
+			  
+		}
+		ctx->PC += 1;
+		return;
+	case 0x40:
+	case 0x41:
+	case 0x42:
+	case 0x43:
+	case 0x44:
+	case 0x45:
+	case 0x46:
+	case 0x47:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 0, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x48:
+	case 0x49:
+	case 0x4A:
+	case 0x4B:
+	case 0x4C:
+	case 0x4D:
+	case 0x4E:
+	case 0x4F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 1, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x50:
+	case 0x51:
+	case 0x52:
+	case 0x53:
+	case 0x54:
+	case 0x55:
+	case 0x56:
+	case 0x57:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 2, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x58:
+	case 0x59:
+	case 0x5A:
+	case 0x5B:
+	case 0x5C:
+	case 0x5D:
+	case 0x5E:
+	case 0x5F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 3, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x60:
+	case 0x61:
+	case 0x62:
+	case 0x63:
+	case 0x64:
+	case 0x65:
+	case 0x66:
+	case 0x67:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 4, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x68:
+	case 0x69:
+	case 0x6A:
+	case 0x6B:
+	case 0x6C:
+	case 0x6D:
+	case 0x6E:
+	case 0x6F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 5, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x70:
+	case 0x71:
+	case 0x72:
+	case 0x73:
+	case 0x74:
+	case 0x75:
+	case 0x76:
+	case 0x77:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 6, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x78:
+	case 0x79:
+	case 0x7A:
+	case 0x7B:
+	case 0x7C:
+	case 0x7D:
+	case 0x7E:
+	case 0x7F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			ushort address = WR.IY + (signed char) read8(ctx, ctx->PC++);
+			doBIT_indexed(ctx, 7, address);
+		}
+		ctx->PC += 1;
+		return;
+	case 0x80:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x81:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x82:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x83:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x84:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x85:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x86:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x87:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x88:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x89:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x8F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x90:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x91:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x92:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x93:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x94:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x95:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x96:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x97:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x98:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x99:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9A:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9B:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9C:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9D:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9E:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0x9F:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xA9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xAF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xB9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xBF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_RES, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 0, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xC9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xCF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 1, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 2, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xD9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xDF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 3, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 4, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xE9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xED:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xEF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 5, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF0:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF1:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF2:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF3:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF4:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF5:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF6:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF7:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 6, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF8:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.B = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.B);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xF9:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.C = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.C);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFA:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.D = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.D);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFB:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.E = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.E);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFC:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.H = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.H);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFD:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.L = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.L);	
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFE:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			write8(ctx, WR.IY + off, doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off)));
+			
+			
+		}
+		ctx->PC += 1;
+		return;
+	case 0xFF:
+		ctx->PC -= 1;
+		TRACE_OPCODE();
+		{
+			ctx->tstates += 2;
+			signed char off = read8(ctx, ctx->PC++);
+			BR.A = doSetRes(ctx, SR_SET, 7, read8(ctx, WR.IY + off));
+			write8(ctx, WR.IY + off, BR.A);	
+		}
+		ctx->PC += 1;
+		return;
+	}
+	return;
+
+}
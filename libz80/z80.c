@@ -23,8 +23,25 @@
  *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
  */
 
+#if defined(__x86_64__) && !defined(Z80_NO_JIT)
+#define Z80_JIT
+#define _DEFAULT_SOURCE		/* mmap for the code buffer */
+#endif
+
+/* The Makefile builds this file a second time with -DZ80_FAST. That copy
+   has no trace hook, does not drive M1 and only provides Z80ExecuteFast and
+   Z80ExecuteTStatesFast, everything else comes from the normal build. */
+#ifdef Z80_FAST
+#define Z80Execute Z80ExecuteFast
+#define Z80ExecuteTStates Z80ExecuteTStatesFast
+#endif
+
+/* Sets up the tables of the fast copy, called from Z80RESET */
+void Z80FastInit(void);
+
 #include "z80.h"
 #include "string.h"
+#include "stdlib.h"
 
 
 #define BR (ctx->R1.br)
@@ -88,6 +105,15 @@ static const int F2_SUB = 1;
 #define INCR (ctx->R = (ctx->R & 0x80) | ((ctx->R + 1) & 0x7f))
 #define DECR (ctx->R = (ctx->R & 0x80) | ((ctx->R - 1) & 0x7f))
 
+/* Called before each instruction is executed */
+#ifdef Z80_FAST
+#define TRACING() 0
+#define TRACE_OPCODE() do { } while(0)
+#else
+#define TRACING() (ctx->trace != NULL)
+#define TRACE_OPCODE() do { if (ctx->trace) ctx->trace(ctx->memParam); } while(0)
+#endif
+
 
 /* ---------------------------------------------------------
  *  The opcode implementations
@@ -132,8 +158,19 @@ struct Z80OpcodeTable
  */ 
 static void write8 (Z80Context* ctx, ushort addr, byte val)
 {
+	unsigned page = addr >> Z80_PAGE_SHIFT;
+	byte* p = ctx->writePage[page];
 	ctx->tstates += 3;
-	ctx->memWrite(ctx->memParam, addr, val);	
+	if (p) {
+		p[addr & (Z80_PAGE_SIZE - 1)] = val;
+		if (ctx->writeGen[page])
+			(*ctx->writeGen[page])++;
+	} else {
+		ctx->memWrite(ctx->memParam, addr, val);
+		/* The callback may well write the memory we read from */
+		if (ctx->readGen[page])
+			(*ctx->readGen[page])++;
+	}
 }
 
 
@@ -146,8 +183,11 @@ static void write16 (Z80Context* ctx, ushort addr, ushort val)
 
 static byte read8 (Z80Context* ctx, ushort addr)
 {
+	byte* p = ctx->readPage[addr >> Z80_PAGE_SHIFT];
 	ctx->tstates += 3;
-	return ctx->memRead(ctx->memParam, addr);	
+	if (p)
+		return p[addr & (Z80_PAGE_SIZE - 1)];
+	return ctx->memRead(ctx->memParam, addr);
 }
 
 
@@ -211,7 +251,7 @@ static int getFlag(Z80Context* ctx, Z80Flags flag)
  * --------------------------------------------------------- 
  */
 
-static int parityBit[256] = { 
+static const byte parityBit[256] = { 
 	1, 0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1,
 	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 
 	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 
@@ -237,17 +277,34 @@ static void adjustFlags (Z80Context* ctx, byte val)
 }
 
 
+#ifndef Z80_REFERENCE_FLAGS
+/* Precomputed flags. Build with -DZ80_REFERENCE_FLAGS to compute them bit by
+   bit instead, which is useful for checking the tables against zexall */
+static byte flagsSZP[256];		/* S Z 5 3 P for a value */
+static byte flagsInc[256];		/* S Z 5 H 3 V N after INC of the index */
+static byte flagsDec[256];		/* and after DEC */
+static byte flagsAdd[2][65536];		/* A + value + carry, indexed A << 8 | value */
+static byte flagsSub[2][65536];		/* A - value - carry */
+static int flagTablesBuilt;
+#endif
+
+
 static void adjustFlagSZP (Z80Context* ctx, byte val)
 {
+#ifdef Z80_REFERENCE_FLAGS
 	VALFLAG(F_S, (val & 0x80) != 0);
 	VALFLAG(F_Z, (val == 0));
 	VALFLAG(F_PV, parityBit[val]);
+#else
+	BR.F = (BR.F & ~(F_S | F_Z | F_PV)) | (flagsSZP[val] & (F_S | F_Z | F_PV));
+#endif
 }
 
 
 /* Adjust flags after AND, OR, XOR */
 static void adjustLogicFlag (Z80Context* ctx, int flagH)
 {
+#ifdef Z80_REFERENCE_FLAGS
     VALFLAG(F_S, (BR.A & 0x80) != 0);
     VALFLAG(F_Z, (BR.A == 0));
     VALFLAG(F_H, flagH);
@@ -256,6 +313,9 @@ static void adjustLogicFlag (Z80Context* ctx, int flagH)
     VALFLAG(F_PV, parityBit[BR.A]);
 
     adjustFlags(ctx, BR.A);
+#else
+    BR.F = flagsSZP[BR.A] | (flagH ? F_H : 0);
+#endif
 }
 
 
@@ -328,7 +388,7 @@ static int doComplement(byte v)
 
  
 /** Do an arithmetic operation (ADD, SUB, ADC, SBC y CP) */
-static byte doArithmetic (Z80Context* ctx, byte value, int withCarry, int isSub)
+static byte refArithmetic (Z80Context* ctx, byte value, int withCarry, int isSub)
 {
 	ushort res; /* To detect carry */
 
@@ -366,6 +426,27 @@ static byte doArithmetic (Z80Context* ctx, byte value, int withCarry, int isSub)
 }
 
 
+static byte doArithmetic (Z80Context* ctx, byte value, int withCarry, int isSub)
+{
+#ifdef Z80_REFERENCE_FLAGS
+	return refArithmetic(ctx, value, withCarry, isSub);
+#else
+	int carry = withCarry && GETFLAG(F_C);
+	ushort idx = (BR.A << 8) | value;
+	byte res;
+
+	if (isSub) {
+		res = BR.A - value - carry;
+		BR.F = flagsSub[carry][idx];
+	} else {
+		res = BR.A + value + carry;
+		BR.F = flagsAdd[carry][idx];
+	}
+	return res;
+#endif
+}
+
+
 /* Do a 16-bit addition, setting the appropriate flags. */
 static ushort doAddWord(Z80Context* ctx, ushort a1, ushort a2, int withCarry, int isSub)
 {
@@ -468,7 +549,7 @@ static byte doSetRes (Z80Context* ctx, int bit, int pos, byte val)
 
 
 
-static byte doIncDec (Z80Context* ctx, byte val, int isDec)
+static byte refIncDec (Z80Context* ctx, byte val, int isDec)
 {
     if (isDec)
     {
@@ -493,6 +574,61 @@ static byte doIncDec (Z80Context* ctx, byte val, int isDec)
 }
 
 
+static byte doIncDec (Z80Context* ctx, byte val, int isDec)
+{
+#ifdef Z80_REFERENCE_FLAGS
+	return refIncDec(ctx, val, isDec);
+#else
+	if (isDec) {
+		BR.F = (BR.F & F_C) | flagsDec[val];
+		return val - 1;
+	}
+	BR.F = (BR.F & F_C) | flagsInc[val];
+	return val + 1;
+#endif
+}
+
+
+#ifndef Z80_REFERENCE_FLAGS
+/* Fill the flag tables by running the reference code over every input */
+static void buildFlagTables(void)
+{
+	Z80Context tmp;
+	Z80Context* ctx = &tmp;
+	unsigned a, v, c;
+
+	if (flagTablesBuilt)
+		return;
+	memset(&tmp, 0, sizeof(tmp));
+	for (v = 0; v < 256; v++) {
+		BR.F = 0;
+		adjustFlags(ctx, v);
+		flagsSZP[v] = BR.F | (v & F_S) | (v ? 0 : F_Z) | (parityBit[v] ? F_PV : 0);
+		BR.F = 0;
+		refIncDec(ctx, v, ID_INC);
+		flagsInc[v] = BR.F;
+		BR.F = 0;
+		refIncDec(ctx, v, ID_DEC);
+		flagsDec[v] = BR.F;
+	}
+	for (c = 0; c < 2; c++) {
+		for (a = 0; a < 256; a++) {
+			for (v = 0; v < 256; v++) {
+				BR.A = a;
+				BR.F = c ? F_C : 0;
+				refArithmetic(ctx, v, 1, 0);
+				flagsAdd[c][(a << 8) | v] = BR.F;
+				BR.F = c ? F_C : 0;
+				refArithmetic(ctx, v, 1, 1);
+				flagsSub[c][(a << 8) | v] = BR.F;
+			}
+		}
+	}
+	flagTablesBuilt = 1;
+}
+#endif
+
+
 static byte doRLC (Z80Context* ctx, int adjFlags, byte val)
 {
     VALFLAG(F_C, (val & 0x80) != 0);
@@ -659,6 +795,38 @@ static void doDAA(Z80Context * ctx) {
  */ 
 
 
+/* Fetch an opcode or prefix byte (an M1 cycle) */
+static byte fetchOpcode(Z80Context* ctx, int offset)
+{
+	byte opcode;
+
+	if (ctx->exec_int_vector)
+	{
+		opcode = ctx->int_vector;
+		ctx->tstates += 6;
+	}
+	else
+	{
+#ifdef Z80_FAST
+		opcode = read8(ctx, ctx->PC + offset);
+#else
+		ctx->M1 = 1;
+		opcode = read8(ctx, ctx->PC + offset);
+		ctx->M1 = 0;
+#endif
+		ctx->PC++;
+		ctx->tstates += 1;
+	}
+
+	INCR;
+	return opcode;
+}
+
+
+/* The flat switch interpreter generated from the same specification */
+#include "codegen/opcodes_switch.c"
+
+
 static void do_execute(Z80Context* ctx)
 {
 	const struct Z80OpcodeTable* current = &opcodes_main;
@@ -671,27 +839,12 @@ static void do_execute(Z80Context* ctx)
 
 	do
 	{
-		if (ctx->exec_int_vector)
-		{
-			opcode = ctx->int_vector;
-			ctx->tstates += 6;
-		}
-		else
-		{
-			ctx->M1 = 1;
-			opcode = read8(ctx, ctx->PC + offset);
-			ctx->M1 = 0;
-			ctx->PC++;
-			ctx->tstates += 1;
-		}
-
-		INCR;
+		opcode = fetchOpcode(ctx, offset);
 		func = entries[opcode].func;
 		if (func != NULL)
 		{			
 			ctx->PC -= offset;
-			if (ctx->trace)
-				ctx->trace(ctx->memParam);
+			TRACE_OPCODE();
 			func(ctx);
 			ctx->PC += offset;
 			break;
@@ -714,6 +867,544 @@ static void do_execute(Z80Context* ctx)
 }
 
 
+static void execute_opcode(Z80Context* ctx)
+{
+	if (ctx->engine == Z80_ENGINE_TABLE)
+		do_execute(ctx);
+	else
+		do_execute_switch(ctx);
+}
+
+
+/* ---------------------------------------------------------
+ *  Block repeat instructions (LDIR, CPIR, INIR, OTIR and the
+ *  decrementing forms)
+ * ---------------------------------------------------------
+ */
+
+#define PAGE_MASK	(Z80_PAGE_SIZE - 1)
+
+/* Return the host pointer for a mapped address or NULL */
+static byte* readHost(Z80Context* ctx, ushort addr)
+{
+	byte* p = ctx->readPage[addr >> Z80_PAGE_SHIFT];
+	return p ? p + (addr & PAGE_MASK) : NULL;
+}
+
+static byte* writeHost(Z80Context* ctx, ushort addr)
+{
+	byte* p = ctx->writePage[addr >> Z80_PAGE_SHIFT];
+	return p ? p + (addr & PAGE_MASK) : NULL;
+}
+
+/* Bytes from addr to the end of its page in the direction of travel */
+static unsigned pageRoom(ushort addr, int down)
+{
+	if (down)
+		return (addr & PAGE_MASK) + 1;
+	return Z80_PAGE_SIZE - (addr & PAGE_MASK);
+}
+
+/* Work out how many LDIR/LDDR/CPIR/CPDR iterations can be done in one go.
+   These are always followed by one normal iteration which sets the flags,
+   so the count never includes the final iteration or one the t-state budget
+   would not start. Everything must be in mapped pages so there are no
+   callbacks to miss. */
+static unsigned blockChunk(Z80Context* ctx, byte op, unsigned n, byte* o0, byte* o1)
+{
+	int down = op & 0x08;
+	unsigned count = WR.BC ? WR.BC : 0x10000;
+	unsigned j, i;
+	byte* s;
+	byte* d;
+
+	if (n <= 1 || count <= 1)
+		return 0;
+	j = n - 1;
+	if (j > count - 1)
+		j = count - 1;
+	if (j > pageRoom(WR.HL, down))
+		j = pageRoom(WR.HL, down);
+	s = readHost(ctx, WR.HL);
+	if (s == NULL)
+		return 0;
+
+	if (op & 0x01) {
+		/* CPIR/CPDR: stop before the byte that matches */
+		if (!down) {
+			d = memchr(s, BR.A, j);
+			if (d)
+				j = d - s;
+		} else {
+			for (i = 0; i < j; i++)
+				if (s[-(int)i] == BR.A)
+					break;
+			j = i;
+		}
+		return j;
+	}
+
+	/* LDIR/LDDR */
+	if (j > pageRoom(WR.DE, down))
+		j = pageRoom(WR.DE, down);
+	d = writeHost(ctx, WR.DE);
+	if (d == NULL)
+		return 0;
+	Z80NoteWrite(ctx, WR.DE);
+	if (!down) {
+		/* Don't overwrite our own instruction */
+		if ((o0 >= d && o0 < d + j) || (o1 >= d && o1 < d + j))
+			return 0;
+		/* Overlapping forward copies replicate the pattern */
+		if (d > s && d < s + j) {
+			for (i = 0; i < j; i++)
+				d[i] = s[i];
+		} else
+			memmove(d, s, j);
+	} else {
+		if ((o0 <= d && o0 > d - j) || (o1 <= d && o1 > d - j))
+			return 0;
+		if (d < s && d > s - j) {
+			for (i = 0; i < j; i++)
+				d[-(int)i] = s[-(int)i];
+		} else
+			memmove(d - j + 1, s - j + 1, j);
+	}
+	if (down)
+		WR.DE -= j;
+	else
+		WR.DE += j;
+	return j;
+}
+
+/* Work out how many INIR/OTIR iterations the board can do in one go
+   through its bulk I/O hooks. As with blockChunk the final iteration is
+   left to set the flags. The port is BC as it is for the first of them;
+   the hook must only take the transfer if its decode ignores B. */
+static unsigned ioChunk(Z80Context* ctx, byte op, unsigned n, byte* o0, byte* o1)
+{
+	unsigned count = BR.B ? BR.B : 0x100;
+	unsigned j;
+	byte* p;
+
+	if ((op & 0x08) || n <= 1 || count <= 1)
+		return 0;
+	j = n - 1;
+	if (j > count - 1)
+		j = count - 1;
+	if (j > pageRoom(WR.HL, 0))
+		j = pageRoom(WR.HL, 0);
+	if (op & 0x01) {
+		/* OTIR */
+		p = readHost(ctx, WR.HL);
+		if (p == NULL || ctx->ioBlockOut == NULL)
+			return 0;
+		j = ctx->ioBlockOut(ctx->ioParam, WR.BC, p, j);
+	} else {
+		/* INIR */
+		p = writeHost(ctx, WR.HL);
+		if (p == NULL || ctx->ioBlockIn == NULL)
+			return 0;
+		if ((o0 >= p && o0 < p + j) || (o1 >= p && o1 < p + j))
+			return 0;
+		j = ctx->ioBlockIn(ctx->ioParam, WR.BC, p, j);
+		if (j)
+			Z80NoteWrite(ctx, WR.HL);
+	}
+	BR.B -= j;
+	return j;
+}
+
+/* Run further iterations of a block repeat instruction at PC. This does
+   exactly what repeated calls to Z80Execute would do until the budget is
+   used (a device can cut it short with Z80EndSlice), an interrupt is due,
+   the instruction completes or something we can't see into (an unmapped
+   opcode fetch) comes up. */
+static void doBlockRepeat(Z80Context* ctx)
+{
+	byte* o0;
+	byte* o1;
+	byte op;
+	unsigned j;
+	Z80OpcodeFunc func;
+	int more;
+
+	while (ctx->tstates < ctx->slice_end) {
+		if (ctx->nmi_req || (ctx->int_req && !ctx->defer_int && ctx->IFF1))
+			return;
+		if (ctx->exec_int_vector)
+			return;
+		o0 = readHost(ctx, ctx->PC);
+		o1 = readHost(ctx, ctx->PC + 1);
+		if (o0 == NULL || o1 == NULL || *o0 != 0xED)
+			return;
+		op = *o1;
+		if ((op & 0xF4) != 0xB0)
+			return;
+
+		/* Memory to memory forms can skip ahead when nobody is watching,
+		   and so can I/O ones the board will do in bulk */
+		if (!TRACING()) {
+			if (op & 0x02)
+				j = ioChunk(ctx, op, (ctx->slice_end - ctx->tstates + 20) / 21, o0, o1);
+			else
+				j = blockChunk(ctx, op, (ctx->slice_end - ctx->tstates + 20) / 21, o0, o1);
+			if (j) {
+				ctx->instructions += j;
+				if (op & 0x08)
+					WR.HL -= j;
+				else
+					WR.HL += j;
+				/* ioChunk has counted B down itself */
+				if (!(op & 0x02))
+					WR.BC -= j;
+				ctx->tstates += 21 * j;
+				ctx->R = (ctx->R & 0x80) | ((ctx->R + 2 * j) & 0x7f);
+			}
+		}
+
+		/* One normal iteration as Z80Execute would do it */
+		ctx->instructions++;
+		ctx->defer_int = 0;
+		ctx->M1PC = ctx->PC;
+		ctx->tstates += 8;
+		INCR;
+		INCR;
+		ctx->PC += 2;
+		TRACE_OPCODE();
+		func = opcodes_ED.entries[op & ~0x10].func;
+		func(ctx);
+		if (op & 0x02)
+			more = BR.B != 0;
+		else if (op & 0x01)
+			more = WR.BC != 0 && !GETFLAG(F_Z);
+		else
+			more = WR.BC != 0;
+		if (!more)
+			return;
+		ctx->tstates += 5;
+		ctx->PC -= 2;
+	}
+}
+
+
+/* While halted the CPU just refetches the HALT every 4 clocks until an
+   interrupt, so jump to the end of the budget instead. */
+static void doHaltSkip(Z80Context* ctx, unsigned limit)
+{
+	unsigned n;
+
+	if (ctx->nmi_req || (ctx->int_req && ctx->IFF1))
+		return;
+	if (ctx->exec_int_vector || TRACING() || ctx->tstates >= limit)
+		return;
+	n = (limit - ctx->tstates + 3) / 4;
+	ctx->tstates += 4 * n;
+	ctx->R = (ctx->R & 0x80) | ((ctx->R + n) & 0x7f);
+	ctx->M1PC = ctx->PC;
+	ctx->defer_int = 0;
+}
+
+
+/* ---------------------------------------------------------
+ *  Block cache engine
+ * ---------------------------------------------------------
+ *
+ * Runs of instructions from mapped pages are decoded once into blocks of
+ * handler pointers along with their fetch cost. A block is only valid while
+ * the same host page is mapped and its write generation has not moved on.
+ * If it has moved on the opcode bytes are compared again, so data sharing a
+ * page with code does not keep forcing a decode.
+ */
+
+#define BLOCK_OPS	32
+#define BLOCK_HASH	4096
+#define GEN_HASH	4096
+#define GEN_PROBE	16
+
+struct Z80BlockOp
+{
+	Z80OpcodeFunc func;	/* NULL for an undefined opcode (NOP) */
+	ushort addr;
+	byte pre;		/* PC advance before the handler */
+	byte post;		/* and after it (DDCB/FDCB) */
+	byte tstates;		/* Fetch cost */
+	byte r;			/* R increments */
+	byte len;		/* Opcode bytes */
+	byte code[4];
+};
+
+/* Translated block: returns the number of instructions it executed */
+typedef int (*Z80NativeFunc)(Z80Context* ctx, unsigned limit);
+
+struct Z80Block
+{
+	byte* host;		/* Host page the code came from */
+	unsigned* gen;		/* Write generation of that page */
+	unsigned genval;
+	ushort pc;
+	byte n;
+	unsigned hits;		/* Entries since it was decoded (JIT) */
+	Z80NativeFunc native;	/* Translation, if any */
+	unsigned nativeGen;	/* genval it was translated for */
+	unsigned nativeEpoch;	/* code buffer generation */
+	struct Z80BlockOp ops[BLOCK_OPS];
+};
+
+struct Z80PageGen
+{
+	byte* host;
+	unsigned gen;
+};
+
+struct Z80BlockCache
+{
+	struct Z80Block blocks[BLOCK_HASH];
+	struct Z80PageGen gens[GEN_HASH];
+	unsigned overflow;	/* Shared by pages that don't fit in gens */
+	byte* code;		/* JIT code buffer */
+	unsigned codeUsed;
+	unsigned codeEpoch;	/* Bumped each time the buffer is reused */
+};
+
+
+#ifndef Z80_FAST
+/* Find the write generation counter for a host page. Aliases of the same
+   memory share a counter */
+static unsigned* genFor(struct Z80BlockCache* cache, byte* host)
+{
+	unsigned h, i;
+	struct Z80PageGen* g;
+
+	if (host == NULL)
+		return NULL;
+	h = (unsigned)((unsigned long)host >> Z80_PAGE_SHIFT);
+	for (i = 0; i < GEN_PROBE; i++) {
+		g = &cache->gens[(h + i) & (GEN_HASH - 1)];
+		if (g->host == host)
+			return &g->gen;
+		if (g->host == NULL) {
+			g->host = host;
+			return &g->gen;
+		}
+	}
+	return &cache->overflow;
+}
+
+
+static void setPageGens(Z80Context* ctx, unsigned page)
+{
+	struct Z80BlockCache* cache = ctx->blockCache;
+
+	if (cache == NULL) {
+		ctx->readGen[page] = NULL;
+		ctx->writeGen[page] = NULL;
+		return;
+	}
+	ctx->readGen[page] = genFor(cache, ctx->readPage[page]);
+	ctx->writeGen[page] = genFor(cache, ctx->writePage[page]);
+}
+#endif
+
+
+/* Instructions the block engine leaves to Z80ExecuteTStates */
+static int blockStop(Z80OpcodeFunc func)
+{
+	int i;
+
+	if (func == NULL)
+		return 0;
+	if (func == opcodes_main.entries[0x76].func)
+		return 1;
+	for (i = 0xB0; i < 0xBC; i++)
+		if (func == opcodes_ED.entries[i].func)
+			return 1;
+	return 0;
+}
+
+
+/* Decode the instruction at PC the way do_execute would fetch it */
+static int decodeOp(Z80Context* ctx, byte* host, unsigned page, struct Z80BlockOp* op)
+{
+	const struct Z80OpcodeTable* current = &opcodes_main;
+	const struct Z80OpcodeEntry* e;
+	unsigned off = ctx->PC & PAGE_MASK;
+	unsigned pos = 0;
+	unsigned offset = 0;
+	unsigned at;
+
+	if ((ctx->PC >> Z80_PAGE_SHIFT) != page)
+		return 0;
+	op->tstates = 0;
+	op->r = 0;
+	for (;;) {
+		at = off + pos + offset;
+		if (at >= Z80_PAGE_SIZE)
+			return 0;
+		e = &current->entries[host[at]];
+		pos++;
+		op->tstates += 4;
+		op->r++;
+		if (e->func != NULL || e->table == NULL)
+			break;
+		current = e->table;
+		offset = current->opcode_offset;
+		if (offset > 0)
+			op->r--;
+	}
+	if (blockStop(e->func))
+		return 0;
+	op->func = e->func;
+	op->addr = ctx->PC;
+	op->len = pos + offset;
+	memcpy(op->code, host + off, op->len);
+	if (op->func) {
+		op->pre = pos - offset;
+		op->post = offset;
+	} else {
+		op->pre = pos;
+		op->post = 0;
+	}
+	return 1;
+}
+
+
+/* The page was written: see if the code itself is still the same */
+static int blockCheck(struct Z80Block* b)
+{
+	int i;
+	struct Z80BlockOp* op = b->ops;
+
+	for (i = 0; i < b->n; i++, op++)
+		if (memcmp(b->host + (op->addr & PAGE_MASK), op->code, op->len))
+			return 0;
+	b->genval = *b->gen;
+	return 1;
+}
+
+
+#ifdef Z80_JIT
+#include "z80jit.c"
+#endif
+
+
+/* Run one cached block, decoding it first if need be. Anything the cache
+   can't handle goes through Z80Execute. */
+static void runBlock(Z80Context* ctx, unsigned limit)
+{
+	struct Z80BlockCache* cache = ctx->blockCache;
+	unsigned page = ctx->PC >> Z80_PAGE_SHIFT;
+	byte* host = ctx->readPage[page];
+	struct Z80Block* b;
+	struct Z80BlockOp* op;
+	int record;
+	int i;
+
+	if (host == NULL || ctx->halted || ctx->exec_int_vector || ctx->nmi_req ||
+		(ctx->int_req && !ctx->defer_int && ctx->IFF1)) {
+		Z80Execute(ctx);
+		return;
+	}
+
+	b = &cache->blocks[ctx->PC & (BLOCK_HASH - 1)];
+	record = b->pc != ctx->PC || b->host != host || b->n == 0;
+	if (!record && *b->gen != b->genval) {
+		/* Written since: don't translate it again until it settles */
+		record = !blockCheck(b);
+		b->hits = 0;
+	}
+	if (record) {
+		b->pc = ctx->PC;
+		b->host = host;
+		b->gen = ctx->readGen[page];
+		b->genval = *b->gen;
+		b->n = 0;
+		b->hits = 0;
+		b->native = NULL;
+	}
+#ifdef Z80_JIT
+	else if (ctx->engine == Z80_ENGINE_JIT) {
+		if (jitReady(cache, b) || (++b->hits >= JIT_HOT && jitCompile(cache, b))) {
+			ctx->instructions += b->native(ctx, limit);
+			return;
+		}
+	}
+#endif
+
+	for (i = 0; ; i++) {
+		if (i) {
+			if (ctx->tstates >= limit || ctx->nmi_req ||
+				(ctx->int_req && !ctx->defer_int && ctx->IFF1))
+				break;
+			if (ctx->readPage[page] != host)
+				break;
+			if (*b->gen != b->genval && !blockCheck(b))
+				break;
+		}
+		if (record) {
+			if (i == BLOCK_OPS || !decodeOp(ctx, host, page, &b->ops[i]))
+				break;
+			b->n = i + 1;
+		} else if (i == b->n || b->ops[i].addr != ctx->PC)
+			break;
+
+		op = &b->ops[i];
+		ctx->defer_int = 0;
+		ctx->M1PC = ctx->PC;
+		ctx->tstates += op->tstates;
+		ctx->R = (ctx->R & 0x80) | ((ctx->R + op->r) & 0x7f);
+		ctx->PC += op->pre;
+		if (op->func) {
+			TRACE_OPCODE();
+			op->func(ctx);
+			ctx->PC += op->post;
+		}
+		/* Stop recording at a loop back onto itself */
+		if (record && ctx->PC == op->addr) {
+			i++;
+			break;
+		}
+	}
+	if (i == 0)
+		Z80Execute(ctx);
+	else
+		ctx->instructions += i;
+}
+
+
+/* Setting up and freeing are left to the normal build */
+#ifndef Z80_FAST
+static void freeBlockCache(Z80Context* ctx)
+{
+	unsigned page;
+
+#ifdef Z80_JIT
+	if (ctx->blockCache)
+		jitFree(ctx->blockCache);
+#endif
+	free(ctx->blockCache);
+	ctx->blockCache = NULL;
+	for (page = 0; page < Z80_PAGES; page++)
+		setPageGens(ctx, page);
+}
+
+
+static int allocBlockCache(Z80Context* ctx)
+{
+	unsigned page;
+
+	if (ctx->blockCache)
+		return 0;
+	ctx->blockCache = calloc(1, sizeof(struct Z80BlockCache));
+	if (ctx->blockCache == NULL)
+		return -1;
+	for (page = 0; page < Z80_PAGES; page++)
+		setPageGens(ctx, page);
+	return 0;
+}
+#endif
+
+
 static void unhalt(Z80Context* ctx)
 {
     if (ctx->halted)
@@ -745,7 +1436,7 @@ static void do_int(Z80Context* ctx)
     if (ctx->IM == 0)
     {
 		ctx->exec_int_vector = 1;
-		do_execute(ctx);
+		execute_opcode(ctx);
 		ctx->exec_int_vector = 0;
     }
     else if (ctx->IM == 1)
@@ -773,20 +1464,122 @@ void Z80Execute (Z80Context* ctx)
 	else
 	{
 		ctx->defer_int = 0;
-		do_execute(ctx);
+		ctx->instructions++;
+		execute_opcode(ctx);
 	}
 }
 
 
 unsigned Z80ExecuteTStates(Z80Context* ctx, unsigned tstates)
 {
+	unsigned last;
+
 	ctx->tstates = 0;
-	while (ctx->tstates < tstates)
-		Z80Execute(ctx);
+	ctx->slice_end = tstates;
+	while (ctx->tstates < ctx->slice_end) {
+		last = ctx->tstates;
+		if (ctx->engine >= Z80_ENGINE_BLOCK)
+			runBlock(ctx, ctx->slice_end);
+		else
+			Z80Execute(ctx);
+		/* An instruction going round again: either a HALT (4 clocks) or
+		   a block instruction which can be run in bulk */
+		if (ctx->PC == ctx->M1PC) {
+			if (ctx->halted && ctx->tstates - last == 4)
+				doHaltSkip(ctx, ctx->slice_end);
+			else
+				doBlockRepeat(ctx);
+		}
+	}
 	return ctx->tstates;
 }
 
 
+#ifdef Z80_FAST
+
+void Z80FastInit(void)
+{
+#ifndef Z80_REFERENCE_FLAGS
+	buildFlagTables();
+#endif
+}
+
+#else
+
+int Z80SetEngine(Z80Context* ctx, int engine)
+{
+	switch (engine)
+	{
+	case Z80_ENGINE_SWITCH:
+	case Z80_ENGINE_TABLE:
+		freeBlockCache(ctx);
+		ctx->engine = engine;
+		return 0;
+	case Z80_ENGINE_BLOCK:
+		if (allocBlockCache(ctx))
+			return -1;
+		ctx->engine = engine;
+		return 0;
+#ifdef Z80_JIT
+	case Z80_ENGINE_JIT:
+		if (allocBlockCache(ctx))
+			return -1;
+		if (jitInit(ctx->blockCache)) {
+			freeBlockCache(ctx);
+			return -1;
+		}
+		ctx->engine = engine;
+		return 0;
+#endif
+	}
+	return -1;
+}
+
+
+int Z80EngineByName(const char* name)
+{
+	if (strcmp(name, "switch") == 0)
+		return Z80_ENGINE_SWITCH;
+	if (strcmp(name, "table") == 0)
+		return Z80_ENGINE_TABLE;
+	if (strcmp(name, "block") == 0)
+		return Z80_ENGINE_BLOCK;
+	if (strcmp(name, "jit") == 0)
+		return Z80_ENGINE_JIT;
+	return -1;
+}
+
+
+void Z80InvalidateCode(Z80Context* ctx)
+{
+	struct Z80BlockCache* cache = ctx->blockCache;
+	unsigned i;
+
+	if (cache == NULL)
+		return;
+	for (i = 0; i < GEN_HASH; i++)
+		cache->gens[i].gen++;
+	cache->overflow++;
+}
+
+void Z80NoteWrite(Z80Context* ctx, ushort addr)
+{
+	unsigned page = addr >> Z80_PAGE_SHIFT;
+
+	/* As write8 does for a mapped page or the callback */
+	if (ctx->writeGen[page])
+		(*ctx->writeGen[page])++;
+	if (ctx->readGen[page])
+		(*ctx->readGen[page])++;
+}
+
+void Z80EndSlice(Z80Context* ctx, unsigned tstates)
+{
+	if (tstates < ctx->slice_end)
+		ctx->slice_end = tstates;
+}
+
+
 void Z80Debug (Z80Context* ctx, char* dump, char* decode)
 {
 	char tmp[20];	
@@ -862,6 +1655,11 @@ void Z80Debug (Z80Context* ctx, char* dump, char* decode)
 
 void Z80RESET (Z80Context* ctx)
 {
+#ifndef Z80_REFERENCE_FLAGS
+	buildFlagTables();
+#endif
+	/* The fast copy has tables of its own */
+	Z80FastInit();
 	ctx->PC = 0x0000;
 	BR.F = 0;
 	ctx->IM = 0;
@@ -878,6 +1676,30 @@ void Z80RESET (Z80Context* ctx)
 }
 
 
+void Z80MapPages(Z80Context* ctx, ushort addr, unsigned len, byte* read, byte* write)
+{
+	unsigned page = addr >> Z80_PAGE_SHIFT;
+	unsigned off = 0;
+
+	while (off < len && page < Z80_PAGES) {
+		ctx->readPage[page] = read ? read + off : NULL;
+		ctx->writePage[page] = write ? write + off : NULL;
+		setPageGens(ctx, page);
+		off += Z80_PAGE_SIZE;
+		page++;
+	}
+}
+
+
+void Z80UnmapPages(Z80Context* ctx)
+{
+	memset(ctx->readPage, 0, sizeof(ctx->readPage));
+	memset(ctx->writePage, 0, sizeof(ctx->writePage));
+	memset(ctx->readGen, 0, sizeof(ctx->readGen));
+	memset(ctx->writeGen, 0, sizeof(ctx->writeGen));
+}
+
+
 void Z80INT (Z80Context* ctx, byte value)
 {
 	ctx->int_req = 1;
@@ -905,3 +1727,5 @@ void Z80NMI_Clear(Z80Context *ctx)
 {
 	ctx->nmi_low = 0;
 }
+
+#endif	/* Z80_FAST */
@@ -77,6 +77,22 @@ typedef enum
 } Z80Flags;
 #endif
 
+/** The available execution engines */
+typedef enum
+{
+	Z80_ENGINE_SWITCH = 0,	/**< Flat switch interpreter (default) */
+	Z80_ENGINE_TABLE = 1,	/**< Opcode table walking interpreter */
+	Z80_ENGINE_BLOCK = 2,	/**< Cache of decoded blocks (mapped pages only) */
+	Z80_ENGINE_JIT = 3	/**< Block cache with hot blocks translated to
+				     native code (x86-64 only) */
+} Z80Engine;
+
+/** The address space is split into pages which may be mapped directly onto
+ * host memory */
+#define Z80_PAGE_SHIFT	10
+#define Z80_PAGE_SIZE	(1 << Z80_PAGE_SHIFT)
+#define Z80_PAGES	(0x10000 >> Z80_PAGE_SHIFT)
+
 /** A Z80 execution context. */
 typedef struct
 {
@@ -89,7 +105,8 @@ typedef struct
 	byte	IFF1;	/**< Interrupt Flipflop 1 */
 	byte	IFF2;	/**< Interrupt Flipflop 2 */
 	byte	IM;		/**< Instruction mode */
-	byte	M1;		/**< M1 line state (only for ifetch) */
+	byte	M1;		/**< M1 line state (only for ifetch, not kept up by
+				     Z80ExecuteFast/Z80ExecuteTStatesFast) */
 	
 	Z80DataIn	memRead;
 	Z80DataOut	memWrite;
@@ -101,6 +118,22 @@ typedef struct
 	
 	byte		halted;
 	unsigned	tstates;
+	/** Instructions run, for statistics. The core only ever adds to it.
+	 * A HALT waiting in bulk for an interrupt does not count */
+	unsigned long	instructions;
+
+	byte		engine;		/**< Execution engine in use (Z80Engine) */
+
+	/** Host memory backing each page for reads and writes. A NULL entry
+	 * means the access goes via memRead/memWrite. Set with Z80MapPages */
+	byte*		readPage[Z80_PAGES];
+	byte*		writePage[Z80_PAGES];
+
+	/** Write generation of the memory behind each page, only kept when
+	 * the block engine is in use */
+	unsigned*	readGen[Z80_PAGES];
+	unsigned*	writeGen[Z80_PAGES];
+	void*		blockCache;
 
 	/* Below are implementation details which may change without
 	 * warning; they should not be relied upon by any user of this
@@ -138,6 +171,19 @@ typedef struct
 
 	void (*trace)(unsigned int memparam);
 
+	/* Called with ioParam when a RETI (ED 4D) is executed, before the
+	 * return. Peripherals in an IM2 daisy chain watch for this. */
+	void (*on_reti)(int ioparam);
+
+	/* Optional bulk I/O for INIR and OTIR. Move up to n bytes as that
+	 * many reads or writes of port would and return how many were
+	 * moved, or 0 to have them done one at a time. */
+	unsigned (*ioBlockIn)(int ioparam, ushort port, byte* buf, unsigned n);
+	unsigned (*ioBlockOut)(int ioparam, ushort port, const byte* buf, unsigned n);
+
+	/* Where the Z80ExecuteTStates in progress stops, see Z80EndSlice */
+	unsigned slice_end;
+
 } Z80Context;
 
 
@@ -146,9 +192,57 @@ void Z80Execute (Z80Context* ctx);
 
 /** Execute enough instructions to use at least tstates cycles.
  * Returns the number of tstates actually executed.  Note: Resets
- * ctx->tstates.*/
+ * ctx->tstates. Block repeat instructions running from mapped pages are
+ * done several iterations at a time here, with the same end result. A HALT
+ * with no interrupt pending uses up the rest of the budget at once, without
+ * refetching the opcode through memRead. Neither happens if trace is set. */
 unsigned Z80ExecuteTStates(Z80Context* ctx, unsigned tstates);
 
+/** The same as Z80Execute and Z80ExecuteTStates but from a build of the
+ * core with the trace hook left out. ctx->trace is ignored. The rest of the
+ * context is shared so a machine can switch between the two at any point,
+ * for example only using the plain ones while tracing. */
+void Z80ExecuteFast (Z80Context* ctx);
+unsigned Z80ExecuteTStatesFast(Z80Context* ctx, unsigned tstates);
+
+/** Called from a memory or I/O callback during Z80ExecuteTStates to have it
+ * return once tstates (counted from the start of the call) have run, if
+ * that is sooner than it was asked for. The instruction or cached block in
+ * progress is finished first. */
+void Z80EndSlice(Z80Context* ctx, unsigned tstates);
+
+/** Select the execution engine. All engines give identical results, the
+ * table one is kept as a reference. The block engine only caches code in
+ * mapped pages and only from Z80ExecuteTStates.
+ * Returns 0 on success or -1 if the engine is not known or can't be set up. */
+int Z80SetEngine(Z80Context* ctx, int engine);
+
+/** Look up an engine by name ("switch", "table", "block" or "jit").
+ * Returns -1 if there is no such engine. */
+int Z80EngineByName(const char* name);
+
+/** Tell the block engine that mapped memory was changed behind its back
+ * (eg loaded directly by the emulator). Writes made by the CPU are
+ * tracked already. */
+void Z80InvalidateCode(Z80Context* ctx);
+
+/** Tell the block engine that the byte at addr was written other than by
+ * the CPU (eg by DMA or an emulated device filling memory). Cheaper than
+ * Z80InvalidateCode as only code from that page is checked again. */
+void Z80NoteWrite(Z80Context* ctx, ushort addr);
+
+/** Map host memory directly into the address space so that accesses to
+ * the range do not go through the memRead/memWrite callbacks. addr and len
+ * must be multiples of Z80_PAGE_SIZE. read or write may be NULL to send
+ * that kind of access to the callback instead (eg for ROM pass write as
+ * NULL and ignore the write in memWrite). Z80RESET does not touch the map.
+ * The caller must remap whenever its banking changes.
+ */
+void Z80MapPages(Z80Context* ctx, ushort addr, unsigned len, byte* read, byte* write);
+
+/** Return the whole address space to the memRead/memWrite callbacks */
+void Z80UnmapPages(Z80Context* ctx);
+
 /** Decode the next instruction to be executed.
  * dump and decode can be NULL if such information is not needed
  *
@@ -157,7 +251,8 @@ unsigned Z80ExecuteTStates(Z80Context* ctx, unsigned tstates);
  */
 void Z80Debug (Z80Context* ctx, char* dump, char* decode);
 
-/** Resets the processor. */
+/** Resets the processor. This must be called before the first instruction is
+ * executed as it also sets up the flag tables. */
 void Z80RESET (Z80Context* ctx);
 
 /** Generates a hardware interrupt.
@@ -0,0 +1,346 @@
+/* =========================================================
+ *  libz80 - x86-64 code generation for the block engine
+ * =========================================================
+ *
+ * Blocks that are entered often are turned into native code. This is a
+ * subroutine threaded translation: the opcode handlers are still the ones
+ * from the tables, but the fetch accounting and the checks between
+ * instructions are done inline so there is no dispatch loop. The register
+ * file stays in the Z80Context. Anything unusual makes the code return to
+ * runBlock with the number of instructions it did, and the interpreter
+ * carries on from there.
+ *
+ * The code buffer is never writable and executable at once. It is mapped
+ * read and execute, and only the pages a block is going into are made
+ * writable while it is generated.
+ *
+ * Included from z80.c.
+ */
+
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define JIT_HOT		16		/* Block entries before translating */
+#define JIT_CODE_SIZE	(8 << 20)
+#define JIT_OP_MAX	256		/* Worst case bytes for one op */
+
+#define CTX(f)		((unsigned)offsetof(Z80Context, f))
+
+struct jit
+{
+	byte* p;
+	unsigned fix[BLOCK_OPS * 8];	/* rel32 exits to patch */
+	byte fixop[BLOCK_OPS * 8];	/* and which op they leave before */
+	unsigned nfix;
+};
+
+static void emit8(struct jit* j, unsigned v)
+{
+	*j->p++ = v;
+}
+
+static void emit16(struct jit* j, unsigned v)
+{
+	emit8(j, v);
+	emit8(j, v >> 8);
+}
+
+static void emit32(struct jit* j, unsigned v)
+{
+	emit16(j, v);
+	emit16(j, v >> 16);
+}
+
+static void emit64(struct jit* j, unsigned long v)
+{
+	emit32(j, v);
+	emit32(j, v >> 32);
+}
+
+/* Emit a jcc rel32 (or jmp if cc is 0) that leaves the block before op i */
+static void emitExit(struct jit* j, byte cc, unsigned i, byte* base)
+{
+	if (cc) {
+		emit8(j, 0x0F);
+		emit8(j, cc);
+	} else
+		emit8(j, 0xE9);
+	j->fix[j->nfix] = j->p - base;
+	j->fixop[j->nfix++] = i;
+	emit32(j, 0);
+}
+
+#define JAE	0x83
+#define JNE	0x85
+
+/* cmp byte [rbx + off], 0 */
+static void emitTestByte(struct jit* j, unsigned off)
+{
+	emit8(j, 0x80);
+	emit8(j, 0xBB);
+	emit32(j, off);
+	emit8(j, 0x00);
+}
+
+/* The checks runBlock makes between instructions */
+static void emitChecks(struct jit* j, struct Z80Block* b, unsigned i, byte* base)
+{
+	struct Z80BlockOp* op = &b->ops[i];
+	unsigned page = b->pc >> Z80_PAGE_SHIFT;
+
+	/* cmp [rbx + tstates], r12d ; jae exit */
+	emit8(j, 0x44);
+	emit8(j, 0x39);
+	emit8(j, 0xA3);
+	emit32(j, CTX(tstates));
+	emitExit(j, JAE, i, base);
+
+	/* NMI, or an interrupt that would be taken */
+	emitTestByte(j, CTX(nmi_req));
+	emitExit(j, JNE, i, base);
+	emitTestByte(j, CTX(int_req));
+	emit8(j, 0x74);			/* je over the next 22 bytes */
+	emit8(j, 22);
+	emitTestByte(j, CTX(defer_int));
+	emit8(j, 0x75);			/* jne over the next 13 bytes */
+	emit8(j, 13);
+	emitTestByte(j, CTX(IFF1));
+	emitExit(j, JNE, i, base);
+
+	/* mov rax, host ; cmp [rbx + readPage[page]], rax ; jne exit */
+	emit8(j, 0x48);
+	emit8(j, 0xB8);
+	emit64(j, (unsigned long)b->host);
+	emit8(j, 0x48);
+	emit8(j, 0x39);
+	emit8(j, 0x83);
+	emit32(j, CTX(readPage) + page * sizeof(byte*));
+	emitExit(j, JNE, i, base);
+
+	/* mov rax, gen ; mov eax, [rax] ; cmp eax, genval ; jne exit */
+	emit8(j, 0x48);
+	emit8(j, 0xB8);
+	emit64(j, (unsigned long)b->gen);
+	emit8(j, 0x8B);
+	emit8(j, 0x00);
+	emit8(j, 0x3D);
+	emit32(j, b->genval);
+	emitExit(j, JNE, i, base);
+
+	/* cmp word [rbx + PC], addr ; jne exit */
+	emit8(j, 0x66);
+	emit8(j, 0x81);
+	emit8(j, 0xBB);
+	emit32(j, CTX(PC));
+	emit16(j, op->addr);
+	emitExit(j, JNE, i, base);
+}
+
+static void emitOp(struct jit* j, struct Z80BlockOp* op)
+{
+	/* mov byte [rbx + defer_int], 0 */
+	emit8(j, 0xC6);
+	emit8(j, 0x83);
+	emit32(j, CTX(defer_int));
+	emit8(j, 0);
+	/* mov word [rbx + M1PC], addr */
+	emit8(j, 0x66);
+	emit8(j, 0xC7);
+	emit8(j, 0x83);
+	emit32(j, CTX(M1PC));
+	emit16(j, op->addr);
+	/* add dword [rbx + tstates], fetch cost */
+	emit8(j, 0x81);
+	emit8(j, 0x83);
+	emit32(j, CTX(tstates));
+	emit32(j, op->tstates);
+	/* R = (R & 0x80) | ((R + r) & 0x7F) */
+	emit8(j, 0x0F);			/* movzx eax, byte [rbx + R] */
+	emit8(j, 0xB6);
+	emit8(j, 0x83);
+	emit32(j, CTX(R));
+	emit8(j, 0x89);			/* mov ecx, eax */
+	emit8(j, 0xC1);
+	emit8(j, 0x81);			/* and ecx, 0x80 */
+	emit8(j, 0xE1);
+	emit32(j, 0x80);
+	emit8(j, 0x83);			/* add eax, r */
+	emit8(j, 0xC0);
+	emit8(j, op->r);
+	emit8(j, 0x83);			/* and eax, 0x7F */
+	emit8(j, 0xE0);
+	emit8(j, 0x7F);
+	emit8(j, 0x09);			/* or eax, ecx */
+	emit8(j, 0xC8);
+	emit8(j, 0x88);			/* mov [rbx + R], al */
+	emit8(j, 0x83);
+	emit32(j, CTX(R));
+	/* mov word [rbx + PC], addr + pre */
+	emit8(j, 0x66);
+	emit8(j, 0xC7);
+	emit8(j, 0x83);
+	emit32(j, CTX(PC));
+	emit16(j, (ushort)(op->addr + op->pre));
+	if (op->func == NULL)
+		return;
+	/* if (ctx->trace) ctx->trace(ctx->memParam). Kept in the Z80_FAST build
+	   too as the two builds share the translated blocks */
+	emit8(j, 0x48);			/* mov rax, [rbx + trace] */
+	emit8(j, 0x8B);
+	emit8(j, 0x83);
+	emit32(j, CTX(trace));
+	emit8(j, 0x48);			/* test rax, rax */
+	emit8(j, 0x85);
+	emit8(j, 0xC0);
+	emit8(j, 0x74);			/* jz over the call */
+	emit8(j, 8);
+	emit8(j, 0x8B);			/* mov edi, [rbx + memParam] */
+	emit8(j, 0xBB);
+	emit32(j, CTX(memParam));
+	emit8(j, 0xFF);			/* call rax */
+	emit8(j, 0xD0);
+	/* func(ctx) */
+	emit8(j, 0x48);			/* mov rdi, rbx */
+	emit8(j, 0x89);
+	emit8(j, 0xDF);
+	emit8(j, 0x48);			/* mov rax, func */
+	emit8(j, 0xB8);
+	emit64(j, (unsigned long)op->func);
+	emit8(j, 0xFF);			/* call rax */
+	emit8(j, 0xD0);
+	if (op->post) {
+		/* add word [rbx + PC], post */
+		emit8(j, 0x66);
+		emit8(j, 0x81);
+		emit8(j, 0x83);
+		emit32(j, CTX(PC));
+		emit16(j, op->post);
+	}
+}
+
+/* Make the pages holding len bytes at p writable, or executable again */
+static int jitProtect(byte* p, unsigned len, int prot)
+{
+	unsigned long page = sysconf(_SC_PAGESIZE);
+	unsigned long start = (unsigned long)p & ~(page - 1);
+	unsigned long end = ((unsigned long)p + len + page - 1) & ~(page - 1);
+
+	return mprotect((void *)start, end - start, prot);
+}
+
+/* A protection change failed part way so nothing in the buffer can be run */
+static int jitLost(struct Z80BlockCache* cache)
+{
+	munmap(cache->code, JIT_CODE_SIZE);
+	cache->code = NULL;
+	cache->codeEpoch++;
+	return 0;
+}
+
+/* Translate a block. Returns 0 if there was no room */
+static int jitCompile(struct Z80BlockCache* cache, struct Z80Block* b)
+{
+	struct jit j;
+	byte* base;
+	byte* epilogue;
+	byte* stub[BLOCK_OPS + 1];
+	unsigned need = 32 + b->n * (JIT_OP_MAX + 16);
+	unsigned i;
+	int rel;
+
+	if (cache->code == NULL)
+		return 0;
+	/* Worst case size, if it won't fit start the buffer again */
+	if (cache->codeUsed + need > JIT_CODE_SIZE) {
+		cache->codeUsed = 0;
+		cache->codeEpoch++;
+	}
+	base = cache->code + cache->codeUsed;
+	if (jitProtect(base, need, PROT_READ | PROT_WRITE))
+		return jitLost(cache);
+	j.p = base;
+	j.nfix = 0;
+
+	emit8(&j, 0x53);		/* push rbx */
+	emit8(&j, 0x41);		/* push r12 */
+	emit8(&j, 0x54);
+	emit8(&j, 0x41);		/* push r13 (keeps the stack aligned) */
+	emit8(&j, 0x55);
+	emit8(&j, 0x48);		/* mov rbx, rdi */
+	emit8(&j, 0x89);
+	emit8(&j, 0xFB);
+	emit8(&j, 0x41);		/* mov r12d, esi */
+	emit8(&j, 0x89);
+	emit8(&j, 0xF4);
+
+	/* runBlock has already made the checks for the first op */
+	for (i = 0; i < b->n; i++) {
+		if (i)
+			emitChecks(&j, b, i, base);
+		emitOp(&j, &b->ops[i]);
+	}
+	emit8(&j, 0xB8);		/* mov eax, n */
+	emit32(&j, b->n);
+
+	epilogue = j.p;
+	emit8(&j, 0x41);		/* pop r13 */
+	emit8(&j, 0x5D);
+	emit8(&j, 0x41);		/* pop r12 */
+	emit8(&j, 0x5C);
+	emit8(&j, 0x5B);		/* pop rbx */
+	emit8(&j, 0xC3);		/* ret */
+
+	/* One exit stub per op that has checks: return the count done */
+	for (i = 1; i < b->n; i++) {
+		stub[i] = j.p;
+		emit8(&j, 0xB8);	/* mov eax, i */
+		emit32(&j, i);
+		emit8(&j, 0xE9);	/* jmp epilogue */
+		rel = epilogue - (j.p + 4);
+		emit32(&j, rel);
+	}
+	for (i = 0; i < j.nfix; i++) {
+		rel = stub[j.fixop[i]] - (base + j.fix[i] + 4);
+		memcpy(base + j.fix[i], &rel, 4);
+	}
+	if (jitProtect(base, need, PROT_READ | PROT_EXEC))
+		return jitLost(cache);
+
+	cache->codeUsed += j.p - base;
+	cache->codeUsed = (cache->codeUsed + 15) & ~15;
+	b->native = (Z80NativeFunc)(void *)base;
+	b->nativeGen = b->genval;
+	b->nativeEpoch = cache->codeEpoch;
+	return 1;
+}
+
+static int jitReady(struct Z80BlockCache* cache, struct Z80Block* b)
+{
+	return b->native && b->nativeGen == b->genval &&
+		b->nativeEpoch == cache->codeEpoch;
+}
+
+#ifndef Z80_FAST
+static int jitInit(struct Z80BlockCache* cache)
+{
+	void* p;
+
+	if (cache->code)
+		return 0;
+	p = mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_EXEC,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED)
+		return -1;
+	cache->code = p;
+	cache->codeUsed = 0;
+	return 0;
+}
+
+static void jitFree(struct Z80BlockCache* cache)
+{
+	if (cache->code)
+		munmap(cache->code, JIT_CODE_SIZE);
+	cache->code = NULL;
+}
+#endif
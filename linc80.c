@@ -86,9 +86,28 @@ static struct z80_sio *sio;
 
 static void reti_event(void);
 
+/* Keep the CPU's page map in step with the banking. Absent banks and memory
+   tracing go through mem_read/mem_write */
+static void map_memory(void)
+{
+	uint8_t *bank = NULL;
+
+	if (trace & TRACE_MEM)
+		return;
+	if (romdis)
+		Z80MapPages(&cpu_z80, 0x0000, 0x4000, ram, ram);
+	else
+		Z80MapPages(&cpu_z80, 0x0000, 0x4000, rom + 0x4000 * romsel, ram);
+	Z80MapPages(&cpu_z80, 0x4000, 0x4000, ram + 0x4000, ram + 0x4000);
+	if (ramsel <= rsmask)
+		bank = altram[ramsel & rsmask];
+	Z80MapPages(&cpu_z80, 0x8000, banktop - 0x7FFF, bank, bank);
+	if (banktop != 0xFFFF)
+		Z80MapPages(&cpu_z80, 0xC000, 0x4000, ram + 0xC000, ram + 0xC000);
+}
+
 static uint8_t do_mem_read(uint16_t addr, unsigned debug)
 {
-	static uint8_t rstate = 0;
 	uint8_t r;
 
 	if (addr < 0x4000 && !romdis)
@@ -110,28 +129,6 @@ static uint8_t do_mem_read(uint16_t addr, unsigned debug)
 	if (trace & TRACE_MEM)
 		fprintf(stderr, "R %04X = %02X\n", addr, r);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r== 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1) {
-		if (trace & TRACE_IRQ)
-			fprintf(stderr, "RETI seen.\n");
-		reti_event();
-	}
-	rstate = 0;
 	return r;
 }
 
@@ -599,6 +596,7 @@ static void memory_control(uint8_t val)
 		if (ramsel > rsmask)
 			fprintf(stderr, "[Warning: selected invalid ram bank]\n");
 	}
+	map_memory();
 }
 
 static uint16_t siobits(uint16_t addr)
@@ -730,6 +728,13 @@ static void reti_event(void)
 	   processing within the normal flow */
 }
 
+static void z80_reti(int unused)
+{
+	if (trace & TRACE_IRQ)
+		fprintf(stderr, "RETI seen.\n");
+	reti_event();
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -746,7 +751,7 @@ static void exit_cleanup(void)
 static void usage(void)
 {
 	fprintf(stderr,
-		"linc80: [-x] [-f] [-b banks] [-r rompath] [-i idepath] [-s sdcard] [-d debug]\n");
+		"linc80: [-x] [-f] [-b banks] [-r rompath] [-i idepath] [-s sdcard] [-d debug] [-J engine]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -759,8 +764,9 @@ int main(int argc, char *argv[])
 	char *idepath = "linc80.ide";
 	char *sdpath = NULL;
 	int banks = 1;
+	int engine = Z80_ENGINE_SWITCH;
 
-	while ((opt = getopt(argc, argv, "r:i:d:fxb:s:")) != -1) {
+	while ((opt = getopt(argc, argv, "r:i:d:fxb:s:J:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -785,6 +791,13 @@ int main(int argc, char *argv[])
 		case 'b':
 			banks = atoi(optarg);
 			break;
+		case 'J':
+			engine = Z80EngineByName(optarg);
+			if (engine == -1) {
+				fprintf(stderr, "linc80: unknown engine '%s'.\n", optarg);
+				exit(EXIT_FAILURE);
+			}
+			break;
 		default:
 			usage();
 		}
@@ -880,7 +893,13 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = z80_reti;
 	cpu_z80.trace = z80_trace;
+	map_memory();
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "linc80: unable to set up CPU engine.\n");
+		exit(EXIT_FAILURE);
+	}
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
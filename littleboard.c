@@ -76,7 +76,7 @@ static volatile int done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
 
 static uint8_t *mdisk(uint16_t addr)
 {
@@ -87,7 +87,6 @@ static uint8_t *mdisk(uint16_t addr)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate;
 	uint8_t r;
 
 	if (trace & TRACE_MEM)
@@ -102,24 +101,6 @@ static uint8_t mem_read(int unused, uint16_t addr)
 	if (trace & TRACE_MEM)
 		fprintf(stderr, " %04X <- %02X\n", addr, r);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r== 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
 	return r;
 }
 
@@ -563,7 +544,7 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 			"Unknown write to port %04X of %02X\n", addr, val);
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	int r;
 	switch(live_irq) {
@@ -754,6 +735,7 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
 
 	/* This is the wrong way to do it but it's easier for the moment. We
@@ -787,7 +769,7 @@ int main(int argc, char *argv[])
 				   there now might be one we use the same logic as for
 				   reti */
 				if (!live_irq)
-					reti_event();
+					reti_event(0);
 				/* Clear this after because reti_event may set the
 				   flags to indicate there is more happening. We will
 				   pick up the next state changes on the reti if so */
@@ -1,14 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include "ide.h"
+#include "diskio.h"
 
 int main(int argc, const char *argv[])
 {
 	int t, fd;
+	if (argc == 4 && strcmp(argv[1], "-o") == 0) {
+		if (disk_overlay(argv[2], argv[3]) < 0)
+			exit(1);
+		return 0;
+	}
 	if (argc != 3) {
 		fprintf(stderr, "%s [type] [path]\n", argv[0]);
+		fprintf(stderr, "%s -o [base] [overlay]\n", argv[0]);
 		exit(1);
 	}
 	t = atoi(argv[1]);
@@ -89,7 +89,7 @@ static unsigned fast;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
 
 static void cpu_slow(void)
 {
@@ -721,28 +721,7 @@ static void mem_write(int unused, uint16_t addr, uint8_t val)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate;
-	uint8_t r = do_max_read(addr, 0);
-
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r == 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
-	return r;
+	return do_max_read(addr, 0);
 }
 
 static uint8_t io_read(int unused, uint16_t addr)
@@ -806,7 +785,7 @@ static void poll_irq_event(void)
 		Z80NOINT(&cpu_z80);
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	sio_reti(sio);
 	poll_irq_event();
@@ -1221,6 +1200,7 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
 
 	/* This is the wrong way to do it but it's easier for the moment. We
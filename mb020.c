@@ -38,6 +38,8 @@
 #include "16x50.h"
 #include "ide.h"
 #include "rtc_bitbang.h"
+#include "stats.h"
+#include "trigger.h"
 
 /* CF adapter */
 static struct ide_controller *ide;
@@ -158,6 +160,8 @@ unsigned int do_cpu_read_byte(unsigned int address, unsigned int trap)
 		if (address < 0x0C000000)
 			return ram[address & (sizeof(ram) - 1)];
 	}
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(address);
 	if (address == 0xFFFF8000)
 		flipped = 1;
 	if ((address & 0xFFFFF000) == 0xFFFFF000) {
@@ -290,6 +294,9 @@ void cpu_write_pd(unsigned int address, unsigned int value)
 
 void cpu_instr_callback(void)
 {
+	stats.instructions++;
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(m68k_get_reg(NULL, M68K_REG_PC));
 	if (trace & TRACE_CPU) {
 		char buf[128];
 		unsigned int pc = m68k_get_reg(NULL, M68K_REG_PC);
@@ -323,7 +330,7 @@ static void take_a_nap(void)
 	struct timespec t;
 	t.tv_sec = 0;
 	t.tv_nsec = 100000;
-	if (nanosleep(&t, NULL))
+	if (stats_nap(&t))
 		perror("nanosleep");
 }
 
@@ -338,7 +345,7 @@ void cpu_set_fc(int fc)
 
 void usage(void)
 {
-	fprintf(stderr, "mb020: [-1] [-r rompath][-i idepath][-d debug].\n");
+	fprintf(stderr, "mb020: [-1] [-f] [-t trigger] [-r rompath][-i idepath][-d debug][-j text|json].\n");
 	exit(1);
 }
 
@@ -353,18 +360,26 @@ int main(int argc, char *argv[])
 	const char *romname = "mb020mon.rom";
 	const char *diskname = "mb020.ide";
 	unsigned input = IN_ACIA;
+	unsigned statsmode = STATS_OFF;
 
-	while((opt = getopt(argc, argv, "2efd:i:r:1")) != -1) {
+	while((opt = getopt(argc, argv, "2efd:i:j:r:1t:")) != -1) {
 		switch(opt) {
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'd':
 			trace = atoi(optarg);
 			break;
 		case 'i':
 			diskname = optarg;
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'r':
 			romname = optarg;
 			break;
@@ -443,6 +458,7 @@ int main(int argc, char *argv[])
 
 	/* Init devices */
 	device_init();
+	stats_init("mb020", fast ? 0 : 22, statsmode);
 
 	while (1) {
 		unsigned n = 0;
@@ -450,14 +466,18 @@ int main(int argc, char *argv[])
 		while(n++ < 100) {
 			/* 2200 clocks x 100 for the inner loop gives us
 			   220000 clocks */
-			m68k_execute(2200);
+			stats.cycles += m68k_execute(2200);
 			acia_timer(acia);
 			uart16x50_event(uart);
 			recalc_interrupts();
 			/* 0.1 ms sleep */
-			if (!fast)
+			if (trigger_pending & TRIGGER_TIME)
+				trigger_elapsed(100000);
+			if (!fast && !trigger_pending)
 				take_a_nap();
 		}
+		if (stats_wanted)
+			stats_report();
 		timer = 1;
 	}
 }
@@ -103,6 +103,15 @@ static void mem_write(int unused, uint16_t addr, uint8_t val)
 	ram[va] = val;
 }
 
+/* Map the RAM straight into the CPU when we are not tracing memory */
+static void map_memory(void)
+{
+	if (trace & TRACE_MEM)
+		return;
+	Z80MapPages(&cpu_z80, 0x0000, 0x8000, ram + 0x8000 * bank, ram + 0x8000 * bank);
+	Z80MapPages(&cpu_z80, 0x8000, 0x8000, ram + 0x8000, ram + 0x8000);
+}
+
 static unsigned int nbytes;
 
 uint8_t z80dis_byte(uint16_t addr)
@@ -397,6 +406,7 @@ static void ios_tx(uint8_t val)
 				bank++;
 			if (trace & TRACE_BANK)
 				fprintf(stderr, "%d.\n", bank);
+			map_memory();
 		}
 		break;
 	}
@@ -532,6 +542,7 @@ int main(int argc, char *argv[])
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
 	cpu_z80.trace = z80_trace;
+	map_memory();
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
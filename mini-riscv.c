@@ -23,6 +23,8 @@
 #include "riscv-disas.h"
 
 #include "sdcard.h"
+#include "serialdevice.h"
+#include "ttycon.h"
 
 #define MINIRV32_CUSTOM_MEMORY_BUS
 #define MINIRV32_RAM_IMAGE_OFFSET	0x00000000U
@@ -87,58 +89,13 @@ static void disassemble(uint32_t ir, uint32_t addr);
 
 struct MiniRV32IMAState cpu;
 
-static uint16_t lastch = 0xFFFF;
-
 static struct gdb_server *gdb;
 
-int check_chario(void)
-{
-	fd_set i, o;
-	struct timeval tv;
-	unsigned int r = 0;
-	char c;
-
-
-	FD_ZERO(&i);
-	FD_SET(0, &i);
-	FD_ZERO(&o);
-	FD_SET(1, &o);
-	tv.tv_sec = 0;
-	tv.tv_usec = 0;
-
-	if (select(2, &i, &o, NULL, &tv) == -1) {
-		if (errno == EINTR)
-			return 0;
-		perror("select");
-		exit(1);
-	}
-	if (FD_ISSET(0, &i)) {
-		r |= 1;
-		if (lastch == 0xFFFF) {
-			if (read(0, &c, 1) == 1)
-				lastch = c;
-		}
-	}
-	if (FD_ISSET(1, &o))
-		r |= 2;
-	return r;
-}
-
-unsigned int next_char(void)
-{
-	char c = lastch;
-	lastch = 0xFFFF;
-	if (c == 0x0A)
-		c = '\r';
-	return c;
-}
-
 static void uart_out(unsigned uart, uint32_t addr, uint32_t val)
 {
 	switch(addr & 0xFFF) {
 		case 0:
-			putchar(val & 0xFF);
-			fflush(stdout);
+			console.put(&console, val & 0xFF);
 			break;
 	}
 }
@@ -147,9 +104,9 @@ static uint32_t uart_in(unsigned uart, uint32_t addr)
 {
 	switch(addr & 0xFFF) {
 		case 0:
-			return next_char();
+			return console.get(&console);
 		case 4:
-			return check_chario();
+			return console.ready(&console);
 	}
 	return 0xFFFFFFFF;
 }
@@ -55,6 +55,11 @@
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "sdcard.h"
+#include "realtime.h"
+#include "stats.h"
+#include "profile.h"
+#include "timerq.h"
+#include "trigger.h"
 #include "lib765/include/765.h"
 
 
@@ -68,6 +73,9 @@ static struct uart16x50 *uart;
 /* RTC */
 static struct rtc *rtc;
 static unsigned rtc_loaded;
+/* Device timing */
+static struct timerq *timers;
+static const char *profpath;
 /* FDC on DiskIO */
 static FDC_PTR fdc;
 static FDRV_PTR drive_a, drive_b;
@@ -821,6 +829,8 @@ void cpu_write_byte(unsigned int address, unsigned int value)
 			fprintf(stderr,  "%06x: write to invalid space.\n", address);
 		return;
 	}
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(address);
 	if ((address & 0xF0) == 0x20) {
 		ppide_write(ppide2, address & 0x03, value);
 		return;
@@ -898,8 +908,20 @@ void cpu_write_pd(unsigned int address, unsigned int value)
 	cpu_write_word(address, value >> 16);
 }
 
+/* Let the profiler follow calls and returns */
+static void profile_68k(void)
+{
+	unsigned int sp = m68k_get_reg(NULL, M68K_REG_SP);
+	profile_step(m68k_get_reg(NULL, M68K_REG_PC), sp, cpu_read_long_dasm(sp));
+}
+
 void cpu_instr_callback(void)
 {
+	stats.instructions++;
+	if (profile_stacks)
+		profile_68k();
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(m68k_get_reg(NULL, M68K_REG_PC));
 	if (trace & TRACE_CPU) {
 		char buf[128];
 		unsigned int pc = m68k_get_reg(NULL, M68K_REG_PC);
@@ -934,13 +956,38 @@ static void exit_cleanup(void)
 	tcsetattr(0, 0, &saved_term);
 }
 
-static void take_a_nap(void)
+static void tick_uart(void *priv, unsigned long clocks)
+{
+	uart16x50_event(uart);
+	recalc_interrupts();
+}
+
+static void tick_ns202(void *priv, unsigned long clocks)
+{
+	/* The CPU runs at 8MHz but the NS202 is run off the serial
+	   clock */
+	ns202_tick(clocks * 184 / 400);
+}
+
+static int fast;
+
+static void tick_profile(void *priv, unsigned long clocks)
+{
+	/* Catch up with the last instruction run */
+	if (profile_stacks)
+		profile_68k();
+	profile_sample(m68k_get_reg(NULL, M68K_REG_PC));
+}
+
+static void tick_nap(void *priv, unsigned long clocks)
 {
-	struct timespec t;
-	t.tv_sec = 0;
-	t.tv_nsec = 100000;
-	if (nanosleep(&t, NULL))
-		perror("nanosleep");
+	/* 8MHz so 125ns a clock */
+	unsigned long ns = clocks * 125;
+	if (trigger_pending & TRIGGER_TIME)
+		trigger_elapsed(ns);
+	if (!fast && !trigger_pending)
+		realtime_sleep(ns);
+	console_flush();
 }
 
 int cpu_irq_ack(int level)
@@ -971,7 +1018,7 @@ void cpu_set_fc(int fc)
 
 void usage(void)
 {
-	fprintf(stderr, "mini68k: [-0][-1][-2][-e][-m memsize][-r rompath][-i idepath][-I idepath] [-d debug].\n");
+	fprintf(stderr, "mini68k: [-0][-1][-2][-e][-f][-o][-x speed][-t trigger][-m memsize][-r rompath][-i idepath][-I idepath] [-d debug] [-j text|json] [-g profile] [-l symbols] [-K interval] [-U].\n");
 	exit(1);
 }
 
@@ -979,7 +1026,9 @@ int main(int argc, char *argv[])
 {
 	int fd;
 	int cputype = M68K_CPU_TYPE_68000;
-	int fast = 0;
+	double speed = 1.0;
+	unsigned statsmode = STATS_OFF;
+	unsigned long profile_every = PROFILE_INTERVAL;
 	int opt;
 	const char *romname = "mini-128.rom";
 	const char *diskname = NULL;
@@ -988,7 +1037,7 @@ int main(int argc, char *argv[])
 	const char *pathb = NULL;
 	const char *sdname = NULL;
 
-	while((opt = getopt(argc, argv, "012d:efi:m:r:s:A:B:I:")) != -1) {
+	while((opt = getopt(argc, argv, "012d:efg:i:j:K:l:m:or:s:t:Ux:A:B:I:")) != -1) {
 		switch(opt) {
 		case '0':
 			cputype = M68K_CPU_TYPE_68000;
@@ -1008,6 +1057,18 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'o':
+			console_unbuffered();
+			break;
+		case 'x':
+			speed = atof(optarg);
+			if (speed <= 0)
+				usage();
+			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'i':
 			diskname = optarg;
 			break;
@@ -1023,6 +1084,23 @@ int main(int argc, char *argv[])
 		case 'A':
 			patha = optarg;
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
+		case 'g':
+			profpath = optarg;
+			break;
+		case 'l':
+			profile_symbols(optarg);
+			break;
+		case 'K':
+			profile_every = atol(optarg);
+			if (profile_every == 0)
+				usage();
+			break;
+		case 'U':
+			profile_stacks = 1;
+			break;
 		case 'B':
 			pathb = optarg;
 			break;
@@ -1053,6 +1131,9 @@ int main(int argc, char *argv[])
 
 	if (optind < argc)
 		usage();
+	/* Call stacks are only kept for the profile */
+	if (profile_stacks && profpath == NULL)
+		usage();
 
 	memsize <<= 10;	/* In KiB for friendlyness */
 	if (memsize & 0x7FFFF) {
@@ -1168,15 +1249,28 @@ int main(int argc, char *argv[])
 	/* Init devices */
 	device_init();
 
+	timers = timerq_create();
+	timerq_every(timerq_timer(timers, "uart", tick_uart, NULL, 0), 400);
+	timerq_every(timerq_timer(timers, "ns202", tick_ns202, NULL, 0), 400);
+	if (!fast) {
+		/* Keep in step with real time every 10ms */
+		realtime_init(speed);
+		atexit(realtime_report);
+	}
+	/* Pace every 10ms and push out console output */
+	timerq_every(timerq_timer(timers, "nap", tick_nap, NULL, 0), 80000);
+	if (profpath) {
+		profile_init(profpath, 4, 10);
+		timerq_every(timerq_timer(timers, "profile", tick_profile, NULL, 0), profile_every);
+	}
+	stats_init("mini68k", fast ? 0 : 8 * speed, statsmode);
+
 	while (1) {
 		/* Approximate a 68008 */
-		m68k_execute(400);
-		uart16x50_event(uart);
-		recalc_interrupts();
-		/* The CPU runs at 8MHz but the NS202 is run off the serial
-		   clock */
-		ns202_tick(184);
-		if (!fast)
-			take_a_nap();
+		unsigned long ran = m68k_execute(timerq_due(timers, 400, 0));
+		timerq_run(timers, ran);
+		stats.cycles += ran;
+		if (stats_wanted)
+			stats_report();
 	}
 }
@@ -1056,6 +1056,11 @@ void ns8070_trace(struct ns8070 *cpu, unsigned int onoff)
 	cpu->trace = onoff;
 }
 
+uint16_t ns8070_get_pc(struct ns8070 *cpu)
+{
+	return cpu->pc;
+}
+
 void ns8070_set_a(struct ns8070 *cpu, unsigned int bit)
 {
 	/* TODO: interrupt */
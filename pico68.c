@@ -29,6 +29,8 @@
 #include "acia.h"
 #include "6522.h"
 #include "sdcard.h"
+#include "stats.h"
+#include "trigger.h"
 
 struct acia *acia;
 struct via6522 *via;
@@ -194,6 +196,8 @@ void cpu_write_byte(unsigned int address, unsigned int value)
 		ram[address & 0x1FFFF] = value;
 		return;
 	}
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(address);
 	if (address & 1)
 		acia_write(acia, (address >> 1) & 1, value);
 	else
@@ -223,6 +227,9 @@ void cpu_write_pd(unsigned int address, unsigned int value)
 
 void cpu_instr_callback(void)
 {
+	stats.instructions++;
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(m68k_get_reg(NULL, M68K_REG_PC));
 	if (trace & TRACE_CPU) {
 		char buf[128];
 		unsigned int pc = m68k_get_reg(NULL, M68K_REG_PC);
@@ -254,7 +261,7 @@ static void take_a_nap(void)
 	struct timespec t;
 	t.tv_sec = 0;
 	t.tv_nsec = 100000;
-	if (nanosleep(&t, NULL))
+	if (stats_nap(&t))
 		perror("nanosleep");
 }
 
@@ -269,7 +276,7 @@ void cpu_set_fc(int fc)
 
 void usage(void)
 {
-	fprintf(stderr, "pico68: [-0][-1][-2][-e][-r rompath][-s sdpath][-d debug].\n");
+	fprintf(stderr, "pico68: [-0][-1][-2][-e][-f][-t trigger][-r rompath][-s sdpath][-d debug][-j text|json].\n");
 	exit(1);
 }
 
@@ -281,8 +288,9 @@ int main(int argc, char *argv[])
 	int opt;
 	const char *romname = "pico68.rom";
 	const char *sdname = NULL;
+	unsigned statsmode = STATS_OFF;
 
-	while((opt = getopt(argc, argv, "012efd:r:s:")) != -1) {
+	while((opt = getopt(argc, argv, "012efd:j:r:s:t:")) != -1) {
 		switch(opt) {
 		case '0':
 			cputype = M68K_CPU_TYPE_68000;
@@ -296,9 +304,16 @@ int main(int argc, char *argv[])
 		case 'e':
 			cputype = M68K_CPU_TYPE_68EC020;
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'd':
 			trace = atoi(optarg);
 			break;
@@ -369,15 +384,20 @@ int main(int argc, char *argv[])
 
 	/* Init devices */
 	device_init();
+	stats_init("pico68", fast ? 0 : 8, statsmode);
 
 	while (1) {
 		/* 8MHz 68000 */
-		m68k_execute(800);
+		stats.cycles += m68k_execute(800);
+		if (stats_wanted)
+			stats_report();
 		acia_timer(acia);
 		via_tick(via, 800);
 		recalc_interrupts();
 		/* 0.1ms sleep */
-		if (!fast)
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(100000);
+		if (!fast && !trigger_pending)
 			take_a_nap();
 	}
 }
@@ -5,6 +5,7 @@
 #include <unistd.h>
 #include "system.h"
 #include "ppide.h"
+#include "snapshot.h"
 
 /*
  *	Emulate PPIDE. It's not a particularly good emulation of the actual
@@ -122,3 +123,9 @@ int ppide_attach(struct ppide *ppide, int drive, int fd)
 {
 	return ide_attach(ppide->ide, drive, fd);
 }
+
+void ppide_snapshot(struct ppide *ppide, struct snapshot *s)
+{
+	snapshot_bytes(s, ppide->pioreg, sizeof(ppide->pioreg));
+	ide_snapshot(ppide->ide, s);
+}
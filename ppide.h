@@ -15,4 +15,5 @@ extern struct ppide *ppide_create(const char *name);
 extern void ppide_free(struct ppide *ppide);
 extern void ppide_trace(struct ppide *ppide, int onoff);
 extern int ppide_attach(struct ppide *ppide, int drive, int fd);
+extern void ppide_snapshot(struct ppide *ppide, struct snapshot *s);
 #endif
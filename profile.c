@@ -0,0 +1,354 @@
+/*
+ *	Guest profiler
+ *
+ *	Samples are counted by symbol for the flat profile and by the whole
+ *	call stack for the collapsed output, which is one line per distinct
+ *	stack of the form
+ *
+ *	outer;inner;current count
+ *
+ *	The call stack is not taken from the guest stack, which we know
+ *	nothing about, but built by watching the stack pointer. An
+ *	instruction that moves the stack pointer down by the size of a return
+ *	address, lands somewhere other than the next instruction and leaves
+ *	an address just past itself on the stack was a call (or an
+ *	interrupt). Once the stack pointer moves back above where a return
+ *	address was pushed that call has returned. If the stack pointer jumps
+ *	a long way down the guest has switched stacks and we start again.
+ *
+ *	Symbols can be given as nm output (addr type name), SDCC .noi files
+ *	(DEF name addr) or any map that lists an address and then a name on
+ *	a line, which covers the SDCC and GNU ld maps.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "profile.h"
+
+#define PROFILE_DEPTH	64
+#define PROFILE_HASH	4096
+#define PROFILE_SWITCH	1024	/* A bigger drop in SP is a stack switch */
+#define PROFILE_NAME	64
+
+struct profile_sym {
+	uint32_t addr;
+	char *name;
+};
+
+struct profile_count {
+	struct profile_count *next;
+	char *key;
+	uint64_t self;
+	uint64_t total;
+	uint64_t seen;		/* Last sample counted in total */
+};
+
+struct profile_frame {
+	uint32_t sp;
+	uint32_t ret;
+};
+
+unsigned profile_stacks;
+
+static const char *profile_path;
+static unsigned profile_retsize;
+static unsigned profile_maxlen;
+static uint64_t samples;
+
+static struct profile_sym *syms;
+static unsigned nsyms;
+static unsigned ssyms;
+
+static struct profile_count *flat[PROFILE_HASH];
+static struct profile_count *folded[PROFILE_HASH];
+
+static struct profile_frame stack[PROFILE_DEPTH];
+static unsigned depth;
+static unsigned stepped;
+static uint32_t last_pc;
+static uint32_t last_sp;
+
+static void *profile_alloc(size_t len)
+{
+	void *p = malloc(len);
+	if (p == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	return p;
+}
+
+static unsigned profile_hash(const char *p)
+{
+	uint32_t h = 2166136261U;
+	while (*p)
+		h = (h ^ (uint8_t)*p++) * 16777619U;
+	return h & (PROFILE_HASH - 1);
+}
+
+static struct profile_count *profile_count(struct profile_count **table, const char *key)
+{
+	unsigned h = profile_hash(key);
+	struct profile_count *c;
+
+	for (c = table[h]; c; c = c->next)
+		if (strcmp(c->key, key) == 0)
+			return c;
+	c = profile_alloc(sizeof(struct profile_count));
+	memset(c, 0, sizeof(*c));
+	c->key = profile_alloc(strlen(key) + 1);
+	strcpy(c->key, key);
+	c->next = table[h];
+	table[h] = c;
+	return c;
+}
+
+/* Addresses in maps are written out in full so insist on four digits,
+   which keeps words that happen to be hex from matching */
+static int profile_hex(const char *p, uint32_t *v)
+{
+	char *e;
+
+	if (strncmp(p, "0x", 2) == 0 || strncmp(p, "0X", 2) == 0)
+		p += 2;
+	if (strlen(p) < 4)
+		return 0;
+	*v = strtoul(p, &e, 16);
+	return *e == 0;
+}
+
+static int profile_ident(const char *p)
+{
+	return isalpha((uint8_t)*p) || *p == '_' || *p == '.';
+}
+
+static void profile_add(uint32_t addr, const char *name)
+{
+	if (nsyms == ssyms) {
+		ssyms = ssyms ? ssyms * 2 : 256;
+		syms = realloc(syms, ssyms * sizeof(struct profile_sym));
+		if (syms == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+	}
+	syms[nsyms].addr = addr;
+	syms[nsyms].name = profile_alloc(strlen(name) + 1);
+	strcpy(syms[nsyms++].name, name);
+}
+
+static int profile_sym_cmp(const void *a, const void *b)
+{
+	const struct profile_sym *x = a, *y = b;
+	if (x->addr < y->addr)
+		return -1;
+	return x->addr > y->addr;
+}
+
+void profile_symbols(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char buf[512];
+	char t1[128], t2[128], t3[128];
+	uint32_t addr;
+	unsigned before = nsyms;
+	int n;
+
+	if (f == NULL) {
+		perror(path);
+		exit(1);
+	}
+	while (fgets(buf, sizeof(buf), f)) {
+		n = sscanf(buf, "%127s %127s %127s", t1, t2, t3);
+		if (n == 3 && strcmp(t1, "DEF") == 0) {
+			if (profile_hex(t3, &addr))
+				profile_add(addr, t2);
+		} else if (n == 3 && strlen(t2) == 1 && profile_hex(t1, &addr)) {
+			/* nm: only code symbols */
+			if (strchr("TtWw", *t2))
+				profile_add(addr, t3);
+		} else if (n >= 2 && profile_ident(t2) && profile_hex(t1, &addr))
+			profile_add(addr, t2);
+	}
+	fclose(f);
+	if (nsyms == before)
+		fprintf(stderr, "%s: no symbols found.\n", path);
+	qsort(syms, nsyms, sizeof(struct profile_sym), profile_sym_cmp);
+}
+
+/* The symbol an address falls in, or the address itself if none */
+static const char *profile_name(uint32_t addr)
+{
+	static char buf[16];
+	unsigned lo = 0, hi = nsyms;
+
+	while (lo < hi) {
+		unsigned mid = (lo + hi) / 2;
+		if (syms[mid].addr <= addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo)
+		return syms[lo - 1].name;
+	snprintf(buf, sizeof(buf), "0x%04X", (unsigned)addr);
+	return buf;
+}
+
+/* Count a sample against each symbol on the stack once */
+static void profile_total(const char *name)
+{
+	struct profile_count *c = profile_count(flat, name);
+	if (c->seen != samples) {
+		c->seen = samples;
+		c->total++;
+	}
+}
+
+void profile_sample(uint32_t pc)
+{
+	char key[PROFILE_DEPTH * PROFILE_NAME + PROFILE_NAME];
+	char *p = key;
+	const char *name;
+	unsigned i;
+
+	samples++;
+	if (profile_stacks) {
+		for (i = 0; i < depth; i++) {
+			/* The return address may be the start of the next
+			   function so look at the call itself */
+			name = profile_name(stack[i].ret - 1);
+			profile_total(name);
+			p += sprintf(p, "%.*s;", PROFILE_NAME - 2, name);
+		}
+	}
+	name = profile_name(pc);
+	profile_total(name);
+	profile_count(flat, name)->self++;
+	sprintf(p, "%.*s", PROFILE_NAME - 2, name);
+	profile_count(folded, key)->self++;
+}
+
+/* Called before each instruction with the word at the top of the stack */
+void profile_step(uint32_t pc, uint32_t sp, uint32_t top)
+{
+	if (!stepped) {
+		stepped = 1;
+		last_pc = pc;
+		last_sp = sp;
+		return;
+	}
+	if (sp != last_sp) {
+		/* Anything pushed above the stack pointer has returned */
+		while (depth && stack[depth - 1].sp < sp)
+			depth--;
+		if (last_sp - sp == profile_retsize &&
+			(pc <= last_pc || pc > last_pc + profile_maxlen) &&
+			top > last_pc && top <= last_pc + profile_maxlen) {
+			if (depth < PROFILE_DEPTH) {
+				stack[depth].sp = sp;
+				stack[depth++].ret = top;
+			}
+		} else if (sp < last_sp && last_sp - sp > PROFILE_SWITCH)
+			depth = 0;
+	}
+	last_pc = pc;
+	last_sp = sp;
+}
+
+static int profile_cmp(const void *a, const void *b)
+{
+	const struct profile_count *x = *(struct profile_count **)a;
+	const struct profile_count *y = *(struct profile_count **)b;
+	if (x->self != y->self)
+		return x->self < y->self ? 1 : -1;
+	if (x->total != y->total)
+		return x->total < y->total ? 1 : -1;
+	return strcmp(x->key, y->key);
+}
+
+static struct profile_count **profile_list(struct profile_count **table, unsigned *n)
+{
+	struct profile_count **list;
+	struct profile_count *c;
+	unsigned i;
+
+	*n = 0;
+	for (i = 0; i < PROFILE_HASH; i++)
+		for (c = table[i]; c; c = c->next)
+			(*n)++;
+	list = profile_alloc((*n + 1) * sizeof(struct profile_count *));
+	*n = 0;
+	for (i = 0; i < PROFILE_HASH; i++)
+		for (c = table[i]; c; c = c->next)
+			list[(*n)++] = c;
+	qsort(list, *n, sizeof(struct profile_count *), profile_cmp);
+	return list;
+}
+
+static FILE *profile_open(const char *path)
+{
+	FILE *f = fopen(path, "w");
+	if (f == NULL)
+		perror(path);
+	return f;
+}
+
+void profile_write(void)
+{
+	struct profile_count **list;
+	char *path;
+	unsigned i, n;
+	FILE *f;
+
+	if (profile_path == NULL || samples == 0)
+		return;
+
+	f = profile_open(profile_path);
+	if (f == NULL)
+		return;
+	list = profile_list(flat, &n);
+	fprintf(f, "# %llu samples\n", (unsigned long long)samples);
+	if (profile_stacks)
+		fprintf(f, "#    self      %%     total      %%  symbol\n");
+	else
+		fprintf(f, "#    self      %%  symbol\n");
+	for (i = 0; i < n; i++) {
+		struct profile_count *c = list[i];
+		fprintf(f, "%9llu %6.2f", (unsigned long long)c->self,
+			100.0 * c->self / samples);
+		if (profile_stacks)
+			fprintf(f, " %9llu %6.2f", (unsigned long long)c->total,
+				100.0 * c->total / samples);
+		fprintf(f, "  %s\n", c->key);
+	}
+	fclose(f);
+	free(list);
+
+	path = profile_alloc(strlen(profile_path) + 8);
+	sprintf(path, "%s.folded", profile_path);
+	f = profile_open(path);
+	free(path);
+	if (f == NULL)
+		return;
+	list = profile_list(folded, &n);
+	for (i = 0; i < n; i++)
+		fprintf(f, "%s %llu\n", list[i]->key,
+			(unsigned long long)list[i]->self);
+	fclose(f);
+	free(list);
+	/* Only once */
+	samples = 0;
+}
+
+/* retsize is the bytes a call pushes and maxlen the longest instruction */
+void profile_init(const char *path, unsigned retsize, unsigned maxlen)
+{
+	profile_path = path;
+	profile_retsize = retsize;
+	profile_maxlen = maxlen;
+	atexit(profile_write);
+}
@@ -0,0 +1,18 @@
+/*
+ *	Sampling profiler for the guest. The board calls profile_sample with
+ *	the PC every so many emulated clocks. If call stacks are wanted it
+ *	also calls profile_step before each instruction so the calls and
+ *	returns can be followed. At exit a flat profile is written to the
+ *	output and the collapsed stacks to output.folded for flamegraph.pl
+ *	and friends.
+ */
+
+#define PROFILE_INTERVAL	10000	/* Default clocks between samples */
+
+extern unsigned profile_stacks;
+
+void profile_init(const char *path, unsigned retsize, unsigned maxlen);
+void profile_symbols(const char *path);
+void profile_sample(uint32_t pc);
+void profile_step(uint32_t pc, uint32_t sp, uint32_t top);
+void profile_write(void);
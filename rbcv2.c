@@ -129,6 +129,19 @@ static void mem_write(int unused, uint16_t addr, uint8_t val)
 			(rombank & 0x1F), addr);
 }
 
+/* Map the current banks straight into the CPU unless we are tracing memory
+   in which case everything must go via mem_read/mem_write */
+static void map_memory(void)
+{
+	if (trace & TRACE_MEM)
+		return;
+	if (rombank & 0x80)
+		Z80MapPages(&cpu_z80, 0x0000, 0x8000, ramrom[32 + rambank], ramrom[32 + rambank]);
+	else
+		Z80MapPages(&cpu_z80, 0x0000, 0x8000, ramrom[rombank & 0x1F], NULL);
+	Z80MapPages(&cpu_z80, 0x8000, 0x8000, ramrom[HIRAM], ramrom[HIRAM]);
+}
+
 static unsigned int nbytes;
 
 uint8_t z80dis_byte(uint16_t addr)
@@ -215,6 +228,7 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 		if (trace & TRACE_BANK)
 			fprintf(stderr, "RAM bank to %02X\n", val);
 		rambank = val & ram_mask;
+		map_memory();
 	} else if (addr >= 0x7C && addr <= 0x7F) {
 		if (trace & TRACE_BANK) {
 			fprintf(stderr, "ROM bank to %02X\n", val);
@@ -222,6 +236,7 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 				fprintf(stderr, "Using RAM bank %d\n", rambank);
 		}
 		rombank = val;
+		map_memory();
 	}
 	else if (ramf && addr >=0xA0 && addr <=0xA7)
 		ramf_write(ramf, addr & 0x07, val);
@@ -232,6 +247,10 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 	else if (addr == 0xFD) {
 		printf("trace set to %d\n", val);
 		trace = val;
+		if (trace & TRACE_MEM)
+			Z80UnmapPages(&cpu_z80);
+		else
+			map_memory();
 	}
 	else if (trace & TRACE_UNK)
 		fprintf(stderr, "Unknown write to port %02X of %02X\n",
@@ -253,7 +272,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbv2: [-1] [-f] [-r rompath] [-i idepath] [-t] [-p] [-s sdcardpath] [-d tracemask] [-R]\n");
+	fprintf(stderr, "rcbv2: [-1] [-f] [-r rompath] [-i idepath] [-t] [-p] [-s sdcardpath] [-d tracemask] [-R] [-J engine]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -268,8 +287,9 @@ int main(int argc, char *argv[])
 	int i;
 	char *ramfpath = NULL;
 	unsigned int prop = 0;
+	int engine = Z80_ENGINE_SWITCH;
 
-	while((opt = getopt(argc, argv, "1r:i:s:ptd:fR:w")) != -1) {
+	while((opt = getopt(argc, argv, "1r:i:s:ptd:fJ:R:w")) != -1) {
 		switch(opt) {
 			case '1':
 				ram_mask = 0x03;	/* 4 x 32K banks only */
@@ -297,6 +317,13 @@ int main(int argc, char *argv[])
 			case 'f':
 				fast = 1;
 				break;
+			case 'J':
+				engine = Z80EngineByName(optarg);
+				if (engine == -1) {
+					fprintf(stderr, "rbcv2: unknown engine '%s'.\n", optarg);
+					exit(1);
+				}
+				break;
 			case 'R':
 				ramfpath = optarg;
 				break;
@@ -397,6 +424,11 @@ int main(int argc, char *argv[])
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
 	cpu_z80.trace = z80_trace;
+	map_memory();
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "rbcv2: unable to set up CPU engine.\n");
+		exit(1);
+	}
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
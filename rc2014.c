@@ -27,13 +27,13 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <fcntl.h>
 #include <signal.h>
 #include <termios.h>
 #include <time.h>
 #include <unistd.h>
 #include <errno.h>
-#include <sys/select.h>
 
 #include "system.h"
 #include "event.h"
@@ -68,6 +68,15 @@
 #include "sasi.h"
 #include "ncr5380.h"
 #include "sn76489.h"
+#include "realtime.h"
+#include "timerq.h"
+#include "trigger.h"
+#include "snapshot.h"
+#include "fanout.h"
+#include "replay.h"
+#include "stats.h"
+#include "profile.h"
+#include "diskio.h"
 
 static uint8_t ramrom[2048 * 1024];	/* Covers the banked card and ZRC */
 
@@ -164,6 +173,11 @@ static uint8_t live_nonim2;
 
 static Z80Context cpu_z80;
 static struct gdb_server *gdb;
+static struct timerq *timers;
+static double speed = 1.0;
+static const char *profpath;
+static unsigned spi_verify;
+static unsigned long profile_every = PROFILE_INTERVAL;
 static nic_w5100_t *wiz;
 
 volatile int emulator_done;
@@ -196,7 +210,9 @@ volatile int emulator_done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
+static void spi_accel(unsigned port);
+static void spi_step(uint16_t pc);
 static void poll_irq_nonim2(void);
 
 static uint8_t mem_read0(uint16_t addr)
@@ -238,6 +254,27 @@ static void mem_write0(uint16_t addr, uint8_t val)
 	}
 }
 
+/*
+ *	The page functions return the host memory behind the 1K page at addr,
+ *	or NULL if accesses there must go through the handlers (eg ROM writes
+ *	that need to be thrown away). They are used to build the CPU page map
+ *	whenever the banking changes.
+ */
+static uint8_t *mem_page0(uint16_t addr, unsigned is_wr)
+{
+	if (bankenable) {
+		unsigned int bank = (addr & 0xC000) >> 14;
+		if (is_wr && bankreg[bank] < 32)
+			return NULL;
+		return ramrom + (bankreg[bank] << 14) + (addr & 0x3FFF);
+	}
+	if (bank512)
+		return is_wr ? NULL : ramrom + (addr & 0x3FFF);
+	if (is_wr && addr < 8192)
+		return NULL;
+	return ramrom + addr;
+}
+
 static uint8_t mem_read108(uint16_t addr)
 {
 	uint32_t aphys;
@@ -270,6 +307,15 @@ static void mem_write108(uint16_t addr, uint8_t val)
 	ramrom[aphys] = val;
 }
 
+static uint8_t *mem_page108(uint16_t addr, unsigned is_wr)
+{
+	if (addr < 0x8000 && !(port38 & 0x01))
+		return is_wr ? NULL : ramrom + addr;
+	if (port38 & 0x80)
+		return ramrom + addr + 131072;
+	return ramrom + addr + 65536;
+}
+
 static uint8_t mem_read114(uint16_t addr)
 {
 	uint32_t aphys;
@@ -300,6 +346,15 @@ static void mem_write114(uint16_t addr, uint8_t val)
 	ramrom[aphys] = val;
 }
 
+static uint8_t *mem_page114(uint16_t addr, unsigned is_wr)
+{
+	if (addr < 0x8000 && !(port38 & 0x01))
+		return is_wr ? NULL : ramrom + addr;
+	if (port30 & 0x01)
+		return ramrom + addr + 131072;
+	return ramrom + addr + 65536;
+}
+
 /* I think this right
    0: sets the lower bank to the lowest 32K of the 128K
    1: sets the lower bank to the 32K-64K range
@@ -331,6 +386,13 @@ static void mem_write64(uint16_t addr, uint8_t val)
 		ramrom[bankreg[0] * 0x8000 + addr] = val;
 }
 
+static uint8_t *mem_page64(uint16_t addr, unsigned is_wr)
+{
+	if (addr >= 0x8000)
+		return ramrom + addr;
+	return ramrom + bankreg[0] * 0x8000 + addr;
+}
+
 /* ZRCC is a close relative of SBC64, but instead of a magic loader has
    a 64byte built in boot rom */
 
@@ -460,6 +522,16 @@ static void mem_writezrcc(uint16_t addr, uint8_t val)
 		ramrom[bankreg[0] * 0x8000 + addr] = val;
 }
 
+static uint8_t *mem_pagezrcc(uint16_t addr, unsigned is_wr)
+{
+	/* The boot ROM overlays the bottom of page 0 */
+	if (addr < 0x400 && bankreg[1] == 0)
+		return NULL;
+	if (addr >= 0x8000)
+		return ramrom + addr + 65536;
+	return ramrom + bankreg[0] * 0x8000 + addr;
+}
+
 static uint8_t mem_readzrc(uint16_t addr)
 {
 	uint8_t r;
@@ -516,6 +588,15 @@ static void mem_write_sc720(uint16_t addr, uint8_t val)
 		fprintf(stderr, "W %04x = %02X\n", addr, val);
 }
 
+static uint8_t *mem_page_sc720(uint16_t addr, unsigned is_wr)
+{
+	if (addr & 0x8000)
+		return ramrom + (addr & 0x7FFF) + 0x78000;
+	if (is_wr && bankreg[0] < 0x10)
+		return NULL;
+	return ramrom + (addr & 0x7FFF) + bankreg[0] * 0x8000;
+}
+
 static uint8_t mem_read_sc707(uint16_t addr)
 {
 	uint32_t aphys;
@@ -550,6 +631,16 @@ static void mem_write_sc707(uint16_t addr, uint8_t val)
 	ramrom[aphys] = val;
 }
 
+/* Reads and writes of the RAM decode differently, as in the handlers */
+static uint8_t *mem_page_sc707(uint16_t addr, unsigned is_wr)
+{
+	if (addr < 0x8000 && !(port38 & 0x01))
+		return is_wr ? NULL : ramrom + addr + bankreg[0] * 0x8000;
+	if (is_wr)
+		return ramrom + addr + ((port38 & 0x80) ? 0x30000 : 0x20000);
+	return ramrom + addr + ((port38 & 0x01) ? 0x30000 : 0x20000);
+}
+
 /* We use RAMROM in 32K chunks where 0-7FFF are the ROM and
    10000 + are the 128K RAM */
 static uint32_t mmu_tp128(uint16_t addr, unsigned is_wr)
@@ -589,6 +680,11 @@ static void mem_write_tp128(uint16_t addr, uint8_t val)
 	ramrom[aphys] = val;
 }
 
+static uint8_t *mem_page_tp128(uint16_t addr, unsigned is_wr)
+{
+	return ramrom + mmu_tp128(addr, is_wr);
+}
+
 struct z84c15 {
 	uint8_t scrp;
 	uint8_t wcr;
@@ -668,6 +764,11 @@ static void mem_write_micro80(uint16_t addr, uint8_t val)
 		*p = val;
 }
 
+static uint8_t *mem_page_micro80(uint16_t addr, unsigned is_wr)
+{
+	return mmu_micro80_z84c15(addr, is_wr);
+}
+
 /*
  *	Pickled Dog 128K and 512K RAM boards
  *
@@ -698,6 +799,11 @@ static uint8_t *mmu_pickled128(uint16_t addr, uint8_t wr)
 	return &ramrom[addr + (pick_bank << 15)];
 }
 
+static uint8_t *mem_page_pickled128(uint16_t addr, unsigned is_wr)
+{
+	return mmu_pickled128(addr, is_wr);
+}
+
 static uint8_t mem_read_pickled128(uint16_t addr)
 {
 	uint8_t *p = mmu_pickled128(addr, 0);
@@ -730,6 +836,11 @@ static uint8_t *mmu_pickled512(uint16_t addr, uint8_t wr)
 	return &ramrom[addr + (pick_bank << 15)];
 }
 
+static uint8_t *mem_page_pickled512(uint16_t addr, unsigned is_wr)
+{
+	return mmu_pickled512(addr, is_wr);
+}
+
 static uint8_t mem_read_pickled512(uint16_t addr)
 {
 	uint8_t *p = mmu_pickled512(addr, 0);
@@ -786,6 +897,17 @@ static void mem_write_micro80w(uint16_t addr, uint8_t val)
 	}
 }
 
+static uint8_t *mem_page_micro80w(uint16_t addr, unsigned is_wr)
+{
+	if (bankenable) {
+		unsigned int bank = (addr & 0xC000) >> 14;
+		if (is_wr && bankreg[bank] < 32)
+			return NULL;
+		return ramrom + (bankreg[bank] << 14) + (addr & 0x3FFF);
+	}
+	return is_wr ? NULL : ramrom + (addr & 0x3FFF);
+}
+
 static uint32_t ez512_base;
 static unsigned ez512_portc;
 
@@ -816,92 +938,35 @@ static void mem_write_ez512(uint16_t addr, uint8_t val)
 	ramrom[paddr] = val;
 }
 
-uint8_t do_mem_read(uint16_t addr, int quiet)
+static uint8_t *mem_page_ez512(uint16_t addr, unsigned is_wr)
 {
-	uint8_t r;
+	if (is_wr || (ez512_portc & 0x20) == 0)
+		return ramrom + ez512_xlat(addr);
+	if ((ez512_portc & 0x80) == 0)
+		return ramrom + addr;
+	return NULL;
+}
 
-	switch (cpuboard) {
-	case CPUBOARD_Z80:
-		r = mem_read0(addr);
-		break;
-	case CPUBOARD_SC108:
-		r = mem_read108(addr);
-		break;
-	case CPUBOARD_SC114:
-	case CPUBOARD_SC121:
-		r = mem_read114(addr);
-		break;
-	case CPUBOARD_Z80SBC64:
-		r = mem_read64(addr);
-		break;
-	case CPUBOARD_EASYZ80:
-		r = mem_read0(addr);
-		break;
-	case CPUBOARD_MICRO80:
-		r = mem_read_micro80(addr);
-		break;
-	case CPUBOARD_ZRCC:
-		r = mem_readzrcc(addr);
-		break;
-	case CPUBOARD_TINYZ80:
-		r = mem_read0(addr);
-		break;
-	case CPUBOARD_PDOG128:
-		r = mem_read_pickled128(addr);
-		break;
-	case CPUBOARD_PDOG512:
-		r = mem_read_pickled512(addr);
-		break;
-	case CPUBOARD_MICRO80W:
-		r = mem_read_micro80w(addr);
-		break;
-	case CPUBOARD_ZRC:
-		r = mem_readzrc(addr);
-		break;
-	case CPUBOARD_SC720:
-		r = mem_read_sc720(addr);
-		break;
-	case CPUBOARD_SC707:
-		r = mem_read_sc707(addr);
-		break;
-	case CPUBOARD_TP128:
-		r = mem_read_tp128(addr);
-		break;
-	case CPUBOARD_EASY512:
-		r = mem_read_ez512(addr);
-		break;
-	default:
-		fputs("invalid cpu type.\n", stderr);
-		exit(1);
-	}
-	return r;
+/* The handlers for the selected board, bound once by bind_board() */
+static uint8_t (*board_mem_read)(uint16_t addr);
+static void (*board_mem_write)(uint16_t addr, uint8_t val);
+static uint8_t *(*board_mem_page)(uint16_t addr, unsigned is_wr);
+static uint8_t (*board_io_read)(uint16_t addr);
+static void (*board_io_write)(uint16_t addr, uint8_t val);
+
+uint8_t do_mem_read(uint16_t addr, int quiet)
+{
+	return board_mem_read(addr);
 }
 
 uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate = 0;
 	uint8_t r = do_mem_read(addr, 0);
 
 	if (gdb) {
 		gdb_server_notify(gdb, addr, 1, false);
 	}
 
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r == 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
 	return r;
 }
 
@@ -910,61 +975,7 @@ void mem_write(int unused, uint16_t addr, uint8_t val)
 	if (gdb) {
 		gdb_server_notify(gdb, addr, 1, true);
 	}
-
-	switch (cpuboard) {
-	case CPUBOARD_Z80:
-		mem_write0(addr, val);
-		break;
-	case CPUBOARD_SC108:
-		mem_write108(addr, val);
-		break;
-	case CPUBOARD_SC114:
-	case CPUBOARD_SC121:
-		mem_write114(addr, val);
-		break;
-	case CPUBOARD_Z80SBC64:
-		mem_write64(addr, val);
-		break;
-	case CPUBOARD_EASYZ80:
-		mem_write0(addr, val);
-		break;
-	case CPUBOARD_MICRO80:
-		mem_write_micro80(addr, val);
-		break;
-	case CPUBOARD_ZRCC:
-		mem_writezrcc(addr, val);
-		break;
-	case CPUBOARD_TINYZ80:
-		mem_write0(addr, val);
-		break;
-	case CPUBOARD_PDOG128:
-		mem_write_pickled128(addr, val);
-		break;
-	case CPUBOARD_PDOG512:
-		mem_write_pickled512(addr, val);
-		break;
-	case CPUBOARD_MICRO80W:
-		mem_write_micro80w(addr, val);
-		break;
-	case CPUBOARD_ZRC:
-		mem_writezrc(addr, val);
-		break;
-	case CPUBOARD_SC720:
-		mem_write_sc720(addr, val);
-		break;
-	case CPUBOARD_SC707:
-		mem_write_sc707(addr, val);
-		break;
-	case CPUBOARD_TP128:
-		mem_write_tp128(addr, val);
-		break;
-	case CPUBOARD_EASY512:
-		mem_write_ez512(addr, val);
-		break;
-	default:
-		fputs("invalid cpu type.\n", stderr);
-		exit(1);
-	}
+	board_mem_write(addr, val);
 }
 
 static unsigned int nbytes;
@@ -982,11 +993,25 @@ uint8_t z80dis_byte_quiet(uint16_t addr)
 	return do_mem_read(addr, 1);
 }
 
+/* Let the profiler follow calls and returns */
+static void profile_z80(uint16_t pc)
+{
+	uint16_t sp = cpu_z80.R1.wr.SP;
+	profile_step(pc, sp, z80dis_byte_quiet(sp) |
+		(z80dis_byte_quiet(sp + 1) << 8));
+}
+
 static void z80_trace(unsigned unused)
 {
 	static uint32_t lastpc = -1;
 	char buf[256];
 
+	if (profile_stacks)
+		profile_z80(cpu_z80.M1PC);
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(cpu_z80.M1PC);
+	if (spi_verify)
+		spi_step(cpu_z80.M1PC);
 	if ((trace & TRACE_CPU) == 0)
 		return;
 	nbytes = 0;
@@ -1007,44 +1032,37 @@ static void z80_trace(unsigned unused)
 		cpu_z80.R1.wr.IX, cpu_z80.R1.wr.IY, cpu_z80.R1.wr.SP);
 }
 
-
-
-unsigned int check_chario(void)
+/* Hand the plain RAM and ROM of the current banking straight to the CPU.
+   Called whenever the banking changes. Memory tracing and gdb watchpoints
+   need to see every access so they get no map */
+static void map_memory(void)
 {
-	fd_set i, o;
-	struct timeval tv;
-	unsigned int r = 0;
-
-	FD_ZERO(&i);
-	FD_SET(0, &i);
-	FD_ZERO(&o);
-	FD_SET(1, &o);
-	tv.tv_sec = 0;
-	tv.tv_usec = 0;
+	unsigned addr;
 
-	if (select(2, &i, &o, NULL, &tv) == -1) {
-		if (errno == EINTR)
-			return 0;
-		perror("select");
-		exit(1);
+	if (board_mem_page == NULL || (trace & TRACE_MEM) || gdb) {
+		Z80UnmapPages(&cpu_z80);
+		return;
 	}
-	if (FD_ISSET(0, &i))
-		r |= 1;
-	if (FD_ISSET(1, &o))
-		r |= 2;
-	return r;
+	for (addr = 0; addr < 0x10000; addr += Z80_PAGE_SIZE)
+		Z80MapPages(&cpu_z80, addr, Z80_PAGE_SIZE,
+			board_mem_page(addr, 0), board_mem_page(addr, 1));
 }
 
-unsigned int next_char(void)
+/* Only hook the CPU trace when it is wanted. With no hook the CPU can take
+   shortcuts (HALT, block instructions) and we can run the build of the core
+   that has no trace support at all */
+static unsigned (*z80_run)(Z80Context *, unsigned) = Z80ExecuteTStatesFast;
+
+static void set_trace(int val)
 {
-	char c;
-	if (read(0, &c, 1) != 1) {
-		printf("(tty read without ready byte)\n");
-		return 0xFF;
-	}
-	if (c == 0x0A)
-		c = '\r';
-	return c;
+	int hook;
+
+	trace = val;
+	hook = (trace & TRACE_CPU) || (trigger_pending & TRIGGER_PC) ||
+		profile_stacks || spi_verify;
+	map_memory();
+	cpu_z80.trace = hook ? z80_trace : NULL;
+	z80_run = hook ? Z80ExecuteTStates : Z80ExecuteTStatesFast;
 }
 
 struct acia *acia;
@@ -1058,10 +1076,17 @@ void uart16x50_signal_change(struct uart16x50 *uart, uint8_t mcr)
 
 static int ide = 0;
 struct ide_controller *ide0;
+/* The ports the board decodes as the IDE data register, learned from the
+   first access so INIR and OTIR on them can be done in bulk */
+static uint8_t io_port;
+static int ide_in_port = -1;
+static int ide_out_port = -1;
 
 static uint8_t my_ide_read(uint16_t addr)
 {
 	uint8_t r =  ide_read8(ide0, addr);
+	if (addr == ide_data)
+		ide_in_port = io_port;
 	if (trace & TRACE_IDE)
 		fprintf(stderr, "ide read %d = %02X\n", addr, r);
 	return r;
@@ -1071,11 +1096,49 @@ static void my_ide_write(uint16_t addr, uint8_t val)
 {
 	if (trace & TRACE_IDE)
 		fprintf(stderr, "ide write %d = %02X\n", addr, val);
+	if (addr == ide_data)
+		ide_out_port = io_port;
 	ide_write8(ide0, addr, val);
 }
 
 struct rtc *rtc;
 
+/*
+ *	Device timing. Each device arms its timer for when it next has work to
+ *	do. One armed by an I/O access counts from where the CPU has got to in
+ *	its slice, and cuts the slice short so that it fires on time.
+ */
+
+static unsigned cpu_running;		/* cpu_z80.tstates is mid slice */
+static unsigned long serial_clocks;	/* One character at 115200 8N1 */
+static unsigned long pass_clocks;	/* How often an idle port looks */
+static struct timerq_timer *acia_t, *sio_t, *uart_t, *cpld_t, *ctc_t, *fdc_t;
+
+/* The emulated time the CPU has got to */
+static uint64_t board_now(void)
+{
+	uint64_t now = timerq_now(timers);
+	if (cpu_running)
+		now += cpu_z80.tstates;
+	return now;
+}
+
+/* Have t fire in clocks time unless it is due sooner already */
+static void device_due(struct timerq_timer *t, unsigned long clocks)
+{
+	if (cpu_running)
+		clocks += cpu_z80.tstates;
+	if (timerq_by(t, clocks) && cpu_running)
+		Z80EndSlice(&cpu_z80, clocks);
+}
+
+/* A serial port with a byte on the move is real work even when halted */
+static void serial_due(struct timerq_timer *t)
+{
+	timerq_idle(t, 0);
+	device_due(t, serial_clocks);
+}
+
 /*
  *	Z80 CTC
  */
@@ -1228,9 +1291,79 @@ static void ctc_tick(unsigned int clocks)
 	}
 }
 
+/*
+ *	The counters are only run when they are looked at or when the next
+ *	one that matters reaches zero.
+ */
+static uint64_t ctc_clock;	/* Emulated time the counters are run to */
+
+/* CTC clocks at emulated time t. The Micro80 CTC isn't off the CPU clock
+   but the 1.8MHz one */
+static uint64_t ctc_clocks(uint64_t t)
+{
+	if (cpuboard == CPUBOARD_MICRO80 || cpuboard == CPUBOARD_MICRO80W)
+		return t * 921 / (tstate_steps * 10);
+	return t;
+}
+
+static void ctc_catchup(void)
+{
+	uint64_t now = board_now();
+	unsigned long n = ctc_clocks(now) - ctc_clocks(ctc_clock);
+
+	ctc_clock = now;
+	if (n)
+		ctc_tick(n);
+}
+
+/* CTC clocks until the next running timer reaches zero, or 0 if none are
+   running. Even one that can't interrupt is run on each zero so that the
+   catching up never has too far to go */
+static unsigned long ctc_next(void)
+{
+	struct z80_ctc *c = ctc;
+	unsigned long best = 0;
+	unsigned long n;
+	int i;
+
+	for (i = 0; i < 4; i++, c++) {
+		if (CTC_STOPPED(c) || (c->ctrl & CTC_COUNTER))
+			continue;
+		/* The count is 8.8 with the prescaler below the point */
+		if (c->ctrl & CTC_PRESCALER)
+			n = c->count + 1;
+		else
+			n = (c->count >> 4) + 1;
+		if (best == 0 || n < best)
+			best = n;
+	}
+	return best;
+}
+
+/* Called with the counters caught up */
+static void ctc_schedule(void)
+{
+	unsigned long n = ctc_next();
+	uint64_t now;
+
+	if (ctc_t == NULL)
+		return;
+	timerq_cancel(ctc_t);
+	if (n == 0)
+		return;
+	if (cpuboard == CPUBOARD_MICRO80 || cpuboard == CPUBOARD_MICRO80W) {
+		/* The first CPU clock that far on in CTC clocks */
+		now = ctc_clock;
+		n = ((ctc_clocks(now) + n) * tstate_steps * 10 + 920) / 921 - now;
+	}
+	device_due(ctc_t, n);
+}
+
 static void ctc_write(uint8_t channel, uint8_t val)
 {
 	struct z80_ctc *c = ctc + channel;
+
+	ctc_catchup();
 	if (c->ctrl & CTC_TCONST) {
 		if (trace & TRACE_CTC)
 			fprintf(stderr, "CTC %d constant loaded with %02X\n", channel, val);
@@ -1269,11 +1402,15 @@ static void ctc_write(uint8_t channel, uint8_t val)
 		if (channel == 0)
 			c->vector = val;
 	}
+	ctc_schedule();
 }
 
 static uint8_t ctc_read(uint8_t channel)
 {
-	uint8_t val = ctc[channel].count >> 8;
+	uint8_t val;
+
+	ctc_catchup();
+	val = ctc[channel].count >> 8;
 	if (trace & TRACE_CTC)
 		fprintf(stderr, "CTC %d reads %02x\n", channel, val);
 	return val;
@@ -1303,59 +1440,75 @@ static uint8_t pio_cs;
 
 /* Software SPI test: one device for now */
 
+/* The bit-bang routine being checked against the table, if any */
+static struct spi_routine *spi_pending;
+static unsigned spi_replay;
+
+static uint8_t spi_swap(uint8_t val, uint8_t r);
+
 static uint8_t spi_byte_sent(uint8_t val)
 {
-	uint8_t r = sd_spi_in(sdcard, val);
+	uint8_t r;
+
+	/* Checking a routine against the table: play back what the card did */
+	if (spi_replay)
+		return spi_swap(val, 0xFF);
+	r = sd_spi_in(sdcard, val);
+	if (spi_pending)
+		r = spi_swap(val, r);
 	if (trace & TRACE_SPI)
 		fprintf(stderr,	"[SPI %02X:%02X]\n", val, r);
 	return r;
 }
 
 /* Bit 2: CLK, 1: MOSI, 0: MISO */
+static struct bitbang {
+	uint8_t old;
+	uint8_t oldcs;
+	uint8_t bits;
+	uint8_t bitct;
+	uint8_t rxbits;
+} bb = { 0xFF, 1, 0, 0, 0xFF };
+
 static void bitbang_spi(uint8_t val)
 {
-	static uint8_t old = 0xFF;
-	static uint8_t oldcs = 1;
-	static uint8_t bits;
-	static uint8_t bitct;
-	static uint8_t rxbits = 0xFF;
-	uint8_t delta = old ^ val;
+	uint8_t delta = bb.old ^ val;
 
-	old = val;
+	bb.old = val;
 
 	if (!sdcard)
 		return;
 
 	if ((pio_cs & 0x03) == 0x01) {		/* CS high - deselected */
-		if (!oldcs) {
+		if (!bb.oldcs) {
 			if (trace & TRACE_SPI)
 				fprintf(stderr,	"[Raised \\CS]\n");
-			bits = 0;
-			oldcs = 1;
+			bb.bits = 0;
+			bb.oldcs = 1;
 			sd_spi_raise_cs(sdcard);
 		}
-	} else if (oldcs) {
+	} else if (bb.oldcs) {
 		if (trace & TRACE_SPI)
 			fprintf(stderr, "[Lowered \\CS]\n");
-		oldcs = 0;
+		bb.oldcs = 0;
 		sd_spi_lower_cs(sdcard);
 	}
 	/* Capture clock edge */
 	if (delta & sd_clock) {		/* Clock edge */
 		if (val & sd_clock) {	/* Rising - capture in SPI0 */
-			bits <<= 1;
-			bits |= (val & sd_mosi) ? 1 : 0;
-			bitct++;
-			if (bitct == 8) {
-				rxbits = spi_byte_sent(bits);
-				bitct = 0;
+			bb.bits <<= 1;
+			bb.bits |= (val & sd_mosi) ? 1 : 0;
+			bb.bitct++;
+			if (bb.bitct == 8) {
+				bb.rxbits = spi_byte_sent(bb.bits);
+				bb.bitct = 0;
 			}
 		} else {
 			/* Falling edge */
 			pio->in[sd_port] &= ~sd_miso;
-			pio->in[sd_port] |= (rxbits & 0x80) ? sd_miso : 0x00;
-			rxbits <<= 1;
-			rxbits |= 0x01;
+			pio->in[sd_port] |= (bb.rxbits & 0x80) ? sd_miso : 0x00;
+			bb.rxbits <<= 1;
+			bb.rxbits |= 0x01;
 		}
 	}
 }
@@ -1365,14 +1518,16 @@ static void bitbang_spi(uint8_t val)
 void pio_data_write(struct z80_pio *pio, uint8_t port, uint8_t val)
 {
 	if (cpuboard == CPUBOARD_MICRO80 || cpuboard == CPUBOARD_MICRO80W) {
-		if (port == 0)
+		if (port == 0) {
 			bitbang_spi(val);
-		else if (port == 1)
+			spi_accel(port);
+		} else if (port == 1)
 			pio_cs = val & 7;
 	} else {
 		if (port == 1) {
 			pio_cs = (val & 0x08) >> 3;
 			bitbang_spi(val);
+			spi_accel(port);
 		}
 	}
 }
@@ -1518,6 +1673,577 @@ static void pio_reset(void)
 	pio->irq[1] = 0;
 }
 
+/*
+ *	Bit-banged SPI acceleration. Software SPI through the PIO costs a
+ *	handful of instructions and a couple of port writes for every bit. Given
+ *	a table of the byte and block routines in the ROM we spot the OUT
+ *	that starts a byte and do the rest of the routine in one go. The port
+ *	writes it would make are fed to the bit-bang logic directly, the
+ *	result is left where the routine would leave it and the clock is
+ *	moved on by the measured cost of the guest loop. Each line of the
+ *	table is
+ *
+ *	name addr signature exit [key=value ...]
+ *
+ *	addr is the OUT that puts the first bit of a byte out with the clock
+ *	low and signature the code bytes in hex that must be found there.
+ *	exit is where the routine carries on once the byte or block is done.
+ *	The keys are
+ *
+ *	in=r		register holding the byte to send at the OUT, a hex
+ *			constant or (rr) for a block from memory
+ *	out=r		register or (rr) to receive into, or both
+ *	count=B|BC	the block length, any (rr) move on a byte each time
+ *	end=xx		port value written after the last bit of each byte
+ *	cycles=n	clocks from the OUT to the exit for one byte
+ *	each=n		and for each further byte of a block
+ *	ops=n		instructions after the OUT up to the exit for one byte
+ *	opseach=n	and for each further byte of a block
+ *	m1=n		opcode fetches for the same, which is what R counts:
+ *			ops plus one for each CB, DD, ED or FD prefix
+ *	m1each=n	and for each further byte of a block
+ *	r=xx		register left holding xx, or r=? if nobody cares
+ *
+ *	The routine must send MSB first as data with the clock low, then the
+ *	clock high and then sample MISO, which is SPI mode 0 as SD cards
+ *	use. An interrupt due during the routine is taken once it is done.
+ *
+ *	With -V the table is only checked. The guest runs the slow path and
+ *	when it gets to the exit the state it reached is compared with what
+ *	the table would have given. The clocks, instructions and fetches
+ *	taken are reported so a new entry can be filled in the same way. The
+ *	fetches are only seen through R so they are reported modulo 128.
+ */
+
+#define SPI_SIGLEN	32
+#define SPI_SETS	8
+#define SPI_RECORD	65537
+
+#define SPI_NONE	-1
+#define SPI_B		2
+#define SPI_BC		8
+#define SPI_SP		13
+#define SPI_CONST	0x100	/* + value */
+#define SPI_PTR		0x200	/* + register */
+
+struct spi_routine {
+	struct spi_routine *next;
+	char name[32];
+	uint16_t addr;
+	uint16_t exit;
+	uint8_t sig[SPI_SIGLEN];
+	unsigned siglen;
+	int in;
+	int out;
+	int outp;
+	int count;
+	int end;
+	unsigned cycles;	/* 0 if not known, which is only any use to -V */
+	unsigned each;
+	unsigned ops;		/* Likewise */
+	unsigned opseach;
+	unsigned m1;		/* Likewise */
+	unsigned m1each;
+	unsigned nset;
+	uint8_t setreg[SPI_SETS];
+	uint16_t setval[SPI_SETS];
+	unsigned ignore;	/* Registers left as they fall */
+	unsigned checked;
+	unsigned lastn;
+	unsigned bad;
+};
+
+static const char *spi_regnames[] = {
+	"A", "F", "B", "C", "D", "E", "H", "L",
+	"BC", "DE", "HL", "IX", "IY", "SP", NULL
+};
+
+static struct spi_routine *spi_routines;
+static unsigned spi_busy;
+
+/* How things stood at the first OUT of the routine being checked */
+static Z80Context spi_cpu;
+static struct z80_pio spi_pio;
+static struct bitbang spi_bb;
+static unsigned spi_port;
+static uint64_t spi_clock;
+
+/* The bytes it swapped with the card, played back to the table */
+static uint8_t *spi_txrec;
+static uint8_t *spi_rxrec;
+static unsigned spi_nrec;
+static unsigned spi_nplay;
+static unsigned spi_playbad;
+
+static uint16_t *spi_reg16(Z80Context *c, int r)
+{
+	switch(r) {
+	case SPI_BC:
+		return &c->R1.wr.BC;
+	case SPI_BC + 1:
+		return &c->R1.wr.DE;
+	case SPI_BC + 2:
+		return &c->R1.wr.HL;
+	case SPI_BC + 3:
+		return &c->R1.wr.IX;
+	case SPI_BC + 4:
+		return &c->R1.wr.IY;
+	default:
+		return &c->R1.wr.SP;
+	}
+}
+
+static uint8_t *spi_reg8(Z80Context *c, int r)
+{
+	switch(r) {
+	case 0:
+		return &c->R1.br.A;
+	case 1:
+		return &c->R1.br.F;
+	case 2:
+		return &c->R1.br.B;
+	case 3:
+		return &c->R1.br.C;
+	case 4:
+		return &c->R1.br.D;
+	case 5:
+		return &c->R1.br.E;
+	case 6:
+		return &c->R1.br.H;
+	default:
+		return &c->R1.br.L;
+	}
+}
+
+static unsigned spi_get(Z80Context *c, int r)
+{
+	if (r < SPI_BC)
+		return *spi_reg8(c, r);
+	return *spi_reg16(c, r);
+}
+
+static void spi_set(Z80Context *c, int r, unsigned v)
+{
+	if (r < SPI_BC)
+		*spi_reg8(c, r) = v;
+	else
+		*spi_reg16(c, r) = v;
+}
+
+static void spi_mem_write(uint16_t addr, uint8_t val)
+{
+	mem_write(0, addr, val);
+	Z80NoteWrite(&cpu_z80, addr);
+}
+
+static int spi_match(struct spi_routine *r)
+{
+	unsigned i;
+
+	for (i = 0; i < r->siglen; i++)
+		if (do_mem_read(r->addr + i, 1) != r->sig[i])
+			return 0;
+	return 1;
+}
+
+static uint8_t spi_operand(Z80Context *c, int op, unsigned i)
+{
+	if (op & SPI_CONST)
+		return op;
+	if (op & SPI_PTR)
+		return do_mem_read(spi_get(c, op & 0xFF) + i, 1);
+	return spi_get(c, op);
+}
+
+/* Finish the routine from its first OUT on. The port writes go through the
+   PIO just as the guest's would. If buf is given the bytes received into
+   memory are put there instead. Returns the bytes done, or 0 if the OUT
+   isn't sending the byte the table says */
+static unsigned spi_run(struct spi_routine *r, Z80Context *c, unsigned port, uint8_t *buf)
+{
+	uint8_t base = pio->data[port] & ~(sd_clock | sd_mosi);
+	uint8_t tx, rx = 0, v;
+	unsigned n = 1;
+	unsigned i, b;
+
+	if (!(pio->data[port] & sd_mosi) != !(spi_operand(c, r->in, 0) & 0x80))
+		return 0;
+	if (r->count != SPI_NONE) {
+		n = spi_get(c, r->count);
+		if (n == 0)
+			n = r->count == SPI_B ? 0x100 : 0x10000;
+	}
+	for (i = 0; i < n; i++) {
+		tx = spi_operand(c, r->in, i);
+		for (b = 0; b < 8; b++) {
+			v = base | ((tx & (0x80 >> b)) ? sd_mosi : 0);
+			/* The first went out on the OUT we were called from */
+			if (i || b)
+				pio_write(port << 1, v);
+			pio_write(port << 1, v | sd_clock);
+			rx <<= 1;
+			rx |= (pio->in[sd_port] & sd_miso) ? 1 : 0;
+		}
+		if (r->end != SPI_NONE)
+			pio_write(port << 1, r->end);
+		if (r->outp != SPI_NONE) {
+			if (buf)
+				buf[i] = rx;
+			else
+				spi_mem_write(spi_get(c, r->outp & 0xFF) + i, rx);
+		}
+	}
+	if (r->outp != SPI_NONE)
+		spi_set(c, r->outp & 0xFF, spi_get(c, r->outp & 0xFF) + n);
+	if (r->out != SPI_NONE)
+		spi_set(c, r->out, rx);
+	if (r->in & SPI_PTR)
+		spi_set(c, r->in & 0xFF, spi_get(c, r->in & 0xFF) + n);
+	if (r->count != SPI_NONE)
+		spi_set(c, r->count, 0);
+	for (i = 0; i < r->nset; i++)
+		spi_set(c, r->setreg[i], r->setval[i]);
+	c->PC = r->exit;
+	c->tstates += r->cycles + r->each * (n - 1);
+	c->instructions += r->ops + r->opseach * (n - 1);
+	c->R = (c->R & 0x80) | ((c->R + r->m1 + r->m1each * (n - 1)) & 0x7F);
+	return n;
+}
+
+/* Called after each write to the port the card hangs off */
+static void spi_accel(unsigned port)
+{
+	struct spi_routine *r;
+
+	/* Only at the start of a byte with the card selected */
+	if (spi_busy || spi_pending || bb.bitct || bb.oldcs)
+		return;
+	if (pio->data[port] & sd_clock)
+		return;
+	for (r = spi_routines; r; r = r->next)
+		if (r->addr == cpu_z80.M1PC && spi_match(r))
+			break;
+	if (r == NULL)
+		return;
+	if (spi_verify) {
+		if (r->bad)
+			return;
+		spi_pending = r;
+		spi_cpu = cpu_z80;
+		spi_pio = *pio;
+		spi_bb = bb;
+		spi_port = port;
+		spi_clock = stats.cycles + cpu_z80.tstates;
+		spi_nrec = 0;
+		return;
+	}
+	/* Anyone watching the port or the CPU wants the slow path */
+	if (r->cycles == 0 || r->ops == 0 || r->m1 == 0 ||
+		(trace & (TRACE_IO | TRACE_CPU)) ||
+		(trigger_pending & (TRIGGER_IO | TRIGGER_PC)) || gdb)
+		return;
+	spi_busy = 1;
+	spi_run(r, &cpu_z80, port, NULL);
+	spi_busy = 0;
+}
+
+/* A byte went to the card while a routine was being checked, or while
+   its check is played back */
+static uint8_t spi_swap(uint8_t val, uint8_t r)
+{
+	if (spi_replay) {
+		if (spi_nplay < spi_nrec && spi_txrec[spi_nplay] == val)
+			return spi_rxrec[spi_nplay++];
+		spi_playbad = 1;
+		return 0xFF;
+	}
+	if (spi_nrec < SPI_RECORD) {
+		spi_txrec[spi_nrec] = val;
+		spi_rxrec[spi_nrec] = r;
+	}
+	spi_nrec++;
+	return r;
+}
+
+static void spi_fail(struct spi_routine *r, const char *what)
+{
+	fprintf(stderr, "spi: %s at %04X: %s.\n", r->name, r->addr, what);
+	r->bad = 1;
+}
+
+/* The guest got to the exit the slow way: see if the table agrees */
+static void spi_check(struct spi_routine *r)
+{
+	static uint8_t buf[0x10000];
+	Z80Context c = spi_cpu;
+	struct z80_pio now_pio = *pio;
+	struct bitbang now_bb = bb;
+	char what[64];
+	uint64_t clocks;
+	unsigned long ops;
+	unsigned n, i, fetch;
+	uint8_t rnow;
+	int ptr;
+
+	/* The exit instruction has been fetched and counted already */
+	fetch = 4;
+	switch(do_mem_read(r->exit, 1)) {
+	case 0xCB:
+	case 0xDD:
+	case 0xED:
+	case 0xFD:
+		fetch = 8;
+	}
+	clocks = stats.cycles + cpu_z80.tstates - fetch - spi_clock;
+	ops = cpu_z80.instructions - 1 - spi_cpu.instructions;
+	rnow = (cpu_z80.R & 0x80) | ((cpu_z80.R - fetch / 4) & 0x7F);
+
+	/* Play the same card replies to the table from the same start */
+	*pio = spi_pio;
+	bb = spi_bb;
+	spi_replay = 1;
+	spi_nplay = 0;
+	spi_playbad = 0;
+	spi_busy = 1;
+	n = spi_run(r, &c, spi_port, buf);
+	spi_busy = 0;
+	spi_replay = 0;
+
+	if (n == 0)
+		spi_fail(r, "the OUT is not sending the byte given by in=");
+	else if (spi_playbad)
+		spi_fail(r, "sent the card different bytes");
+	else if (spi_nplay != spi_nrec) {
+		snprintf(what, sizeof(what), "sent the card %u bytes, the table %u",
+			spi_nrec, spi_nplay);
+		spi_fail(r, what);
+	} else if (memcmp(pio, &now_pio, sizeof(now_pio)) ||
+		memcmp(&bb, &now_bb, sizeof(now_bb)))
+		spi_fail(r, "leaves the port differently, check end=");
+	for (i = 0; i < SPI_SP + 1 && !r->bad; i++) {
+		/* Pairs are checked by halves */
+		if ((r->ignore & (1 << i)) || (i >= SPI_BC && i <= SPI_BC + 2))
+			continue;
+		if (spi_get(&c, i) != spi_get(&cpu_z80, i)) {
+			snprintf(what, sizeof(what), "%s is %X, the table gives %X",
+				spi_regnames[i], spi_get(&cpu_z80, i), spi_get(&c, i));
+			spi_fail(r, what);
+		}
+	}
+	if (!r->bad && memcmp(&c.R2, &cpu_z80.R2, sizeof(c.R2)))
+		spi_fail(r, "the alternate registers changed");
+	if (!r->bad && r->outp != SPI_NONE) {
+		ptr = spi_get(&spi_cpu, r->outp & 0xFF);
+		for (i = 0; i < n; i++)
+			if (do_mem_read(ptr + i, 1) != buf[i])
+				break;
+		if (i < n)
+			spi_fail(r, "received different data into memory");
+	}
+	*pio = now_pio;
+	bb = now_bb;
+	if (r->bad)
+		return;
+	if (r->cycles && clocks != r->cycles + r->each * (n - 1)) {
+		snprintf(what, sizeof(what), "took %llu clocks for %u bytes, the table %u",
+			(unsigned long long)clocks, n, r->cycles + r->each * (n - 1));
+		spi_fail(r, what);
+	} else if (r->ops && ops != r->ops + r->opseach * (n - 1)) {
+		snprintf(what, sizeof(what), "ran %lu instructions for %u bytes, the table %u",
+			ops, n, r->ops + r->opseach * (n - 1));
+		spi_fail(r, what);
+	} else if (r->m1 && rnow != c.R) {
+		snprintf(what, sizeof(what), "R is %02X, the table gives %02X", rnow, c.R);
+		spi_fail(r, what);
+	} else if (r->checked++ == 0 || (!r->cycles && n != r->lastn))
+		fprintf(stderr, "spi: %s at %04X: checked, %llu clocks, %lu ops, %u m1 for %u bytes.\n",
+			r->name, r->addr, (unsigned long long)clocks, ops,
+			(rnow - spi_cpu.R) & 0x7F, n);
+	r->lastn = n;
+}
+
+/* Before each instruction while checking */
+static void spi_step(uint16_t pc)
+{
+	struct spi_routine *r = spi_pending;
+
+	if (r == NULL)
+		return;
+	if (pc == r->exit) {
+		spi_pending = NULL;
+		spi_check(r);
+	} else if (bb.oldcs || spi_nrec >= SPI_RECORD) {
+		spi_pending = NULL;
+		spi_fail(r, "never got to the exit");
+	}
+}
+
+static int spi_hex(const char *p, unsigned max, unsigned *v)
+{
+	char *e;
+
+	*v = strtoul(p, &e, 16);
+	return *p && *e == 0 && *v <= max;
+}
+
+static int spi_reg(const char *p)
+{
+	unsigned i;
+
+	for (i = 0; spi_regnames[i]; i++)
+		if (strcasecmp(p, spi_regnames[i]) == 0)
+			return i;
+	return SPI_NONE;
+}
+
+/* r, xx or (rr) */
+static int spi_arg(const char *p, int ptr, int cons)
+{
+	char rr[3];
+	unsigned v;
+	int r = spi_reg(p);
+
+	if (r != SPI_NONE && r != SPI_SP)
+		return r;
+	if (ptr && strlen(p) == 4 && p[0] == '(' && p[3] == ')') {
+		memcpy(rr, p + 1, 2);
+		rr[2] = 0;
+		r = spi_reg(rr);
+		if (r >= SPI_BC && r < SPI_SP)
+			return SPI_PTR + r;
+	}
+	if (cons && spi_hex(p, 0xFF, &v))
+		return SPI_CONST + v;
+	return -2;
+}
+
+static int spi_entry(struct spi_routine *r, char *p)
+{
+	char *t, *v;
+	unsigned n;
+	int reg;
+
+	t = strtok(p, " \t\n");
+	if (t == NULL || *t == '#')
+		return 0;
+	snprintf(r->name, sizeof(r->name), "%s", t);
+	if ((t = strtok(NULL, " \t\n")) == NULL || !spi_hex(t, 0xFFFF, &n))
+		return -1;
+	r->addr = n;
+	if ((t = strtok(NULL, " \t\n")) == NULL || strlen(t) % 2 ||
+		strlen(t) > 2 * SPI_SIGLEN)
+		return -1;
+	for (r->siglen = 0; *t; t += 2) {
+		char hex[3] = { t[0], t[1], 0 };
+		if (!spi_hex(hex, 0xFF, &n))
+			return -1;
+		r->sig[r->siglen++] = n;
+	}
+	if ((t = strtok(NULL, " \t\n")) == NULL || !spi_hex(t, 0xFFFF, &n))
+		return -1;
+	r->exit = n;
+	r->in = SPI_CONST + 0xFF;
+	r->out = SPI_NONE;
+	r->outp = SPI_NONE;
+	r->count = SPI_NONE;
+	r->end = SPI_NONE;
+	while ((t = strtok(NULL, " \t\n")) != NULL) {
+		v = strchr(t, '=');
+		if (v == NULL)
+			return -1;
+		*v++ = 0;
+		if (strcmp(t, "in") == 0) {
+			if ((r->in = spi_arg(v, 1, 1)) < 0)
+				return -1;
+		} else if (strcmp(t, "out") == 0) {
+			if ((reg = spi_arg(v, 1, 0)) < 0)
+				return -1;
+			if (reg & SPI_PTR)
+				r->outp = reg;
+			else
+				r->out = reg;
+		} else if (strcmp(t, "count") == 0) {
+			r->count = spi_reg(v);
+			if (r->count != SPI_B && r->count != SPI_BC)
+				return -1;
+		} else if (strcmp(t, "end") == 0) {
+			if (!spi_hex(v, 0xFF, &n))
+				return -1;
+			r->end = n;
+		} else if (strcmp(t, "cycles") == 0)
+			r->cycles = atoi(v);
+		else if (strcmp(t, "each") == 0)
+			r->each = atoi(v);
+		else if (strcmp(t, "ops") == 0)
+			r->ops = atoi(v);
+		else if (strcmp(t, "opseach") == 0)
+			r->opseach = atoi(v);
+		else if (strcmp(t, "m1") == 0)
+			r->m1 = atoi(v);
+		else if (strcmp(t, "m1each") == 0)
+			r->m1each = atoi(v);
+		else if ((reg = spi_reg(t)) != SPI_NONE) {
+			if (strcmp(v, "?") == 0) {
+				r->ignore |= 1 << reg;
+				/* and both halves of a pair */
+				if (reg >= SPI_BC && reg <= SPI_BC + 2)
+					r->ignore |= 3 << (2 * (reg - SPI_BC) + 2);
+			} else if (r->nset < SPI_SETS &&
+				spi_hex(v, reg < SPI_BC ? 0xFF : 0xFFFF, &n)) {
+				r->setreg[r->nset] = reg;
+				r->setval[r->nset++] = n;
+			} else
+				return -1;
+		} else
+			return -1;
+	}
+	if ((r->each || r->opseach || r->m1each) && r->count == SPI_NONE)
+		return -1;
+	return 1;
+}
+
+static void spi_load(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	struct spi_routine *r;
+	char buf[512];
+	unsigned line = 0;
+	int err;
+
+	if (f == NULL) {
+		perror(path);
+		exit(1);
+	}
+	while (fgets(buf, sizeof(buf), f)) {
+		line++;
+		r = calloc(1, sizeof(struct spi_routine));
+		if (r == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+		err = spi_entry(r, buf);
+		if (err == -1) {
+			fprintf(stderr, "%s:%u: bad SPI routine entry.\n", path, line);
+			exit(1);
+		}
+		if (err == 0) {
+			free(r);
+			continue;
+		}
+		r->next = spi_routines;
+		spi_routines = r;
+	}
+	fclose(f);
+	if (spi_txrec == NULL) {
+		spi_txrec = malloc(SPI_RECORD);
+		spi_rxrec = malloc(SPI_RECORD);
+		if (spi_txrec == NULL || spi_rxrec == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+	}
+}
+
 
 /*
  *	Emulate the switchable ROM card. We switch between the ROM and
@@ -1538,6 +2264,7 @@ static void toggle_rom(void)
 		bankreg[0] = 0;
 		bankreg[1] = 1;
 	}
+	map_memory();
 }
 
 /*
@@ -1548,19 +2275,26 @@ static void toggle_rom(void)
 static uint8_t sbc64_cpld_status;
 static uint8_t sbc64_cpld_char;
 
-static void sbc64_cpld_timer(void)
+/* Returns non zero if more input is on its way */
+static int sbc64_cpld_timer(void)
 {
+	unsigned r = 0;
 	/* Don't allow overruns - hack for convenience when pasting hex files */
 	if (!(sbc64_cpld_status & 1)) {
-		if (check_chario() & 1) {
+		r = console.ready(&console);
+		if (r & 1) {
 			sbc64_cpld_status |= 1;
-			sbc64_cpld_char = next_char();
+			sbc64_cpld_char = console.get(&console);
 		}
 	}
+	return r & 5;
 }
 
 static uint8_t sbc64_cpld_uart_rx(void)
 {
+	/* Nothing is looked for while a byte waits, so start again */
+	if (sbc64_cpld_status & 1)
+		serial_due(cpld_t);
 	sbc64_cpld_status &= ~1;
 	if (trace & TRACE_CPLD)
 		fprintf(stderr, "CPLD rx %02X.\n", sbc64_cpld_char);
@@ -1602,10 +2336,9 @@ static void sbc64_cpld_uart_tx(uint8_t val)
 		if (val & 1) {
 			if (trace & TRACE_CPLD)
 				fprintf(stderr, "[stop]");
-			putchar(bits);
-			fflush(stdout);
+			console.put(&console, bits);
 		} else	/* Framing error should be a stop bit */
-			putchar('?');
+			console.put(&console, '?');
 		bitcount = 0;
 		bits = 0;
 		return;
@@ -1628,6 +2361,7 @@ static void sbc64_cpld_bankreg(uint8_t val)
 			fprintf(stderr, "Bank set to %02X\n", val);
 		bankreg[0] = val;
 	}
+	map_memory();
 }
 
 static uint8_t z84c15_read(uint8_t port)
@@ -1678,9 +2412,11 @@ static void z84c15_write(uint8_t port, uint8_t val)
 			break;
 		case 2:
 			z84c15.csbr = val;
+			map_memory();
 			break;
 		case 3:
 			z84c15.mcr = val;
+			map_memory();
 			break;
 		default:
 			fprintf(stderr, "Read invalid SCRP  %d\n", z84c15.scrp);
@@ -1696,6 +2432,44 @@ static void z84c15_write(uint8_t port, uint8_t val)
 	}
 }
 
+/* The serial chips look after their timers and the interrupt lines they
+   drive as the CPU talks to them */
+static uint8_t my_acia_read(uint8_t addr)
+{
+	uint8_t r = acia_read(acia, addr);
+	poll_irq_nonim2();
+	return r;
+}
+
+static void my_acia_write(uint8_t addr, uint8_t val)
+{
+	acia_write(acia, addr, val);
+	/* The transmitter is free again a character later */
+	if (addr)
+		serial_due(acia_t);
+	poll_irq_nonim2();
+}
+
+static void my_sio_write(uint8_t addr, uint8_t val)
+{
+	sio_write(sio, addr, val);
+	if (!(addr & 1))
+		serial_due(sio_t);
+}
+
+static uint8_t my_uart_read(uint8_t addr)
+{
+	uint8_t r = uart16x50_read(uart, addr);
+	poll_irq_nonim2();
+	return r;
+}
+
+static void my_uart_write(uint8_t addr, uint8_t val)
+{
+	uart16x50_write(uart, addr, val);
+	poll_irq_nonim2();
+}
+
 static uint8_t sio_kport[4] = {
 	SIOA_D,
 	SIOA_C,
@@ -1723,7 +2497,7 @@ static void kio_write(uint8_t addr, uint8_t val)
 	else if (addr < 0x08)
 		ctc_write(addr & 3, val);
 	else if (addr < 0x0C)
-		sio_write(sio, sio_kport[addr & 3], val);
+		my_sio_write(sio_kport[addr & 3], val);
 	/* PIA and KIO control - TODO */
 }
 
@@ -1733,6 +2507,13 @@ static void fdc_log(int debuglevel, char *fmt, va_list ap)
 		vfprintf(stderr, "fdc: ", ap);
 }
 
+/* The FDC only needs ticking while it has a command or interrupt pending */
+static void fdc_due(void)
+{
+	if (fdc_busy(fdc))
+		device_due(fdc_t, pass_clocks);
+}
+
 static void fdc_write(uint8_t addr, uint8_t val)
 {
 	switch(addr) {
@@ -1802,6 +2583,7 @@ static void fdc_write(uint8_t addr, uint8_t val)
 	default:
 		fprintf(stderr, "FDC bogus %02X->%02X\n", addr, val);
 	}
+	fdc_due();
 }
 
 static uint8_t fdc_read(uint8_t addr)
@@ -1826,6 +2608,7 @@ static uint8_t fdc_read(uint8_t addr)
 		fprintf(stderr, "FDC bogus read %02X: ", addr);
 	}
 	fprintf(stderr, "%02X\n", val);
+	fdc_due();
 	return val;
 }
 
@@ -2028,11 +2811,11 @@ static uint8_t io_read_2014(uint16_t addr)
 	if ((addr == 0x42 || addr == 0x43) && amd9511)
 		return amd9511_read(amd9511, addr);
 	if ((addr >= 0xA0 && addr <= 0xA7) && acia && acia_narrow == 1)
-		return acia_read(acia, addr & 1);
+		return my_acia_read(addr & 1);
 	if ((addr >= 0x80 && addr <= 0x87) && acia && acia_narrow == 2)
-		return acia_read(acia, addr & 1);
+		return my_acia_read(addr & 1);
 	if ((addr >= 0x80 && addr <= 0xBF) && acia && !acia_narrow)
-		return acia_read(acia, addr & 1);
+		return my_acia_read(addr & 1);
 	if ((addr >= 0x80 && addr <= 0x87) && sio && !have_kio)
 		return sio_read(sio, sio_port[addr & 3]);
 	if ((addr >= 0x10 && addr <= 0x17) && ide == 1)
@@ -2061,7 +2844,7 @@ static uint8_t io_read_2014(uint16_t addr)
 		return r;
 	}
 	if (addr >= 0xA0 && addr <= 0xA7 && have_16x50)
-		return uart16x50_read(uart, addr & 7);
+		return my_uart_read(addr & 7);
 	if (addr == 0x6D && is_z512)
 		return z512_read(addr);
 	if (addr >= 0x58 && addr <= 0x5F && ncr && !extreme)
@@ -2126,13 +2909,13 @@ static void io_write_2014(uint16_t addr, uint8_t val, uint8_t known)
 	else if (addr >= 0x40 && addr <= 0x41)
 		propgfx_write(addr & 1, val);
 	else if ((addr >= 0xA0 && addr <= 0xA7) && acia && acia_narrow == 1)
-		acia_write(acia, addr & 1, val);
+		my_acia_write(addr & 1, val);
 	else if ((addr >= 0x80 && addr <= 0x87) && acia && acia_narrow == 2)
-		acia_write(acia, addr & 1, val);
+		my_acia_write(addr & 1, val);
 	else if ((addr >= 0x80 && addr <= 0xBF) && acia && !acia_narrow)
-		acia_write(acia, addr & 1, val);
+		my_acia_write(addr & 1, val);
 	else if ((addr >= 0x80 && addr <= 0x87) && sio && !have_kio)
-		sio_write(sio, sio_port[addr & 3], val);
+		my_sio_write(sio_port[addr & 3], val);
 	else if ((addr >= 0x10 && addr <= 0x17) && ide == 1)
 		my_ide_write(addr & 7, val);
 	else if (addr >= 0x20 && addr <= 0x27 && ide == 2)
@@ -2146,20 +2929,24 @@ static void io_write_2014(uint16_t addr, uint8_t val, uint8_t known)
 		bankreg[addr & 3] = val & 0x3F;
 		if (trace & TRACE_512)
 			fprintf(stderr, "Bank %d set to %d\n", addr & 3, val);
+		map_memory();
 	} else if (bank512 && addr >= 0x7C && addr <= 0x7F) {
 		if (trace & TRACE_512)
 			fprintf(stderr, "Banking %sabled.\n", (val & 1) ? "en" : "dis");
 		bankenable = val & 1;
+		map_memory();
 	} else if (addr == 0xBB && ps2)
 		ps2_write(val);
 	else if (addr == 0xC0 && rtc && !extreme)
 		rtc_write(rtc, val);
 	else if (addr >= 0x88 && addr <= 0x8B && have_ctc)
 		ctc_write(addr & 3, val);
-	else if ((addr == 0x98 || addr == 0x99) && vdp)
+	else if ((addr == 0x98 || addr == 0x99) && vdp) {
 		tms9918a_write(vdp, addr & 1, val);
+		poll_irq_nonim2();
+	}
 	else if (addr >= 0xA0 && addr <= 0xA7 && have_16x50)
-		uart16x50_write(uart, addr & 7, val);
+		my_uart_write(addr & 7, val);
 	else if (addr == 0x6D && is_z512)
 		z512_write(addr, val);
 	else if (addr == 0x6F && is_z512)
@@ -2178,12 +2965,10 @@ static void io_write_2014(uint16_t addr, uint8_t val, uint8_t known)
 	else if (addr == 0xFF && sn)
 		sn76489_write(sn, val);
 	else if (addr == 0xFD) {
-		trace &= 0xFF00;
-		trace |= val;
+		set_trace((trace & 0xFF00) | val);
 		fprintf(stderr, "trace set to %04X\n", trace);
 	} else if (addr == 0xFE) {
-		trace &= 0xFF;
-		trace |= val << 8;
+		set_trace((trace & 0xFF) | (val << 8));
 		fprintf(stderr, "trace set to %d\n", trace);
 	} else if (!known && (trace & TRACE_UNK))
 		fprintf(stderr, "Unknown write to port %04X of %02X\n", addr, val);
@@ -2249,7 +3034,7 @@ static void io_write_4(uint16_t addr, uint8_t val)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	addr &= 0xFF;
 	if (addr >= 0x80 && addr <= 0x83)
-		sio_write(sio, sio_port4[addr & 3], val);
+		my_sio_write(sio_port4[addr & 3], val);
 	else if ((addr >= 0x10 && addr <= 0x17) && ide == 1)
 		my_ide_write(addr & 7, val);
 	else if (addr >= 0x28 && addr <= 0x2C && have_wiznet)
@@ -2259,20 +3044,21 @@ static void io_write_4(uint16_t addr, uint8_t val)
 		bankreg[addr & 3] = val & 0x3F;
 		if (trace & TRACE_512)
 			fprintf(stderr, "Bank %d set to %d\n", addr & 3, val);
+		map_memory();
 	} else if (bank512 && addr >= 0x7C && addr <= 0x7F) {
 		if (trace & TRACE_512)
 			fprintf(stderr, "Banking %sabled.\n", (val & 1) ? "en" : "dis");
 		bankenable = val & 1;
+		map_memory();
 	} else if (addr == 0xC0 && rtc)
 		rtc_write(rtc, val);
 	else if (addr >= 0x88 && addr <= 0x8B)
 		ctc_write(addr & 3, val);
-	else if (addr == 0xFC) {
-		putchar(val);
-		fflush(stdout);
-	} else if (addr == 0xFD) {
+	else if (addr == 0xFC)
+		console.put(&console, val);
+	else if (addr == 0xFD) {
 		fprintf(stderr, "trace set to %d\n", val);
-		trace = val;
+		set_trace(val);
 	} else if (trace & TRACE_UNK)
 		fprintf(stderr, "Unknown write to port %04X of %02X\n", addr, val);
 }
@@ -2307,7 +3093,7 @@ static void io_write_5(uint16_t addr, uint8_t val)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	addr &= 0xFF;
 	if (addr >= 0x18 && addr <= 0x1B)
-		sio_write(sio, sio_port4[addr & 3], val);
+		my_sio_write(sio_port4[addr & 3], val);
 	else if ((addr >= 0x90 && addr <= 0x97) && ide == 1)
 		my_ide_write(addr & 7, val);
 	else if (addr >= 0x28 && addr <= 0x2C && have_wiznet)
@@ -2317,10 +3103,12 @@ static void io_write_5(uint16_t addr, uint8_t val)
 		bankreg[addr & 3] = val & 0x3F;
 		if (trace & TRACE_512)
 			fprintf(stderr, "Bank %d set to %d\n", addr & 3, val);
+		map_memory();
 	} else if (bank512 && addr >= 0x7C && addr <= 0x7F) {
 		if (trace & TRACE_512)
 			fprintf(stderr, "Banking %sabled.\n", (val & 1) ? "en" : "dis");
 		bankenable = val & 1;
+		map_memory();
 	} else if (addr == 0xC0 && rtc)
 		rtc_write(rtc, val);
 	else if (addr >= 0x10 && addr <= 0x13)
@@ -2329,12 +3117,11 @@ static void io_write_5(uint16_t addr, uint8_t val)
 		pio_write(addr & 3, val);
 	else if ((addr >= 0xEE && addr <= 0xF1) || addr == 0xF4)
 		z84c15_write(addr, val);
-	else if (addr == 0xFC) {
-		putchar(val);
-		fflush(stdout);
-	} else if (addr == 0xFD) {
+	else if (addr == 0xFC)
+		console.put(&console, val);
+	else if (addr == 0xFD) {
 		fprintf(stderr, "trace set to %d\n", val);
-		trace = val;
+		set_trace(val);
 	} else if (trace & TRACE_UNK)
 		fprintf(stderr, "Unknown write to port %04X of %02X\n", addr, val);
 }
@@ -2346,6 +3133,7 @@ static void io_write_1(uint16_t addr, uint8_t val)
 		if (val != port38 && (trace & TRACE_ROM))
 			fprintf(stderr, "Bank set to %02X\n", val);
 		port38 = val;
+		map_memory();
 		return;
 	}
 	io_write_2014(addr, val, 0);
@@ -2419,11 +3207,13 @@ static void io_write_2(uint16_t addr, uint8_t val)
 		if (trace & TRACE_ROM)
 			fprintf(stderr, "RAM Bank set to %02X\n", val);
 		port30 = val;
+		map_memory();
 		return;
 	case 0x38:
 		if (trace & TRACE_ROM)
 			fprintf(stderr, "ROM Bank set to %02X\n", val);
 		port38 = val;
+		map_memory();
 		return;
 	}
 	io_write_2014(addr, val, known);
@@ -2453,7 +3243,7 @@ static void io_write_micro80(uint16_t addr, uint8_t val)
 	if (r >= 0x10 && r <= 0x13)
 		ctc_write(addr & 3, val);
 	else if (r >= 0x18 && r <= 0x1B)
-		sio_write(sio, sio_port4[r & 3], val);
+		my_sio_write(sio_port4[r & 3], val);
 	else if (r >= 0x1C && r <= 0x1F)
 		pio_write(r & 3, val);
 	else if ((r >= 0xEE && r <= 0xF1) || r == 0xF4)
@@ -2462,7 +3252,7 @@ static void io_write_micro80(uint16_t addr, uint8_t val)
 		my_ide_write(r & 0x07, val);
 	else if (addr == 0xFD) {
 		fprintf(stderr, "trace set to %d\n", val);
-		trace = val;
+		set_trace(val);
 	} else if (trace & TRACE_UNK)
 		fprintf(stderr, "Unknown write to port %04X of %02X\n", addr, val);
 }
@@ -2479,12 +3269,14 @@ static void io_write_micro80w(uint16_t addr, uint8_t val)
 		bankreg[r & 3] = val & 0x3F;
 		if (trace & TRACE_512)
 			fprintf(stderr, "Bank %d set to %d\n", r & 3, val);
+		map_memory();
 		return;
 	}
 	if (r >= 0x7C && r <= 0x7F) {
 		if (trace & TRACE_512)
 			fprintf(stderr, "Banking %sabled.\n", (val & 1) ? "en" : "dis");
 		bankenable = val & 1;
+		map_memory();
 		return;
 	}
 	io_write_micro80(addr, val);
@@ -2496,6 +3288,7 @@ static void io_write_pdog(uint16_t addr, uint8_t val)
 		if (cpuboard == CPUBOARD_PDOG512)
 			val &= 0x8F;
 		pick_bank = val;
+		map_memory();
 	} else
 		io_write_2014(addr, val, 0);
 }
@@ -2530,6 +3323,7 @@ static void io_write_sc720(uint16_t addr, uint8_t val)
 		bankreg[0] = (val >> 1) & 0x1F;
 		if (trace & TRACE_512)
 			fprintf(stderr, "*** Lower bank now %02X\n", bankreg[0]);
+		map_memory();
 		return;
 	}
 	io_write_2014(addr, val, known);
@@ -2550,19 +3344,23 @@ static void io_write_sc707(uint16_t addr, uint8_t val)
 		bankreg[0] &= 2;
 		bankreg[0] |= val & 1;
 		known = 1;
+		map_memory();
 		break;
 	case 0x28:	/* ROM A16 */
 		bankreg[0] &= 1;
 		bankreg[0] |= (val & 1) << 1;
 		known = 1;
+		map_memory();
 		break;
 	case 0x30:	/* RAM A16 */
 		port30 = val & 1;
 		known = 1;
+		map_memory();
 		break;
 	case 0x38:	/* ROM / RAM low */
 		port38 = val & 1;
 		known = 1;
+		map_memory();
 		break;
 	}
 	io_write_2014(addr, val, known);
@@ -2572,6 +3370,7 @@ static void io_write_tp128(uint16_t addr, uint8_t val)
 {
 	if ((addr & 0x00F0) == 0x30) {
 		port38 = val & 3;
+		map_memory();
 		io_write_2014(addr, val, 1);
 	} else
 		io_write_2014(addr, val, 0);
@@ -2615,103 +3414,172 @@ static void io_write_ez512(uint16_t addr, uint8_t val)
 		ez512_base |= (val & 0x40) ? 0x40000 : 0;
 		if (trace & TRACE_512)
 			fprintf(stderr, "base now %05X ", ez512_base);
+		map_memory();
 
 	}
 	kio_write(addr, val);
 }
 
+static void io_write_0(uint16_t addr, uint8_t val)
+{
+	io_write_2014(addr, val, 0);
+}
+
+static void io_write_0x(uint16_t addr, uint8_t val)
+{
+	io_write_2014_x(addr, val, 0);
+}
+
+static uint8_t io_read_0(uint16_t addr)
+{
+	if (extreme)
+		return io_read_2014_x(addr);
+	return io_read_2014(addr);
+}
+
 void io_write(int unused, uint16_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr & 0xFF);
+	/* A test case reporting its result, see fanout.h */
+	if (fanout_active && (addr & 0xFF) == 0xFB)
+		fanout_exit(val);
+	io_port = addr;
+	board_io_write(addr, val);
+}
+
+uint8_t io_read(int unused, uint16_t addr)
+{
+	io_port = addr;
+	return board_io_read(addr);
+}
+
+/* INIR/OTIR of a whole sector at the IDE data register */
+static unsigned io_block_in(int unused, uint16_t addr, uint8_t *buf, unsigned n)
+{
+	if ((addr & 0xFF) != ide_in_port || (trace & (TRACE_IO | TRACE_IDE)))
+		return 0;
+	return ide_read_block(ide0, buf, n, 1);
+}
+
+static unsigned io_block_out(int unused, uint16_t addr, const uint8_t *buf, unsigned n)
+{
+	if ((addr & 0xFF) != ide_out_port || (trace & (TRACE_IO | TRACE_IDE)) ||
+		(trigger_pending & TRIGGER_IO))
+		return 0;
+	return ide_write_block(ide0, buf, n, 1);
+}
+
+/* The board can't change once we are running, so pick its handlers once
+   instead of switching on every access */
+static void bind_board(void)
+{
+	board_io_read = io_read_0;
+	board_mem_page = NULL;
 	switch (cpuboard) {
 	case CPUBOARD_Z80:
-		if (extreme)
-			io_write_2014_x(addr, val, 0);
-		else
-			io_write_2014(addr, val, 0);
+	case CPUBOARD_EASYZ80:
+	case CPUBOARD_TINYZ80:
+		board_mem_read = mem_read0;
+		board_mem_write = mem_write0;
+		board_mem_page = mem_page0;
+		if (cpuboard == CPUBOARD_Z80)
+			board_io_write = extreme ? io_write_0x : io_write_0;
+		else if (cpuboard == CPUBOARD_EASYZ80) {
+			board_io_read = io_read_4;
+			board_io_write = io_write_4;
+		} else {
+			board_io_read = io_read_5;
+			board_io_write = io_write_5;
+		}
 		break;
 	case CPUBOARD_SC108:
-		io_write_1(addr, val);
+		board_mem_read = mem_read108;
+		board_mem_write = mem_write108;
+		board_mem_page = mem_page108;
+		board_io_write = io_write_1;
 		break;
 	case CPUBOARD_SC114:
 	case CPUBOARD_SC121:
-		io_write_2(addr, val);
+		board_mem_read = mem_read114;
+		board_mem_write = mem_write114;
+		board_mem_page = mem_page114;
+		board_io_read = io_read_2;
+		board_io_write = io_write_2;
 		break;
 	case CPUBOARD_Z80SBC64:
-	case CPUBOARD_ZRCC:
-		io_write_3(addr, val);
+		board_mem_read = mem_read64;
+		board_mem_write = mem_write64;
+		board_mem_page = mem_page64;
+		board_io_read = io_read_3;
+		board_io_write = io_write_3;
 		break;
-	case CPUBOARD_EASYZ80:
-		io_write_4(addr, val);
+	case CPUBOARD_ZRCC:
+		board_mem_read = mem_readzrcc;
+		board_mem_write = mem_writezrcc;
+		board_mem_page = mem_pagezrcc;
+		board_io_read = io_read_3;
+		board_io_write = io_write_3;
 		break;
 	case CPUBOARD_MICRO80:
-		io_write_micro80(addr, val);
-		break;
-	case CPUBOARD_TINYZ80:
-		io_write_5(addr, val);
+		board_mem_read = mem_read_micro80;
+		board_mem_write = mem_write_micro80;
+		board_mem_page = mem_page_micro80;
+		board_io_read = io_read_micro80;
+		board_io_write = io_write_micro80;
 		break;
 	case CPUBOARD_PDOG128:
-	case CPUBOARD_PDOG512:
-		io_write_pdog(addr, val);
+		board_mem_read = mem_read_pickled128;
+		board_mem_write = mem_write_pickled128;
+		board_mem_page = mem_page_pickled128;
+		board_io_write = io_write_pdog;
 		break;
+	case CPUBOARD_PDOG512:
+		board_mem_read = mem_read_pickled512;
+		board_mem_write = mem_write_pickled512;
+		board_mem_page = mem_page_pickled512;
+		board_io_write = io_write_pdog;
 		break;
 	case CPUBOARD_MICRO80W:
-		io_write_micro80w(addr, val);
+		board_mem_read = mem_read_micro80w;
+		board_mem_write = mem_write_micro80w;
+		board_mem_page = mem_page_micro80w;
+		board_io_read = io_read_micro80w;
+		board_io_write = io_write_micro80w;
 		break;
 	case CPUBOARD_ZRC:
-		io_write_zrc(addr, val);
+		/* No page map: the handlers have a debug hook on 0xB058 */
+		board_mem_read = mem_readzrc;
+		board_mem_write = mem_writezrc;
+		board_io_write = io_write_zrc;
 		break;
 	case CPUBOARD_SC720:
-		io_write_sc720(addr, val);
+		board_mem_read = mem_read_sc720;
+		board_mem_write = mem_write_sc720;
+		board_mem_page = mem_page_sc720;
+		board_io_write = io_write_sc720;
 		break;
 	case CPUBOARD_SC707:
-		io_write_sc707(addr, val);
+		board_mem_read = mem_read_sc707;
+		board_mem_write = mem_write_sc707;
+		board_mem_page = mem_page_sc707;
+		board_io_write = io_write_sc707;
 		break;
 	case CPUBOARD_TP128:
-		io_write_tp128(addr, val);
-		break;
-	case CPUBOARD_EASY512:
-		io_write_ez512(addr, val);
+		board_mem_read = mem_read_tp128;
+		board_mem_write = mem_write_tp128;
+		board_mem_page = mem_page_tp128;
+		board_io_write = io_write_tp128;
 		break;
-	default:
-		fprintf(stderr, "bad cpuboard\n");
-		exit(1);
-	}
-}
-
-uint8_t io_read(int unused, uint16_t addr)
-{
-	switch (cpuboard) {
-	case CPUBOARD_Z80:
-	case CPUBOARD_SC108:
-	case CPUBOARD_PDOG128:
-	case CPUBOARD_PDOG512:
-	case CPUBOARD_ZRC:
-	case CPUBOARD_SC720:
-	case CPUBOARD_SC707:
-	case CPUBOARD_TP128:
-		if (extreme)
-			return io_read_2014_x(addr);
-		else
-			return io_read_2014(addr);
-	case CPUBOARD_SC114:
-	case CPUBOARD_SC121:
-		return io_read_2(addr);
-	case CPUBOARD_Z80SBC64:
-	case CPUBOARD_ZRCC:
-		return io_read_3(addr);
-	case CPUBOARD_EASYZ80:
-		return io_read_4(addr);
-	case CPUBOARD_MICRO80:
-		return io_read_micro80(addr);
-	case CPUBOARD_TINYZ80:
-		return io_read_5(addr);
-	case CPUBOARD_MICRO80W:
-		return io_read_micro80w(addr);
 	case CPUBOARD_EASY512:
-		return io_read_ez512(addr);
+		board_mem_read = mem_read_ez512;
+		board_mem_write = mem_write_ez512;
+		board_mem_page = mem_page_ez512;
+		board_io_read = io_read_ez512;
+		board_io_write = io_write_ez512;
 		break;
 	default:
-		fprintf(stderr, "bad cpuboard\n");
+		fputs("invalid cpu type.\n", stderr);
 		exit(1);
 	}
 }
@@ -2780,7 +3648,7 @@ void recalc_interrupts(void)
 	poll_irq_event();
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	if (live_irq && (trace & TRACE_IRQ))
 		fprintf(stderr, "RETI\n");
@@ -2816,6 +3684,384 @@ static void reti_event(void)
 	poll_irq_event();
 }
 
+/*
+ *	Device timers. The serial ports look again a character time after a
+ *	byte goes out or comes in, and otherwise check for input every pass
+ *	(10 * tstate_steps). The CTC runs when a counter it needs reaches zero.
+ *	The video, PS/2 and coprocessor run every slice (a tenth of
+ *	tstate_steps), the floppy and UI every pass and the video and host
+ *	pacing every 20ms.
+ */
+static unsigned slice_clocks;
+
+static void tick_ef9345(void *priv, unsigned long clocks)
+{
+	ef9345_cycles(ef9345, clocks * 200 / slice_clocks);
+}
+
+static void tick_copro(void *priv, unsigned long clocks)
+{
+	z180copro_run(copro);
+}
+
+static void tick_ps2(void *priv, unsigned long clocks)
+{
+	ps2_event(ps2, clocks);
+}
+
+/* A port with a byte on the move looks again a character later. One
+   that is only waiting for input can be put off while the CPU is halted */
+static void serial_next(struct timerq_timer *t, int busy)
+{
+	timerq_idle(t, !busy);
+	timerq_in(t, busy ? serial_clocks : pass_clocks);
+}
+
+static void tick_acia(void *priv, unsigned long clocks)
+{
+	serial_next(acia_t, acia_timer(acia));
+	poll_irq_nonim2();
+}
+
+static void tick_sio(void *priv, unsigned long clocks)
+{
+	serial_next(sio_t, sio_timer(sio));
+}
+
+static void tick_16x50(void *priv, unsigned long clocks)
+{
+	serial_next(uart_t, uart16x50_event(uart));
+	poll_irq_nonim2();
+}
+
+static void tick_cpld(void *priv, unsigned long clocks)
+{
+	int busy = sbc64_cpld_timer();
+	/* Nothing to look for until the guest takes the byte waiting */
+	if (!(sbc64_cpld_status & 1))
+		serial_next(cpld_t, busy);
+}
+
+static void tick_ctc(void *priv, unsigned long clocks)
+{
+	ctc_catchup();
+	ctc_schedule();
+	/* Deliver it now rather than at the next frame */
+	if (ctc_irqmask)
+		poll_irq_event();
+}
+
+static void tick_uartclk(void *priv, unsigned long clocks)
+{
+	/* Feed the uart clock into the CTC */
+	int c;
+	/* 10Mhz so calculate for 500 tstates.
+	   CTC 2 runs at half uart clock */
+	for (c = 0; c < 46; c++) {
+		ctc_receive_pulse(0);
+		ctc_receive_pulse(1);
+		ctc_receive_pulse(2);
+		ctc_receive_pulse(0);
+		ctc_receive_pulse(1);
+	}
+}
+
+static void tick_fdc(void *priv, unsigned long clocks)
+{
+	fdc_tick(fdc);
+	if (fdc_busy(fdc))
+		timerq_in(fdc_t, pass_clocks);
+}
+
+static void tick_ui(void *priv, unsigned long clocks)
+{
+	/* We want to run UI events regularly it seems */
+	if (ui_event())
+		emulator_done = 1;
+}
+
+static void tick_profile(void *priv, unsigned long clocks)
+{
+	/* Catch up with the last instruction run */
+	if (profile_stacks)
+		profile_z80(cpu_z80.PC);
+	profile_sample(cpu_z80.PC);
+}
+
+static void tick_frame(void *priv, unsigned long clocks)
+{
+	unsigned long ns;
+
+	if (is_z512 && (z512_control & 0x20)) {
+		if (z512_wdog <= 5) {
+			fprintf(stderr, "Watchdog reset.\n");
+			emulator_done = 1;
+			return;
+		}
+		z512_wdog -= 5;
+	}
+	/* TODO: coprocessor int to main if we implement it */
+
+	/* 50Hz which is near enough */
+	if (vdp) {
+		tms9918a_rasterize(vdp);
+		tms9918a_render(vdprend);
+	}
+	if (ef9345) {
+		ef9345_rasterize(ef9345);
+		ef9345_render(ef9345rend);
+	}
+	if (tft) {
+		tft_rasterize(tft);
+		tft_render(tftrend);
+	}
+	if (vdp || ef9345 || tft)
+		stats.frames++;
+	/* The TMS9918A interrupts at the end of the frame */
+	if (vdp)
+		poll_irq_nonim2();
+	if (have_wiznet)
+		w5100_process(wiz);
+	/* Wait until 20ms of real time has passed since the last frame */
+	ns = clocks * 20000000ULL / (tstate_steps * 400);
+	if (trigger_pending & TRIGGER_TIME)
+		trigger_elapsed(ns);
+	if (!fast && !trigger_pending)
+		realtime_sleep(ns);
+	console_flush();
+	/* Drop the PC watch once the trigger has gone off */
+	if (cpu_z80.trace && !(trace & TRACE_CPU) && !trigger_pending)
+		set_trace(trace);
+	/* Non IM2 devices just hold interrupt */
+	/* If there is no pending Z80 vector IRQ but we think
+	   there now might be one we use the same logic as for
+	   reti */
+	if (!live_irq || !have_im2)
+		poll_irq_event();
+}
+
+static struct timerq_timer *add_timer(const char *name, timerq_fn fn, unsigned long period, unsigned flags)
+{
+	struct timerq_timer *t = timerq_timer(timers, name, fn, NULL, flags);
+	timerq_every(t, period);
+	return t;
+}
+
+/* Only the devices present get a timer. They are added in the order the
+   old fixed loop polled them so ties run in the same order. The serial
+   ports start out idle, the CTC waits to be programmed and the FDC for a
+   command */
+static void setup_timers(void)
+{
+	unsigned long pass = tstate_steps * 10;
+
+	slice_clocks = (tstate_steps + 5) / 10;
+	pass_clocks = pass;
+	/* tstate_steps is 50us worth, a character 86.8us */
+	serial_clocks = tstate_steps * 125 / 72;
+	timers = timerq_create();
+	if (ef9345)
+		add_timer("ef9345", tick_ef9345, slice_clocks, TQ_IDLE);
+	if (copro)
+		add_timer("copro", tick_copro, slice_clocks, 0);
+	if (ps2)
+		add_timer("ps2", tick_ps2, slice_clocks, TQ_IDLE);
+	if (acia)
+		acia_t = add_timer("acia", tick_acia, pass, TQ_IDLE);
+	if (sio)
+		sio_t = add_timer("sio", tick_sio, pass, TQ_IDLE);
+	if (have_16x50)
+		uart_t = add_timer("16x50", tick_16x50, pass, TQ_IDLE);
+	if (have_cpld_serial)
+		cpld_t = add_timer("cpld", tick_cpld, pass, TQ_IDLE);
+	if (have_ctc || have_kio || have_kio_ext)
+		ctc_t = timerq_timer(timers, "ctc", tick_ctc, NULL, 0);
+	if (cpuboard == CPUBOARD_EASYZ80 || cpuboard == CPUBOARD_TINYZ80)
+		add_timer("uartclk", tick_uartclk, pass, 0);
+	fdc_t = timerq_timer(timers, "fdc", tick_fdc, NULL, 0);
+	add_timer("ui", tick_ui, pass, TQ_IDLE);
+	add_timer("frame", tick_frame, pass * 40, 0);
+	if (profpath)
+		add_timer("profile", tick_profile, profile_every, 0);
+}
+
+/*
+ *	Snapshots. SIGUSR2 saves the machine at the end of the current slice
+ *	and -L restores one in place of the reset state. The floppy, network,
+ *	video other than the TMS9918A and the coprocessor are not saved.
+ */
+
+static volatile sig_atomic_t snap_wanted;
+static const char *snap_path = "rc2014.snap";
+
+static void snap_signal(int sig)
+{
+	snap_wanted = 1;
+}
+
+static void snap_regs(struct snapshot *s, Z80Regs *r)
+{
+	snapshot_u16(s, &r->wr.AF);
+	snapshot_u16(s, &r->wr.BC);
+	snapshot_u16(s, &r->wr.DE);
+	snapshot_u16(s, &r->wr.HL);
+	snapshot_u16(s, &r->wr.IX);
+	snapshot_u16(s, &r->wr.IY);
+	snapshot_u16(s, &r->wr.SP);
+}
+
+static void snap_cpu(struct snapshot *s, void *unused)
+{
+	snap_regs(s, &cpu_z80.R1);
+	snap_regs(s, &cpu_z80.R2);
+	snapshot_u16(s, &cpu_z80.PC);
+	snapshot_u16(s, &cpu_z80.M1PC);
+	snapshot_u8(s, &cpu_z80.R);
+	snapshot_u8(s, &cpu_z80.I);
+	snapshot_u8(s, &cpu_z80.IFF1);
+	snapshot_u8(s, &cpu_z80.IFF2);
+	snapshot_u8(s, &cpu_z80.IM);
+	snapshot_u8(s, &cpu_z80.M1);
+	snapshot_u8(s, &cpu_z80.halted);
+	snapshot_u8(s, &cpu_z80.nmi_req);
+	snapshot_u8(s, &cpu_z80.nmi_low);
+	snapshot_u8(s, &cpu_z80.int_req);
+	snapshot_u8(s, &cpu_z80.defer_int);
+	snapshot_u8(s, &cpu_z80.int_vector);
+	snapshot_u8(s, &cpu_z80.exec_int_vector);
+}
+
+static void snap_board(struct snapshot *s, void *unused)
+{
+	unsigned i;
+
+	snapshot_match(s, cpuboard);
+	snapshot_match(s, romsize);
+	for (i = 0; i < 4; i++)
+		snapshot_uint(s, bankreg + i);
+	snapshot_u8(s, &bankenable);
+	snapshot_u8(s, &switchrom);
+	snapshot_u8(s, &port30);
+	snapshot_u8(s, &port38);
+	snapshot_u8(s, &z512_control);
+	snapshot_u32(s, &z512_wdog);
+	snapshot_u8(s, &ef_latch);
+	snapshot_u16(s, &bs_latch);
+	snapshot_uint(s, &rom_mapped);
+	snapshot_u8(s, &pick_bank);
+	snapshot_u32(s, &ez512_base);
+	snapshot_uint(s, &ez512_portc);
+	snapshot_bytes(s, &z84c15, sizeof(z84c15));
+	snapshot_u8(s, &sbc64_cpld_status);
+	snapshot_u8(s, &sbc64_cpld_char);
+	snapshot_uint(s, &prop_curcmd);
+	snapshot_uint(s, &prop_cmdcnt);
+	snapshot_uint(s, &prop_cmdsize);
+	for (i = 0; i < 4; i++)
+		snapshot_uint(s, propdata + i);
+	snapshot_u8(s, &live_irq);
+	snapshot_u8(s, &intvec);
+	snapshot_u8(s, &live_nonim2);
+	snapshot_bytes(s, ramrom, sizeof(ramrom));
+}
+
+static void snap_ctc(struct snapshot *s, void *unused)
+{
+	struct z80_ctc *c;
+
+	for (c = ctc; c < ctc + 4; c++) {
+		snapshot_u16(s, &c->count);
+		snapshot_u16(s, &c->reload);
+		snapshot_u8(s, &c->vector);
+		snapshot_u8(s, &c->ctrl);
+		snapshot_u8(s, &c->irq);
+	}
+	snapshot_u8(s, &ctc_irqmask);
+}
+
+static void snap_pio(struct snapshot *s, void *unused)
+{
+	snapshot_bytes(s, pio, sizeof(pio));
+	snapshot_u8(s, &pio_cs);
+	/* The bit-bang SPI may be part way through a byte */
+	snapshot_u8(s, &bb.old);
+	snapshot_u8(s, &bb.oldcs);
+	snapshot_u8(s, &bb.bits);
+	snapshot_u8(s, &bb.bitct);
+	snapshot_u8(s, &bb.rxbits);
+}
+
+static void snap_acia(struct snapshot *s, void *unused)
+{
+	acia_snapshot(acia, s);
+}
+
+static void snap_sio(struct snapshot *s, void *unused)
+{
+	sio_snapshot(sio, s);
+}
+
+static void snap_uart(struct snapshot *s, void *unused)
+{
+	uart16x50_snapshot(uart, s);
+}
+
+static void snap_ide(struct snapshot *s, void *unused)
+{
+	ide_snapshot(ide0, s);
+}
+
+static void snap_ppide(struct snapshot *s, void *unused)
+{
+	ppide_snapshot(ppide, s);
+}
+
+static void snap_sd(struct snapshot *s, void *unused)
+{
+	sd_snapshot(sdcard, s);
+}
+
+static void snap_vdp(struct snapshot *s, void *unused)
+{
+	tms9918a_snapshot(vdp, s);
+}
+
+static void setup_snapshots(void)
+{
+	snapshot_register("cpu", snap_cpu, NULL);
+	snapshot_register("board", snap_board, NULL);
+	snapshot_register("ctc", snap_ctc, NULL);
+	snapshot_register("pio", snap_pio, NULL);
+	if (acia)
+		snapshot_register("acia", snap_acia, NULL);
+	if (sio)
+		snapshot_register("sio", snap_sio, NULL);
+	if (uart)
+		snapshot_register("16x50", snap_uart, NULL);
+	if (ide0)
+		snapshot_register("ide", snap_ide, NULL);
+	if (ppide)
+		snapshot_register("ppide", snap_ppide, NULL);
+	if (sdcard)
+		snapshot_register("sd", snap_sd, NULL);
+	if (vdp)
+		snapshot_register("tms9918a", snap_vdp, NULL);
+	signal(SIGUSR2, snap_signal);
+}
+
+/* The emulated clock that recorded input is stamped with */
+static uint64_t board_clock(void)
+{
+	return timerq_now(timers);
+}
+
+static void snap_save(void)
+{
+	snap_wanted = 0;
+	if (snapshot_save(snap_path, "rc2014") == 0)
+		fprintf(stderr, "[Snapshot saved to %s.]\n", snap_path);
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -2831,13 +4077,12 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rc2014: [-a] [-A] [-b] [-c] [-f] [-i idepath] [-R] [-m mainboard] [-r rompath] [-e rombank] [-s] [-w] [-d debug]\n");
+	fprintf(stderr, "rc2014: [-a] [-A] [-b] [-c] [-f] [-o] [-x speed] [-t trigger] [-M manifest] [-i idepath] [-R] [-m mainboard] [-r rompath] [-e rombank] [-s] [-w] [-d debug] [-J engine] [-L snapshot] [-W snapshot] [-y record] [-Y replay] [-j text|json] [-g profile] [-l symbols] [-K interval] [-U] [-D] [-B spitable] [-V]\n");
 	exit(EXIT_FAILURE);
 }
 
 int main(int argc, char *argv[])
 {
-	static struct timespec tc;
 	static const char *sasipath = NULL;
 	int opt;
 	int fd;
@@ -2846,6 +4091,10 @@ int main(int argc, char *argv[])
 	char *rompath = "rc2014.rom";
 	char *sdpath = NULL;
 	char *idepath = NULL;
+	char *snapload = NULL;
+	char *replaypath = NULL;
+	unsigned statsmode = STATS_OFF;
+	unsigned replay = REPLAY_OFF;
 	int save = 0;
 	int have_acia = 0;
 	int sio2 = 0;
@@ -2854,6 +4103,7 @@ int main(int argc, char *argv[])
 	int have_sn = 0;
 	char *gdb_bind = NULL;
 	bool gdb_stopped = false;
+	int engine = Z80_ENGINE_SWITCH;
 
 #define INDEV_ACIA	1
 #define INDEV_SIO	2
@@ -2865,7 +4115,7 @@ int main(int argc, char *argv[])
 	while (p < ramrom + sizeof(ramrom))
 		*p++= rand();
 
-	while ((opt = getopt(argc, argv, "179Aabcd:e:EfF:G:i:I:km:nN:pPr:sRS:Tuw8CZz:XS")) != -1) {
+	while ((opt = getopt(argc, argv, "179AabB:cDd:e:EfF:g:G:i:I:j:J:kK:l:L:m:M:nN:opPr:st:RS:TuUVwW:8x:y:Y:CZz:XS")) != -1) {
 		switch (opt) {
 		case 'a':
 			have_acia = 1;
@@ -3102,6 +4352,61 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'o':
+			console_unbuffered();
+			break;
+		case 'x':
+			speed = atof(optarg);
+			if (speed <= 0)
+				usage();
+			break;
+		case 'L':
+			snapload = optarg;
+			break;
+		case 'M':
+			fanout_load(optarg);
+			break;
+		case 'y':
+			replaypath = optarg;
+			replay = REPLAY_RECORD;
+			break;
+		case 'Y':
+			replaypath = optarg;
+			replay = REPLAY_PLAY;
+			break;
+		case 'W':
+			snap_path = optarg;
+			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
+		case 'g':
+			profpath = optarg;
+			break;
+		case 'l':
+			profile_symbols(optarg);
+			break;
+		case 'K':
+			profile_every = atol(optarg);
+			if (profile_every == 0)
+				usage();
+			break;
+		case 'U':
+			profile_stacks = 1;
+			break;
+		case 'D':
+			disk_sync(DISK_SYNC_WRITE);
+			break;
+		case 'B':
+			spi_load(optarg);
+			break;
+		case 'V':
+			spi_verify = 1;
+			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'G':
 			if (strcmp(optarg, "s") == 0 || strcmp(optarg, "S") == 0) {
 				gdb_stopped = true;
@@ -3109,6 +4414,13 @@ int main(int argc, char *argv[])
 				gdb_bind = optarg;
 			}
 			break;
+		case 'J':
+			engine = Z80EngineByName(optarg);
+			if (engine == -1) {
+				fprintf(stderr, "rc2014: unknown engine '%s'.\n", optarg);
+				exit(1);
+			}
+			break;
 		case 'R':
 			rtc = rtc_create();
 			break;
@@ -3154,6 +4466,12 @@ int main(int argc, char *argv[])
 	}
 	if (optind < argc)
 		usage();
+	/* Call stacks are only kept for the profile */
+	if (profile_stacks && profpath == NULL)
+		usage();
+	/* and there is nothing to check without routines */
+	if (spi_verify && spi_routines == NULL)
+		usage();
 
 	ui_init();
 
@@ -3451,10 +4769,7 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	/* 2.5ms - it's a balance between nice behaviour and simulation
-	   smoothness */
-	tc.tv_sec = 0;
-	tc.tv_nsec = 20000000L;
+	realtime_init(speed);
 
 	if (tcgetattr(0, &term) == 0) {
 		saved_term = term;
@@ -3471,22 +4786,48 @@ int main(int argc, char *argv[])
 		tcsetattr(0, TCSADRAIN, &term);
 	}
 
+	bind_board();
 	Z80RESET(&cpu_z80);
 	cpu_z80.ioRead = io_read;
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
-	cpu_z80.trace = z80_trace;
-
-	/* This is the wrong way to do it but it's easier for the moment. We
-	   should track how much real time has occurred and try to keep cycle
-	   matched with that. The scheme here works fine except when the host
-	   is loaded though */
+	cpu_z80.on_reti = reti_event;
+	if (ide == 1) {
+		cpu_z80.ioBlockIn = io_block_in;
+		cpu_z80.ioBlockOut = io_block_out;
+	}
+	set_trace(trace);
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "rc2014: unable to set up CPU engine.\n");
+		exit(1);
+	}
 
 	/* We run 7372000 t-states per second */
-	/* We run 365 cycles per I/O check, do that 50 times then poll the
-	   slow stuff and nap for 20ms to get 50Hz on the TMS99xx */
+	/* The CPU runs up to the next device deadline, then the devices that
+	   are due are run. Every 20ms we nap to get 50Hz on the TMS99xx */
+	setup_timers();
+	setup_snapshots();
+	if (snapload) {
+		if (snapshot_load(snapload, "rc2014"))
+			exit(1);
+		/* The banking may have moved and the RAM has new code in it */
+		map_memory();
+		Z80InvalidateCode(&cpu_z80);
+		ctc_schedule();
+		realtime_resync();
+	}
+	if (replaypath) {
+		if (have_wiznet)
+			fprintf(stderr, "rc2014: network input is not recorded.\n");
+		replay_open(replaypath, replay, board_clock);
+	}
+	if (profpath)
+		profile_init(profpath, 2, 4);
+	stats_init("rc2014", fast ? 0 : tstate_steps * speed / 50, statsmode);
 	while (!emulator_done) {
+		unsigned long slice;
+		unsigned ran;
 		if (cpu_z80.halted && ! cpu_z80.IFF1) {
 			/* HALT with interrupts disabled, so nothing left
 			   to do, so exit simulation. If NMI was supported,
@@ -3494,97 +4835,38 @@ int main(int argc, char *argv[])
 			emulator_done = 1;
 			break;
 		}
-		int i;
-		/* 36400 T states for base RC2014 - varies for others */
-		for (i = 0; i < 40; i++) {
-			int j;
-			for (j = 0; j < 100; j++) {
-				unsigned int tstates = (tstate_steps + 5) / 10;
-				if (gdb) {
-					cpu_z80.tstates = 0;
-					while (cpu_z80.tstates < tstates) {
-						gdb_server_step(gdb, &emulator_done);
-						Z80Execute(&cpu_z80);
-					}
-				} else {
-					Z80ExecuteTStates(&cpu_z80, tstates);
-				}
-				if (ef9345)
-					ef9345_cycles(ef9345, 200);
-				if (copro)
-					z180copro_run(copro);
-				if (ps2)
-					ps2_event(ps2, (tstate_steps + 5) / 10);
-				if (acia)
-					acia_timer(acia);
-				if (sio)
-					sio_timer(sio);
-				if (have_16x50)
-					uart16x50_event(uart);
-				if (have_cpld_serial)
-					sbc64_cpld_timer();
-				poll_irq_nonim2();
-			}
-			if (have_ctc || have_kio || have_kio_ext) {
-				if (cpuboard != CPUBOARD_MICRO80 && cpuboard != CPUBOARD_MICRO80W)
-					ctc_tick(tstate_steps * 10);
-				else	/* Micro80 it's not off the CPU clock  but
-					   the 1.8MHz clock */
-					ctc_tick(921);
-			}
-			if (cpuboard == CPUBOARD_EASYZ80 || cpuboard == CPUBOARD_TINYZ80) {
-				/* Feed the uart clock into the CTC */
-				int c;
-				/* 10Mhz so calculate for 500 tstates.
-				   CTC 2 runs at half uart clock */
-				for (c = 0; c < 46; c++) {
-					ctc_receive_pulse(0);
-					ctc_receive_pulse(1);
-					ctc_receive_pulse(2);
-					ctc_receive_pulse(0);
-					ctc_receive_pulse(1);
-				}
-			}
-			fdc_tick(fdc);
-			/* We want to run UI events regularly it seems */
-			if (ui_event())
-				emulator_done = 1;
-		}
-
-		if (is_z512 && (z512_control & 0x20)) {
-			if (z512_wdog <= 5) {
-				fprintf(stderr, "Watchdog reset.\n");
-				emulator_done = 1;
-				break;
+		if (gdb) {
+			slice = timerq_due(timers, slice_clocks, 0);
+			cpu_z80.tstates = 0;
+			cpu_running = 1;
+			while (cpu_z80.tstates < slice) {
+				gdb_server_step(gdb, &emulator_done);
+				Z80Execute(&cpu_z80);
 			}
-			z512_wdog -= 5;
-		}
-		/* TODO: coprocessor int to main if we implement it */
-
-		/* 50Hz which is near enough */
-		if (vdp) {
-			tms9918a_rasterize(vdp);
-			tms9918a_render(vdprend);
-		}
-		if (ef9345) {
-			ef9345_rasterize(ef9345);
-			ef9345_render(ef9345rend);
+			ran = cpu_z80.tstates;
+		} else {
+			/* Halted and nothing pending: until a device
+			   interrupts there is nothing to run, so the polling
+			   can wait for the next timer doing real work */
+			int idle = cpu_z80.halted && !copro &&
+				!cpu_z80.int_req && !cpu_z80.nmi_req;
+			slice = timerq_due(timers, tstate_steps * 400, idle);
+			cpu_running = 1;
+			ran = z80_run(&cpu_z80, slice);
 		}
-		if (tft) {
-			tft_rasterize(tft);
-			tft_render(tftrend);
+		cpu_running = 0;
+		timerq_run(timers, ran);
+		stats.cycles += ran;
+		stats.instructions = cpu_z80.instructions;
+		if (stats_wanted)
+			stats_report();
+		if (snap_wanted)
+			snap_save();
+		/* Booted: hand over to the test cases, which run flat out */
+		if (fanout_pending && !trigger_pending) {
+			fanout_run();
+			fast = 1;
 		}
-		if (have_wiznet)
-			w5100_process(wiz);
-		/* Do 20ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
-		/* Non IM2 devices just hold interrupt */
-		/* If there is no pending Z80 vector IRQ but we think
-		   there now might be one we use the same logic as for
-		   reti */
-		if (!live_irq || !have_im2)
-			poll_irq_event();
 	}
 	if (gdb) {
 		gdb_server_free(gdb);
@@ -3602,5 +4884,9 @@ int main(int argc, char *argv[])
 	fdc_destroy(&fdc);
 	fd_destroy(&drive_a);
 	fd_destroy(&drive_b);
+	stats_exit();
+	timerq_free(timers);
+	if (!fast)
+		realtime_report();
 	exit(0);
 }
@@ -39,6 +39,8 @@
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "w5100.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -224,6 +226,8 @@ uint8_t cp1802_inport(uint8_t addr)
 
 void cp1802_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -380,7 +384,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-1802: [-1] [-A] [-b] [-B] [-e bank] [-f] [-i cfidepath] [-I ppidepath]\n             [-R] [-r rompath] [-t type] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-1802: [-1] [-A] [-b] [-B] [-e bank] [-f] [-T trigger] [-i cfidepath] [-I ppidepath]\n             [-R] [-r rompath] [-t type] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -396,8 +400,9 @@ int main(int argc, char *argv[])
 	char *idepath;
 	int acia_input;
 	int uart_16550a = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1abBd:e:fi:I:r:Rt:w")) != -1) {
+	while ((opt = getopt(argc, argv, "1abBd:e:fi:I:j:r:Rt:wT:")) != -1) {
 		switch (opt) {
 		case '1':
 			uart_16550a = 1;
@@ -438,6 +443,13 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'T':
+			if (trigger_set(optarg))
+				usage();
+			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -589,14 +601,22 @@ int main(int argc, char *argv[])
 	   matched with that. The scheme here works fine except when the host
 	   is loaded though */
 
+	/* 100 runs of mcycles every 5ms */
+	stats_init("rcbus-1802", fast ? 0 : mcycles / 50.0, statsmode);
+
 	while (!done) {
 		int i;
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 100; i++) {
 			/* TODO: need to loop for the desired tstates */
 			cpu.mcycles = 0;
-			while(cpu.mcycles < mcycles)
+			while(cpu.mcycles < mcycles) {
+				if (trigger_pending & TRIGGER_PC)
+					trigger_pc(cpu.r[cpu.p]);
 				cp1802_run(&cpu);
+				stats.instructions++;
+			}
+			stats.cycles += cpu.mcycles;
 			if (acia)
 				acia_timer(acia);
 			if (uart)
@@ -605,9 +625,13 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
@@ -31,6 +31,10 @@
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "w5100.h"
+#include "stats.h"
+#include "serialdevice.h"
+#include "ttycon.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -138,6 +142,8 @@ void m6800_sci_change(struct m6800 *cpu)
 
 void m6800_tx_byte(struct m6800 *cpu, uint8_t byte)
 {
+	if (console_snoop)
+		console_snoop(byte);
 	write(1, &byte, 1);
 }
 
@@ -193,6 +199,8 @@ uint8_t m6800_inport(uint8_t addr)
 
 void m6800_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -346,7 +354,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-6303: [-b] [-B] [-f] [-i idepath] [-I ppidepath] [-R] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-6303: [-b] [-B] [-f] [-t trigger] [-i idepath] [-I ppidepath] [-R] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -359,8 +367,9 @@ int main(int argc, char *argv[])
 	char *rompath = "rcbus-6303.rom";
 	char *idepath;
 	unsigned int cycles = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1abBd:fi:I:r:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "1abBd:fi:I:j:r:Rwt:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -386,9 +395,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -505,13 +521,20 @@ int main(int argc, char *argv[])
 	   matched with that. The scheme here works fine except when the host
 	   is loaded though */
 
+	stats_init("rcbus-6303", fast ? 0 : clockrate / 50.0, statsmode);
+
 	while (!done) {
 		unsigned int i;
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 100; i++) {
-			while(cycles < clockrate)
+			while(cycles < clockrate) {
+				if (trigger_pending & TRIGGER_PC)
+					trigger_pc(cpu.pc);
 				cycles += m6800_execute(&cpu);
+				stats.instructions++;
+			}
 			cycles -= clockrate;
+			stats.cycles += clockrate;
 		}
 		/* Drive the internal serial */
 		i = check_chario();
@@ -523,9 +546,13 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
@@ -29,6 +29,8 @@
 #include "6522.h"
 #include "rtc_bitbang.h"
 #include "w5100.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -147,6 +149,8 @@ uint8_t mmio_read_6502(uint8_t addr)
 
 void mmio_write_6502(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if ((addr >= 0x80 && addr <= 0x87) && acia && acia_narrow)
@@ -263,6 +267,8 @@ static void poll_irq_event(void)
 
 static void irqnotify(void)
 {
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(getPC());
 	if (live_irq)
 		irq6502();
 }
@@ -282,7 +288,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-6509: [-1] [-A] [-a] [-f] [-i idepath] [-R] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-6509: [-1] [-A] [-a] [-f] [-t trigger] [-i idepath] [-R] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -295,8 +301,9 @@ int main(int argc, char *argv[])
 	int usertc = 0;
 	char *rompath = "rcbus-6509.rom";
 	char *idepath;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1Aad:fi:r:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "1Aad:fi:j:r:Rwt:")) != -1) {
 		switch (opt) {
 		case '1':
 			input = 2;
@@ -319,9 +326,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			usertc = 1;
 			break;
@@ -427,12 +441,14 @@ int main(int argc, char *argv[])
 	/* We run 4000000 t-states per second */
 	/* We run 200 cycles per I/O check, do that 100 times then poll the
 	   slow stuff and nap for 5ms. */
+	stats_init("rcbus-6509", fast ? 0 : tstate_steps / 50.0, statsmode);
+
 	while (!done) {
 		int i;
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 100; i++) {
 			/* FIXME: should check return and keep adjusting */
-			exec6502(tstate_steps);
+			stats.cycles += exec6502(tstate_steps);
 			if (acia)
 				acia_timer(acia);
 			if (input == 2)
@@ -442,9 +458,14 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		stats.instructions = instructions;
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
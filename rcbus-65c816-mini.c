@@ -37,6 +37,8 @@
 #include "6522.h"
 #include "16x50.h"
 #include "w5100.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -145,6 +147,8 @@ uint8_t mmio_read_65c816(uint8_t addr)
 
 void mmio_write_65c816(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if ((addr >= 0x80 && addr <= 0x87) && acia && acia_narrow)
@@ -307,6 +311,9 @@ void system_process(void)
 	   smoothness */
 	tc.tv_sec = 0;
 	tc.tv_nsec = 5000000L;
+	/* Called every tstate_steps clocks. The core keeps no count of
+	   instructions */
+	stats.cycles += tstate_steps;
 	if (acia)
 		acia_timer(acia);
 	if (uart)
@@ -344,8 +351,12 @@ void system_process(void)
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
+		if (stats_wanted)
+			stats_report();
 	}
 }
 
@@ -364,7 +375,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus: [-1] [-A] [-a] [-c] [-f] [-R] [-B] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus: [-1] [-A] [-a] [-c] [-f] [-t trigger] [-R] [-B] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -376,8 +387,9 @@ int main(int argc, char *argv[])
 	char *idepath;
 	int input = 0;
 	int hasrtc = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1Aad:fi:r:RwB")) != -1) {
+	while ((opt = getopt(argc, argv, "1Aad:fi:j:r:RwBt:")) != -1) {
 		switch (opt) {
 		case '1':
 			input = 2;
@@ -400,9 +412,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			hasrtc = 1;
 			break;
@@ -419,6 +438,12 @@ int main(int argc, char *argv[])
 	if (optind < argc)
 		usage();
 
+	/* The core has no per instruction hook to watch the PC with */
+	if (trigger_pending & TRIGGER_PC) {
+		fprintf(stderr, "rcbus-65c816-mini: pc: triggers are not supported.\n");
+		exit(1);
+	}
+
 	if (input == 0) {
 		fprintf(stderr, "rcbus: no UART selected, defaulting to 16550A\n");
 		input = 2;
@@ -494,6 +519,7 @@ int main(int argc, char *argv[])
 
 	CPUEvent_initialize();
 	CPU_setUpdatePeriod(tstate_steps);
+	stats_init("rcbus-65c816-mini", fast ? 0 : tstate_steps / 50.0, statsmode);
 	CPU_reset();
 	CPU_run();
 	exit(0);
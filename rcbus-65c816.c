@@ -60,6 +60,8 @@
 #include "16x50.h"
 #include "w5100.h"
 #include "sram_mmu8.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -224,6 +226,8 @@ static uint8_t mmio_read_65c816(uint16_t addr)
 
 static void mmio_write_65c816(uint16_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	addr = bytemangle(addr);
@@ -353,6 +357,9 @@ void system_process(void)
 	   smoothness */
 	tc.tv_sec = 0;
 	tc.tv_nsec = 5000000L;
+	/* Called every tstate_steps clocks. The core keeps no count of
+	   instructions */
+	stats.cycles += tstate_steps;
 	if (acia)
 		acia_timer(acia);
 	if (uart)
@@ -382,8 +389,12 @@ void system_process(void)
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
+		if (stats_wanted)
+			stats_report();
 	}
 }
 
@@ -402,7 +413,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-65c816: [-1] [-A] [-a] [-b] [-c] [-f] [-R] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-65c816: [-1] [-A] [-a] [-b] [-c] [-f] [-t trigger] [-R] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -414,8 +425,9 @@ int main(int argc, char *argv[])
 	char *idepath;
 	int input = 0;
 	int hasrtc = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1Aabd:fi:r:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "1Aabd:fi:j:r:Rwt:")) != -1) {
 		switch (opt) {
 		case '1':
 			input = 2;
@@ -442,9 +454,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			hasrtc = 1;
 			break;
@@ -458,6 +477,12 @@ int main(int argc, char *argv[])
 	if (optind < argc)
 		usage();
 
+	/* The core has no per instruction hook to watch the PC with */
+	if (trigger_pending & TRIGGER_PC) {
+		fprintf(stderr, "rcbus-65c816: pc: triggers are not supported.\n");
+		exit(1);
+	}
+
 	if (input == 0) {
 		fprintf(stderr, "rcbus: no UART selected, defaulting to 16550A\n");
 		input = 2;
@@ -534,6 +559,7 @@ int main(int argc, char *argv[])
 
 	CPUEvent_initialize();
 	CPU_setUpdatePeriod(tstate_steps);
+	stats_init("rcbus-65c816", fast ? 0 : tstate_steps / 50.0, statsmode);
 	CPU_reset();
 	CPU_run();
 	exit(0);
@@ -26,6 +26,8 @@
 #include "acia.h"
 #include "16x50.h"
 #include "6840.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];
 
@@ -192,6 +194,8 @@ static uint8_t m6800_ior(uint16_t addr)
 
 static void m6800_iow(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "IW %04X = %02X\n", addr, val);
 	if (acia && addr >= 0xA0 && addr <= 0xA1)
@@ -308,7 +312,7 @@ static void exit_cleanup(void)
 static void usage(void)
 {
 	fprintf(stderr,
-		"rcbus-6800: [-1] [-b] [-f] [-i path] [-R] [-r rompath] [-d debug]\n");
+		"rcbus-6800: [-1] [-b] [-f] [-t trigger] [-i path] [-R] [-r rompath] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -322,8 +326,9 @@ int main(int argc, char *argv[])
 	char *idepath;
 	unsigned int cycles = 0;
 	unsigned int romsize = 32768;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1bd:fi:r:")) != -1) {
+	while ((opt = getopt(argc, argv, "1bd:fi:j:r:t:")) != -1) {
 		switch (opt) {
 		case '1':
 			/* 1655x */
@@ -343,9 +348,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		default:
 			usage();
 		}
@@ -425,11 +437,18 @@ int main(int argc, char *argv[])
 	   matched with that. The scheme here works fine except when the host
 	   is loaded though */
 
+	stats_init("rcbus-6800", fast ? 0 : clockrate / 50.0, statsmode);
+
 	while (!done) {
 		unsigned int i, j;
 		for (i = 0; i < 100; i++) {
-			while (cycles < clockrate)
+			while (cycles < clockrate) {
+				if (trigger_pending & TRIGGER_PC)
+					trigger_pc(cpu.pc);
 				cycles += m6800_execute(&cpu);
+				stats.instructions++;
+			}
+			stats.cycles += clockrate;
 			m6840_tick(ptm, cycles);
 			for (j = 0; j < cycles; j++)
 				m6840_external_clock(ptm, 2);
@@ -442,9 +461,13 @@ int main(int argc, char *argv[])
 		else
 			uart16x50_event(uart);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
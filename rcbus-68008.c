@@ -39,6 +39,8 @@
 #include "16x50.h"
 #include "w5100.h"
 #include "sram_mmu8.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* ROM low RAM high */
 
@@ -164,6 +166,8 @@ void mmio_write_68000(uint16_t addr, uint8_t val)
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %04x <- %02x\n", addr, val);
 	addr &= 0xFF;
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if ((addr >= 0x80 && addr <= 0x87) && acia && acia_narrow)
 		acia_write(acia, addr & 1, val);
 	if ((addr >= 0x80 && addr <= 0xBF) && acia && !acia_narrow)
@@ -307,6 +311,9 @@ void cpu_write_pd(unsigned int addr, unsigned int value)
 
 void cpu_instr_callback(void)
 {
+	stats.instructions++;
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(m68k_get_reg(NULL, M68K_REG_PC));
 	if (trace & TRACE_CPU) {
 		char buf[128];
 		unsigned int pc = m68k_get_reg(NULL, M68K_REG_PC);
@@ -341,8 +348,12 @@ void system_process(void)
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
+		if (stats_wanted)
+			stats_report();
 	}
 	if (acia) {
 		if (acia_irq_pending(acia))
@@ -373,7 +384,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-68008: [-1] [-A] [-a] [-b] [-f] [-R] [-r rompath] [-i disk] [-I disk] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-68008: [-1] [-A] [-a] [-b] [-f] [-t trigger] [-R] [-r rompath] [-i disk] [-I disk] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -387,8 +398,9 @@ int main(int argc, char *argv[])
 	int has_rtc = 0;
 	int has_acia = 0;
 	int has_16550a = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1Aabd:fi:r:I:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "1Aabd:fi:j:r:I:Rwt:")) != -1) {
 		switch (opt) {
 		case '1':
 			has_16550a = 1;
@@ -420,9 +432,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			has_rtc = 1;
 			break;
@@ -522,8 +541,9 @@ int main(int argc, char *argv[])
 	/* Really should be 68008 */
 	m68k_set_cpu_type(M68K_CPU_TYPE_68000);
 	m68k_pulse_reset();
+	stats_init("rcbus-68008", fast ? 0 : 4, statsmode);
 	while(1) {
-		m68k_execute(tstate_steps);	/* 4MHz roughly right for 8MHz 68008 */
+		stats.cycles += m68k_execute(tstate_steps);	/* 4MHz roughly right for 8MHz 68008 */
 		system_process();
 	}
 }
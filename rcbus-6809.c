@@ -38,6 +38,11 @@
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "sdcard.h"
+#include "realtime.h"
+#include "timerq.h"
+#include "trigger.h"
+#include "fanout.h"
+#include "stats.h"
 #include "w5100.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
@@ -75,6 +80,9 @@ static nic_w5100_t *wiz;
 
 static volatile int done;
 
+static struct timerq *timers;
+static double speed = 1.0;
+
 #define TRACE_MEM	1
 #define TRACE_IO	2
 #define TRACE_ROM	4
@@ -252,6 +260,8 @@ uint8_t m6809_inport(uint8_t addr)
 
 void m6809_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -261,6 +271,9 @@ void m6809_outport(uint8_t addr, uint8_t val)
 	}
 	else if (addr == 0x80)
 		fprintf(stderr, "[%02X] ", val);
+	/* A test case reporting its result, see fanout.h */
+	else if (addr == 0xFC && fanout_active)
+		fanout_exit(val);
 	else if ((addr >= 0x10 && addr <= 0x17) && ide == 1)
 		my_ide_write(addr & 7, val);
 	else if ((addr >= 0x90 && addr <= 0x97) && ide == 1)
@@ -413,6 +426,8 @@ void e6809_instruction(unsigned pc)
 {
 	char buf[80];
 	struct reg6809 *r = e6809_get_regs();
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(pc & 0xFFFF);
 	if (trace & TRACE_CPU) {
 		/*
 		 * The PC reported by e6809 can have garbage in the upper
@@ -427,6 +442,30 @@ void e6809_instruction(unsigned pc)
 	}
 }
 
+static void tick_ptm(void *priv, unsigned long clocks)
+{
+	unsigned long j;
+	m6840_tick(ptm, clocks);
+	for (j = 0; j < clocks; j++)
+		m6840_external_clock(ptm, 2);
+	recalc_interrupts();
+}
+
+static void tick_frame(void *priv, unsigned long clocks)
+{
+	/* Drive the  serial */
+	uart16x50_event(uart);
+	/* Wiznet timer */
+	if (wiznet)
+		w5100_process(wiz);
+	/* Wait until 5ms of real time has passed since the last frame */
+	if (trigger_pending & TRIGGER_TIME)
+		trigger_elapsed(5000000);
+	if (!fast && !trigger_pending)
+		realtime_sleep(5000000);
+	console_flush();
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -442,22 +481,21 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-6809: [-b] [-f] [-R] [-i idepath] [-I ppidepath] [-S sdcardpath] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-6809: [-b] [-f] [-o] [-x speed] [-t trigger] [-M manifest] [-R] [-i idepath] [-I ppidepath] [-S sdcardpath] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
 int main(int argc, char *argv[])
 {
-	static struct timespec tc;
 	int opt;
 	int fd;
 	int rom = 1;
 	char *rompath = "rcbus-6809.rom";
 	char *idepath = NULL;
 	char *sdpath = NULL;
-	unsigned int cycles = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1abBd:fi:I:r:RS:w")) != -1) {
+	while ((opt = getopt(argc, argv, "1abBd:fi:I:j:M:or:RS:t:wx:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -486,6 +524,24 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'o':
+			console_unbuffered();
+			break;
+		case 'x':
+			speed = atof(optarg);
+			if (speed <= 0)
+				usage();
+			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
+		case 'M':
+			fanout_load(optarg);
+			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -598,10 +654,9 @@ int main(int argc, char *argv[])
 			rtc_trace(rtcdev, 1);
 	}
 
-	/* 5ms - it's a balance between nice behaviour and simulation
-	   smoothness */
-	tc.tv_sec = 0;
-	tc.tv_nsec = 5000000L;
+	/* Pace every 5ms - it's a balance between nice behaviour and
+	   simulation smoothness */
+	realtime_init(speed);
 
 	if (tcgetattr(0, &term) == 0) {
 		saved_term = term;
@@ -620,31 +675,35 @@ int main(int argc, char *argv[])
 
 	e6809_reset(trace & TRACE_CPU);
 
-	/* This is the wrong way to do it but it's easier for the moment. We
-	   should track how much real time has occurred and try to keep cycle
-	   matched with that. The scheme here works fine except when the host
-	   is loaded though */
+	/* The CPU runs up to the next device deadline, then the devices that
+	   are due are run. The frame timer keeps us to real time */
+	timers = timerq_create();
+	timerq_every(timerq_timer(timers, "ptm", tick_ptm, NULL, 0), clockrate);
+	timerq_every(timerq_timer(timers, "frame", tick_frame, NULL, 0), clockrate * 100);
+	stats_init("rcbus-6809", fast ? 0 : clockrate * speed / 50, statsmode);
 
 	while (!done) {
-		unsigned int i, j;
-		/* 36400 T states for base rcbus - varies for others */
-		for (i = 0; i < 100; i++) {
-			while(cycles < clockrate)
-				cycles += e6809_sstep(live_irq, 0);
-			m6840_tick(ptm, cycles);
-			for (j = 0; j < cycles; j++)
-				m6840_external_clock(ptm, 2);
-			cycles -= clockrate;
-			recalc_interrupts();
+		unsigned long slice = timerq_due(timers, clockrate * 100, 0);
+		unsigned long cycles = 0;
+		unsigned long instr = 0;
+		while (cycles < slice) {
+			cycles += e6809_sstep(live_irq, 0);
+			instr++;
+		}
+		timerq_run(timers, cycles);
+		stats.cycles += cycles;
+		stats.instructions += instr;
+		if (stats_wanted)
+			stats_report();
+		/* Booted: hand over to the test cases, which run flat out */
+		if (fanout_pending && !trigger_pending) {
+			fanout_run();
+			fast = 1;
 		}
-		/* Drive the  serial */
-		uart16x50_event(uart);
-		/* Wiznet timer */
-		if (wiznet)
-			w5100_process(wiz);
-		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
 	}
+	stats_exit();
+	timerq_free(timers);
+	if (!fast)
+		realtime_report();
 	exit(0);
 }
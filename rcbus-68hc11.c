@@ -32,6 +32,10 @@
 #include "rtc_bitbang.h"
 #include "w5100.h"
 #include "sdcard.h"
+#include "stats.h"
+#include "serialdevice.h"
+#include "ttycon.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 static uint8_t monitor[12288];		/* Monitor ROM - usually Buffalo */
@@ -168,6 +172,8 @@ void m6800_sci_change(struct m6800 *cpu)
 
 void m6800_tx_byte(struct m6800 *cpu, uint8_t byte)
 {
+	if (console_snoop)
+		console_snoop(byte);
 	write(1, &byte, 1);
 }
 
@@ -283,6 +289,8 @@ uint8_t m6800_inport(uint8_t addr)
 
 void m6800_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -459,7 +467,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-68hc11: [-b] [-B] [-F] [-f] [-R] [-r rom] [-i idedisk] [-S sdcard] [-m monitor] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-68hc11: [-b] [-B] [-F] [-f] [-t trigger] [-R] [-r rom] [-i idedisk] [-S sdcard] [-m monitor] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -474,8 +482,9 @@ int main(int argc, char *argv[])
 	char *idepath;
 	char *sdpath = NULL;
 	unsigned int cycles = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1abBd:Ffi:I:r:RS:m:w")) != -1) {
+	while ((opt = getopt(argc, argv, "1abBd:Ffi:I:j:r:RS:m:wt:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -509,9 +518,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -663,15 +679,22 @@ int main(int argc, char *argv[])
 	   matched with that. The scheme here works fine except when the host
 	   is loaded though */
 
+	stats_init("rcbus-68hc11", fast ? 0 : clockrate / 50.0, statsmode);
+
 	while (!done) {
 		unsigned int i;
 		unsigned int j;
 		/* 36400 T states for base rcbus - varies for others */
 		for (j = 0; j < 10; j++) {
 			for (i = 0; i < 10; i++) {
-				while(cycles < clockrate)
+				while(cycles < clockrate) {
+					if (trigger_pending & TRIGGER_PC)
+						trigger_pc(cpu.pc);
 					cycles += m68hc11_execute(&cpu);
+					stats.instructions++;
+				}
 				cycles -= clockrate;
+				stats.cycles += clockrate;
 			}
 			/* Drive the internal serial */
 			i = check_chario();
@@ -684,9 +707,13 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
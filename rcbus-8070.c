@@ -29,6 +29,8 @@
 #include "system.h"
 #include "tms9918a.h"
 #include "tms9918a_render.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -205,6 +207,8 @@ static uint8_t ns807x_inport(uint8_t addr)
 
 static void ns807x_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -270,8 +274,15 @@ static void poll_irq_event(void)
 /* Move into NS807x code ? */
 static void ns807x_exec(int tstate_steps)
 {
+	int n;
+
 	do {
-		tstate_steps -= ns8070_execute_one(cpu);
+		if (trigger_pending & TRIGGER_PC)
+			trigger_pc(ns8070_get_pc(cpu));
+		n = ns8070_execute_one(cpu);
+		tstate_steps -= n;
+		stats.cycles += n;
+		stats.instructions++;
 	} while(tstate_steps > 0);
 }
 
@@ -291,7 +302,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-8070: [-b] [-B] [-e rombank] [-f] [-i idepath] [-R] [-r rompath] [-e rombank] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-8070: [-b] [-B] [-e rombank] [-f] [-t trigger] [-i idepath] [-R] [-r rompath] [-e rombank] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -304,8 +315,9 @@ int main(int argc, char *argv[])
 	int rombank = 0;
 	char *rompath = "rcbus-8070.rom";
 	char *idepath;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "bBd:e:fi:r:T")) != -1) {
+	while ((opt = getopt(argc, argv, "bBd:e:fi:j:r:Tt:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -329,9 +341,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'T':
 			have_tms = 1;
 			break;
@@ -438,6 +457,7 @@ int main(int argc, char *argv[])
 	/* We run 7372000 t-states per second */
 	/* We run 369 cycles per I/O check, do that 100 times then poll the
 	   slow stuff and nap for 5ms. */
+	stats_init("rcbus-8070", fast ? 0 : tstate_steps / 50.0, statsmode);
 	while (!emulator_done) {
 		int i;
 		/* 36400 T states for base rcbus - varies for others */
@@ -453,11 +473,16 @@ int main(int argc, char *argv[])
 		if (vdp) {
 			tms9918a_rasterize(vdp);
 			tms9918a_render(vdprend);
+			stats.frames++;
 		}
 		/* Do 20ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(20000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
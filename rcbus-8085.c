@@ -44,6 +44,8 @@
 #include "w5100.h"
 #include "sasi.h"
 #include "ncr5380.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -278,6 +280,8 @@ uint8_t i8085_inport(uint8_t addr)
 
 void i8085_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -348,6 +352,18 @@ static void poll_irq_event(void)
 		int_clear(IRQ_TMS9918A);
 }
 
+/* Step an instruction at a time while waiting for a pc: trigger */
+static int exec_8085(int cycles)
+{
+	while ((trigger_pending & TRIGGER_PC) && cycles > 0) {
+		trigger_pc(i8085_read_reg16(PC));
+		cycles -= 1 - i8085_exec(1);
+	}
+	if (cycles > 0)
+		cycles = i8085_exec(cycles);
+	return cycles;
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -363,7 +379,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-8085: [-1] [-a] [-b] [-B] [-e rombank] [-f] [-i idepath] [-I ppidepath] [-R] [-r rompath] [-e rombank] [-w] [-d debug] [-S symbols]\n");
+	fprintf(stderr, "rcbus-8085: [-1] [-a] [-b] [-B] [-e rombank] [-f] [-t trigger] [-i idepath] [-I ppidepath] [-R] [-r rompath] [-e rombank] [-w] [-d debug] [-S symbols] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -379,8 +395,9 @@ int main(int argc, char *argv[])
 	char *idepath;
 	int acia_input;
 	int uart_16550a = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1abBd:e:fi:I:N:r:RwS:T")) != -1) {
+	while ((opt = getopt(argc, argv, "1abBd:e:fi:I:j:N:r:RwS:Tt:")) != -1) {
 		switch (opt) {
 		case '1':
 			uart_16550a = 1;
@@ -418,9 +435,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'N':
 			sasipath = optarg;
 			break;
@@ -588,11 +612,13 @@ int main(int argc, char *argv[])
 	/* We run 7372000 t-states per second */
 	/* We run 369 cycles per I/O check, do that 100 times then poll the
 	   slow stuff and nap for 5ms. */
+	stats_init("rcbus-8085", fast ? 0 : tstate_steps / 50.0, statsmode);
 	while (!emulator_done) {
 		int i;
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 400; i++) {
-			i8085_exec(tstate_steps);
+			/* Returns the overrun as 0 or less */
+			stats.cycles += tstate_steps - exec_8085(tstate_steps);
 			if (acia)
 				acia_timer(acia);
 			if (uart_16550a)
@@ -606,13 +632,18 @@ int main(int argc, char *argv[])
 		if (vdp) {
 			tms9918a_rasterize(vdp);
 			tms9918a_render(vdprend);
+			stats.frames++;
 		}
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 20ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(20000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
@@ -29,6 +29,8 @@
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "w5100.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];
 
@@ -186,6 +188,8 @@ static uint8_t i808x_inport(uint16_t addr)
 
 static void i808x_outport(uint16_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %04x <- %02x\n", addr, val);
 	addr &= 0xFF;
@@ -236,6 +240,13 @@ static void poll_irq_event(void)
 {
 }
 
+static void trigger_op(void *ext, unsigned char op1, unsigned char op2)
+{
+	trigger_pc(e86_get_linear(e86_get_cs(cpu), e86_get_ip(cpu)));
+	if (!trigger_pending)
+		cpu->op_stat = NULL;
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -251,7 +262,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-80c188: [-1] [-f] [-R] [-r rompath] [-e rombank] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-80c188: [-1] [-f] [-t trigger] [-R] [-r rompath] [-e rombank] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -262,8 +273,9 @@ int main(int argc, char *argv[])
 	int fd;
 	char *rompath = "rcbus-808x.rom";
 	char *idepath;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "d:fi:I:r:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "d:fi:I:j:r:Rwt:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -279,9 +291,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -383,6 +402,9 @@ int main(int argc, char *argv[])
 	e86_set_mem(cpu, NULL, i808x_read8, i808x_write8, i808x_read16, i808x_write16);
 	e86_set_prt(cpu, NULL, i808x_in8, i808x_out8, i808x_in16, i808x_out16);
 	e86_set_ram(cpu, ramrom, sizeof(ramrom));
+	/* Watch each instruction only until a pc: trigger goes off */
+	if (trigger_pending & TRIGGER_PC)
+		cpu->op_stat = trigger_op;
 
 	/* Reset the CPU */
 	e86_reset(cpu);
@@ -399,19 +421,27 @@ int main(int argc, char *argv[])
 	/* We run 7372000 t-states per second */
 	/* We run 369 cycles per I/O check, do that 100 times then poll the
 	   slow stuff and nap for 5ms. */
+	stats_init("rcbus-80c188", fast ? 0 : tstate_steps / 50.0, statsmode);
 	while (!done) {
 		int i;
+		unsigned opcnt = e86_get_opcnt(cpu);
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 100; i++) {
 			e86_clock(cpu, tstate_steps);
 			uart16x50_event(uart);
 		}
+		stats.cycles += 100 * tstate_steps;
+		stats.instructions += e86_get_opcnt(cpu) - opcnt;
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
@@ -16,10 +16,14 @@
 
 #include "ns32k/32016.h"
 #include "16x50.h"
+#include "serialdevice.h"
+#include "ttycon.h"
 #include "ide.h"
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "w5100.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];
 static uint8_t rtc;
@@ -168,6 +172,8 @@ void ns32016_do_port_write(uint32_t addr, uint8_t val)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	addr >>= 1;
 	addr &= 0xFF;
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if ((addr >= 0x10 && addr <= 0x17) && ide == 1)
 		my_ide_write(addr & 7, val);
 	else if ((addr >= 0x90 && addr <= 0x97) && ide == 1)
@@ -229,6 +235,18 @@ static void poll_irq_event(void)
 {
 }
 
+/* The core charges 8 per instruction so step by 8 for a pc: trigger */
+static void exec_ns32k(int cycles)
+{
+	while ((trigger_pending & TRIGGER_PC) && cycles > 0) {
+		trigger_pc(ns32016_get_pc());
+		ns32016_exec(8);
+		cycles -= 8;
+	}
+	if (cycles > 0)
+		ns32016_exec(cycles);
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -244,7 +262,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-ns32k: [-1] [-a] [-b] [-B] [-e rombank] [-f] [-i idepath] [-I ppidepath] [-R] [-r rompath] [-e rombank] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-ns32k: [-1] [-a] [-b] [-B] [-e rombank] [-f] [-t trigger] [-i idepath] [-I ppidepath] [-R] [-r rompath] [-e rombank] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -255,8 +273,9 @@ int main(int argc, char *argv[])
 	int fd;
 	char *rompath = "rcbus-ns32k.rom";
 	char *idepath = NULL;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "d:fi:I:r:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "d:fi:I:j:r:Rwt:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -272,9 +291,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -332,6 +358,7 @@ int main(int argc, char *argv[])
 	if (trace & TRACE_UART)
 		uart16x50_trace(uart, 1);
 	uart16x50_set_input(uart, 1);
+	uart16x50_attach(uart, &console);
 
 	if (wiznet) {
 		wiz = nic_w5100_alloc();
@@ -378,11 +405,14 @@ int main(int argc, char *argv[])
 	/* We run 7372000 t-states per second */
 	/* We run 369 cycles per I/O check, do that 100 times then poll the
 	   slow stuff and nap for 5ms. */
+	stats_init("rcbus-ns32k", fast ? 0 : tstate_steps / 50.0, statsmode);
 	while (!done) {
 		int i;
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 100; i++) {
-			ns32016_exec(tstate_steps);
+			/* The core keeps no count of instructions */
+			exec_ns32k(tstate_steps);
+			stats.cycles += tstate_steps;
 			uart16x50_event(uart);
 			if (uart16x50_irq_pending(uart))
 				int_set(IRQ_16550A);
@@ -392,9 +422,13 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
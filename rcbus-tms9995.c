@@ -26,6 +26,8 @@
 #include "rtc_bitbang.h"
 #include "tms9902.h"
 #include "w5100.h"
+#include "stats.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -180,6 +182,8 @@ uint8_t tms9995_inport(uint8_t addr)
 
 void tms9995_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -344,7 +348,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-tms9995-6809: [-b] [-f] [-R] [-i idepath] [-I ppidepath] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-tms9995-6809: [-b] [-f] [-T trigger] [-R] [-i idepath] [-I ppidepath] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -357,8 +361,9 @@ int main(int argc, char *argv[])
 	char *rompath = "rcbus-tms9995.rom";
 	char *idepath;
 	int tmsin = 0;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1abBd:fi:I:r:Rw")) != -1) {
+	while ((opt = getopt(argc, argv, "1abBd:fi:I:j:r:RwT:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -384,9 +389,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 'T':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -403,6 +415,12 @@ int main(int argc, char *argv[])
 	if (optind < argc)
 		usage();
 
+	/* The core has no per instruction hook to watch the PC with */
+	if (trigger_pending & TRIGGER_PC) {
+		fprintf(stderr, "rcbus-tms9995: pc: triggers are not supported.\n");
+		exit(1);
+	}
+
 	if (rom == 0 && bank512 == 0 && bankhigh == 0) {
 		fprintf(stderr, "rcbus-tms9995: no ROM\n");
 		exit(EXIT_FAILURE);
@@ -517,10 +535,14 @@ int main(int argc, char *argv[])
 	   matched with that. The scheme here works fine except when the host
 	   is loaded though */
 
+	stats_init("rcbus-tms9995", fast ? 0 : clockrate / 50.0, statsmode);
+
 	while (!done) {
 		unsigned int i;
 		for (i = 0; i < 100; i++) {
+			/* The core keeps no count of instructions */
 			tms9995_execute_run(tms, clockrate);
+			stats.cycles += clockrate;
 			recalc_interrupts();
 			tms9995_execute_set_input(tms, INT_9995_INT1, !!live_irq);
 		}
@@ -530,8 +552,12 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
@@ -37,6 +37,10 @@
 #include "piratespi.h"
 #include "rtc_bitbang.h"
 #include "sdcard.h"
+#include "realtime.h"
+#include "stats.h"
+#include "timerq.h"
+#include "trigger.h"
 #include "tms9918a.h"
 #include "tms9918a_render.h"
 #include "w5100.h"
@@ -75,6 +79,9 @@ static unsigned int pspi_cs = 0;
 
 static uint16_t tstate_steps = 737;	/* 18.432MHz */
 
+static struct timerq *timers;
+static double speed = 1.0;
+
 /* IRQ source that is live in IM2 */
 static uint8_t live_irq;
 
@@ -242,6 +249,8 @@ static void rcbus_trace(unsigned unused)
 	static uint32_t lastpc = -1;
 	char buf[256];
 
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(cpu_z180.M1PC);
 	if ((trace & TRACE_CPU) == 0)
 		return;
 	nbytes = 0;
@@ -708,6 +717,8 @@ static void io_write_dyno(uint16_t addr, uint8_t val, uint8_t known)
 
 void io_write(int unused, uint16_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr & 0xFF);
 	switch (cpuboard) {
 	case CPUBOARD_Z180:
 		io_write_2014(addr, val, 0);
@@ -755,6 +766,57 @@ static void reti_event(void)
 	poll_irq_event();
 }
 
+static void tick_io(void *priv, unsigned long clocks)
+{
+	z180_event(io, clocks);
+}
+
+static void tick_fdc(void *priv, unsigned long clocks)
+{
+	fdc_tick(fdc);
+	/* We want to run UI events regularly it seems */
+	ui_event();
+}
+
+static void tick_frame(void *priv, unsigned long clocks)
+{
+	/* 50Hz which is near enough */
+	if (vdp) {
+		tms9918a_rasterize(vdp);
+		tms9918a_render(vdprend);
+		stats.frames++;
+	}
+	if (wiznet)
+		w5100_process(wiz);
+	/* Wait until 20ms of real time has passed since the last frame */
+	if (trigger_pending & TRIGGER_TIME)
+		trigger_elapsed(20000000);
+	if (!fast && !trigger_pending)
+		realtime_sleep(20000000);
+	console_flush();
+	if (int_recalc) {
+		/* If there is no pending Z180 vector IRQ but we think
+		   there now might be one we use the same logic as for
+		   reti */
+		if (!live_irq)
+			poll_irq_event();
+		/* Clear this after because reti_event may set the
+		   flags to indicate there is more happening. We will
+		   pick up the next state changes on the reti if so */
+		if (!(cpu_z180.IFF1|cpu_z180.IFF2))
+			int_recalc = 0;
+	}
+}
+
+/* Do an emulated 20ms of work (368640 clocks) per frame */
+static void setup_timers(void)
+{
+	timers = timerq_create();
+	timerq_every(timerq_timer(timers, "io", tick_io, NULL, 0), tstate_steps);
+	timerq_every(timerq_timer(timers, "fdc", tick_fdc, NULL, 0), tstate_steps * 10);
+	timerq_every(timerq_timer(timers, "frame", tick_frame, NULL, 0), tstate_steps * 500);
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -770,18 +832,18 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-z180: [-a] [-b] [-f] [-i idepath] [-P buspirate] [-R] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-z180: [-a] [-b] [-f] [-o] [-x speed] [-t trigger] [-i idepath] [-P buspirate] [-R] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
 int main(int argc, char *argv[])
 {
-	static struct timespec tc;
 	int opt;
 	int fd;
 	char *rompath = "rcbus-z180.rom";
 	char *sdpath = NULL;
 	char *idepath = NULL;
+	unsigned statsmode = STATS_OFF;
 	char *patha = NULL, *pathb = NULL;
 	char *piratepath = NULL;
 	int input = 0;
@@ -790,7 +852,7 @@ int main(int argc, char *argv[])
 	while (p < ramrom + sizeof(ramrom))
 		*p++= rand();
 
-	while ((opt = getopt(argc, argv, "1acd:fF:i:I:lm:r:sP:RS:Twzb")) != -1) {
+	while ((opt = getopt(argc, argv, "1acd:fF:i:I:j:lm:or:sP:RS:t:Twx:zb")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -849,6 +911,18 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'o':
+			console_unbuffered();
+			break;
+		case 'x':
+			speed = atof(optarg);
+			if (speed <= 0)
+				usage();
+			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'P':
 			piratepath = optarg;
 			break;
@@ -858,6 +932,9 @@ int main(int argc, char *argv[])
 		case 'b':
 			banked = 1;
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'w':
 			wiznet = 1;
 			break;
@@ -1010,10 +1087,7 @@ int main(int argc, char *argv[])
 	if (piratepath)
 		pspi = piratespi_create(piratepath);
 
-	/* 20ms - it's a balance between nice behaviour and simulation
-	   smoothness */
-	tc.tv_sec = 0;
-	tc.tv_nsec = 20000000L;
+	realtime_init(speed);
 
 	if (tcgetattr(0, &term) == 0) {
 		saved_term = term;
@@ -1045,57 +1119,30 @@ int main(int argc, char *argv[])
 		piratespi_alt(pspi, 1);
 	}
 
-	/* This is the wrong way to do it but it's easier for the moment. We
-	   should track how much real time has occurred and try to keep cycle
-	   matched with that. The scheme here works fine except when the host
-	   is loaded though */
-
+	/* The CPU runs up to the next device deadline, then the devices that
+	   are due are run. The frame timer keeps us to real time */
+	setup_timers();
+	stats_init("rcbus-z180", fast ? 0 : tstate_steps * speed / 40, statsmode);
 	while (!emulator_done) {
-		int states = 0;
-		unsigned int i, j;
+		unsigned long slice = timerq_due(timers, tstate_steps * 500, 0);
+		unsigned long states = 0;
+		unsigned long instr = 0;
 		/* We have to run the DMA engine and Z180 in step per
 		   instruction otherwise we will mess up on stalling DMA */
-
-		/* Do an emulated 20ms of work (368640 clocks) */
-		for (i = 0; i < 50; i++) {
-			for (j = 0; j < 10; j++) {
-				while (states < tstate_steps) {
-					unsigned int used;
-					used = z180_dma(io);
-					if (used == 0)
-						used = Z180Execute(&cpu_z180);
-					states += used;
-				}
-				z180_event(io, states);
-				states -= tstate_steps;
+		while (states < slice) {
+			unsigned int used;
+			used = z180_dma(io);
+			if (used == 0) {
+				used = Z180Execute(&cpu_z180);
+				instr++;
 			}
-			fdc_tick(fdc);
-			/* We want to run UI events regularly it seems */
-			ui_event();
-		}
-
-		/* 50Hz which is near enough */
-		if (vdp) {
-			tms9918a_rasterize(vdp);
-			tms9918a_render(vdprend);
-		}
-		if (wiznet)
-			w5100_process(wiz);
-		/* Do 20ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
-		if (int_recalc) {
-			/* If there is no pending Z180 vector IRQ but we think
-			   there now might be one we use the same logic as for
-			   reti */
-			if (!live_irq)
-				poll_irq_event();
-			/* Clear this after because reti_event may set the
-			   flags to indicate there is more happening. We will
-			   pick up the next state changes on the reti if so */
-			if (!(cpu_z180.IFF1|cpu_z180.IFF2))
-				int_recalc = 0;
+			states += used;
 		}
+		timerq_run(timers, states);
+		stats.cycles += states;
+		stats.instructions += instr;
+		if (stats_wanted)
+			stats_report();
 	}
 	fd_eject(drive_a);
 	fd_eject(drive_b);
@@ -1104,5 +1151,9 @@ int main(int argc, char *argv[])
 	fd_destroy(&drive_b);
 	if (pspi)
 		piratespi_free(pspi);
+	stats_exit();
+	timerq_free(timers);
+	if (!fast)
+		realtime_report();
 	exit(0);
 }
@@ -35,6 +35,10 @@
 #include "ppide.h"
 #include "rtc_bitbang.h"
 #include "w5100.h"
+#include "stats.h"
+#include "serialdevice.h"
+#include "ttycon.h"
+#include "trigger.h"
 
 static uint8_t ramrom[1024 * 1024];	/* Covers the banked card */
 
@@ -131,6 +135,8 @@ void z8_port_write(struct z8 *z8, uint8_t port, uint8_t val)
 
 void z8_tx(struct z8 *z8, uint8_t ch)
 {
+	if (console_snoop)
+		console_snoop(ch);
 	write(1, &ch, 1);
 }
 
@@ -348,6 +354,8 @@ static void uart_write(struct uart16x50 *uptr, uint8_t addr, uint8_t val)
 	case 0:	/* If dlab = 0, then write else LS*/
 		if (uptr->dlab == 0) {
 			if (uptr == &uart) {
+				if (console_snoop)
+					console_snoop(val);
 				putchar(val);
 				fflush(stdout);
 			}
@@ -484,6 +492,8 @@ uint8_t z8_inport(uint8_t addr)
 
 void z8_outport(uint8_t addr, uint8_t val)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(addr);
 	if (trace & TRACE_IO)
 		fprintf(stderr, "write %02x <- %02x\n", addr, val);
 	if (addr == 0xFF && bankhigh) {
@@ -659,7 +669,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "rcbus-z8: [-1] [-b] [-B] [-e bank] [-f] [-i cfidepath] [-I ppidepath]\n             [-R] [-r rompath] [-w] [-d debug]\n");
+	fprintf(stderr, "rcbus-z8: [-1] [-b] [-B] [-e bank] [-f] [-t trigger] [-i cfidepath] [-I ppidepath]\n             [-R] [-r rompath] [-w] [-d debug] [-j text|json]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -672,8 +682,9 @@ int main(int argc, char *argv[])
 	int rombank = 0;
 	char *rompath = "rcbus-z8.rom";
 	char *idepath;
+	unsigned statsmode = STATS_OFF;
 
-	while ((opt = getopt(argc, argv, "1bBd:e:fi:I:r:Rt:w")) != -1) {
+	while ((opt = getopt(argc, argv, "1bBd:e:fi:I:j:r:Rt:w")) != -1) {
 		switch (opt) {
 		case '1':
 			uart_16550a = 1;
@@ -705,9 +716,16 @@ int main(int argc, char *argv[])
 		case 'd':
 			trace = atoi(optarg);
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'f':
 			fast = 1;
 			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'R':
 			rtc = 1;
 			break;
@@ -838,14 +856,21 @@ int main(int argc, char *argv[])
 	   matched with that. The scheme here works fine except when the host
 	   is loaded though */
 
+	stats_init("rcbus-z8", fast ? 0 : mcycles / 50.0, statsmode);
+
 	while (!done) {
 		int i;
 		/* 36400 T states for base rcbus - varies for others */
 		for (i = 0; i < 100; i++) {
 			/* TODO: need to loop for the desired tstates */
 			cpu->cycles = 0;
-			while(cpu->cycles < mcycles)
+			while(cpu->cycles < mcycles) {
+				if (trigger_pending & TRIGGER_PC)
+					trigger_pc(cpu->pc);
 				z8_execute(cpu);
+				stats.instructions++;
+			}
+			stats.cycles += cpu->cycles;
 			if (uart_16550a)
 				uart_event(&uart);
 			else {
@@ -855,9 +880,13 @@ int main(int argc, char *argv[])
 		if (wiznet)
 			w5100_process(wiz);
 		/* Do 5ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(5000000);
+		if (!fast && !trigger_pending)
+			stats_nap(&tc);
 		poll_irq_event();
+		if (stats_wanted)
+			stats_report();
 	}
 	exit(0);
 }
@@ -0,0 +1,84 @@
+/*
+ *	Real time pacing
+ *
+ *	The emulator tells us each time it has run a chunk of emulated time.
+ *	We keep an absolute deadline on the monotonic clock and sleep until
+ *	it, so time spent emulating is not added to the sleep and the host
+ *	load does not make the machine drift slow.
+ *
+ *	If the host falls behind the deadline is missed and we run without
+ *	sleeping until we catch up. If it falls too far behind (stopped in a
+ *	debugger, suspended, a very busy host) we give up on the lost time
+ *	rather than run flat out for a long time afterwards.
+ *
+ *	The factor scales emulated time against real time so 2.0 runs the
+ *	machine at twice its real speed.
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
+#include <signal.h>
+#include "realtime.h"
+#include "stats.h"
+
+#define MAX_LAG		100000000ULL	/* 100ms */
+
+static double speed = 1.0;
+static uint64_t deadline;
+static unsigned long deadlines;
+static unsigned long missed;
+
+static uint64_t realtime_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void realtime_init(double factor)
+{
+	speed = factor;
+	deadline = realtime_now();
+}
+
+/* Start again from now, forgetting any lag */
+void realtime_resync(void)
+{
+	deadline = realtime_now();
+}
+
+/* ns of emulated time has been run, wait for the host clock to reach it */
+void realtime_sleep(unsigned long ns)
+{
+	struct timespec ts;
+	uint64_t now = realtime_now();
+
+	deadlines++;
+	deadline += ns / speed;
+	if (now >= deadline) {
+		missed++;
+		if (now - deadline > MAX_LAG)
+			deadline = now;
+		return;
+	}
+	ts.tv_sec = deadline / 1000000000ULL;
+	ts.tv_nsec = deadline % 1000000000ULL;
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+		;
+	stats.sleeps++;
+	stats.sleep_ns += realtime_now() - now;
+}
+
+unsigned long realtime_missed(void)
+{
+	return missed;
+}
+
+void realtime_report(void)
+{
+	if (missed)
+		fprintf(stderr, "%lu of %lu real time deadlines missed.\n",
+			missed, deadlines);
+}
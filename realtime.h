@@ -0,0 +1,9 @@
+/*
+ *	Keep emulated time in step with the host clock
+ */
+
+void realtime_init(double factor);
+void realtime_sleep(unsigned long ns);
+void realtime_resync(void);
+unsigned long realtime_missed(void);
+void realtime_report(void);
@@ -0,0 +1,227 @@
+/*
+ *	Input record and replay
+ *
+ *	The log is "EMUREPL" 0, a version byte and then an entry per input
+ *
+ *	u8 type, varint clock, varint value
+ *
+ *	The clock is the change from the previous entry and the time value
+ *	the change from the previous time, both zigzag coded as they can go
+ *	backwards. Entries are in the order the machine consumed them which
+ *	for each type of input is also the order it saw them.
+ *
+ *	On replay the log is read in whole and each type of input works
+ *	through its own entries. If the machine asks for something at a
+ *	different point to the recording it has diverged, which we report
+ *	once and carry on as best we can.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "replay.h"
+
+#define REPLAY_VERSION	1
+#define REPLAY_TYPES	3
+
+static const uint8_t replay_magic[8] = "EMUREPL";
+
+struct replay_event {
+	uint8_t type;
+	uint64_t when;
+	uint64_t value;
+};
+
+unsigned replay_mode;
+
+static uint64_t (*replay_clock)(void);
+static FILE *replay_file;
+static uint64_t last_when;
+static uint64_t last_time;
+
+static struct replay_event *events;
+static unsigned nevents;
+static unsigned cursor[REPLAY_TYPES];
+static unsigned diverged;
+
+static void replay_put(uint64_t v)
+{
+	while (v >= 0x80) {
+		putc((v & 0x7F) | 0x80, replay_file);
+		v >>= 7;
+	}
+	putc(v, replay_file);
+}
+
+static uint64_t zigzag(uint64_t v)
+{
+	return (v << 1) ^ -(v >> 63);
+}
+
+static uint64_t unzigzag(uint64_t v)
+{
+	return (v >> 1) ^ -(v & 1);
+}
+
+static int replay_get(const uint8_t **p, const uint8_t *end, uint64_t *v)
+{
+	unsigned shift = 0;
+
+	*v = 0;
+	while (*p < end && shift < 64) {
+		*v |= (uint64_t)(**p & 0x7F) << shift;
+		if (!(*(*p)++ & 0x80))
+			return 0;
+		shift += 7;
+	}
+	return -1;
+}
+
+static void replay_load(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	uint8_t *buf;
+	const uint8_t *p, *end;
+	struct replay_event *e;
+	long len;
+
+	if (f == NULL) {
+		perror(path);
+		exit(1);
+	}
+	if (fseek(f, 0L, SEEK_END) || (len = ftell(f)) < 9) {
+		fprintf(stderr, "%s: not a replay log.\n", path);
+		exit(1);
+	}
+	rewind(f);
+	buf = malloc(len);
+	/* Can't be more events than bytes */
+	events = malloc(len / 3 * sizeof(struct replay_event));
+	if (buf == NULL || events == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	if (fread(buf, len, 1, f) != 1) {
+		perror(path);
+		exit(1);
+	}
+	fclose(f);
+	if (memcmp(buf, replay_magic, 8) || buf[8] != REPLAY_VERSION) {
+		fprintf(stderr, "%s: not a replay log.\n", path);
+		exit(1);
+	}
+	p = buf + 9;
+	end = buf + len;
+	while (p < end) {
+		uint64_t when, value;
+		e = events + nevents;
+		e->type = *p++;
+		if (e->type == 0 || e->type >= REPLAY_TYPES ||
+			replay_get(&p, end, &when) || replay_get(&p, end, &value)) {
+			fprintf(stderr, "%s: corrupt replay log.\n", path);
+			exit(1);
+		}
+		last_when += unzigzag(when);
+		e->when = last_when;
+		if (e->type == REPLAY_TIME) {
+			last_time += unzigzag(value);
+			value = last_time;
+		}
+		e->value = value;
+		nevents++;
+	}
+	free(buf);
+}
+
+void replay_open(const char *path, unsigned mode, uint64_t (*now)(void))
+{
+	replay_clock = now;
+	replay_mode = mode;
+	if (mode == REPLAY_PLAY) {
+		replay_load(path);
+		return;
+	}
+	replay_file = fopen(path, "w");
+	if (replay_file == NULL) {
+		perror(path);
+		exit(1);
+	}
+	fwrite(replay_magic, 8, 1, replay_file);
+	putc(REPLAY_VERSION, replay_file);
+}
+
+uint64_t replay_now(void)
+{
+	if (replay_clock)
+		return replay_clock();
+	return 0;
+}
+
+void replay_log(unsigned type, uint64_t when, uint64_t value)
+{
+	putc(type, replay_file);
+	replay_put(zigzag(when - last_when));
+	last_when = when;
+	if (type == REPLAY_TIME) {
+		replay_put(zigzag(value - last_time));
+		last_time = value;
+	} else
+		replay_put(value);
+}
+
+static struct replay_event *replay_find(unsigned type)
+{
+	unsigned n = cursor[type];
+	while (n < nevents && events[n].type != type)
+		n++;
+	cursor[type] = n;
+	if (n == nevents)
+		return NULL;
+	return events + n;
+}
+
+static void replay_diverged(const char *why, uint64_t when)
+{
+	if (diverged++)
+		return;
+	fprintf(stderr, "[Replay %s at clock %llu.]\n", why,
+		(unsigned long long)when);
+}
+
+/* Has the next input of this type arrived yet */
+int replay_ready(unsigned type)
+{
+	struct replay_event *e = replay_find(type);
+	return e && e->when <= replay_now();
+}
+
+/* Take the next input of this type */
+uint64_t replay_next(unsigned type)
+{
+	struct replay_event *e = replay_find(type);
+	uint64_t now = replay_now();
+
+	if (e == NULL) {
+		replay_diverged("log ran out", now);
+		return type == REPLAY_TIME ? (uint64_t)time(NULL) : 0;
+	}
+	if (e->when > now || (type == REPLAY_TIME && e->when != now))
+		replay_diverged("out of step", now);
+	cursor[type]++;
+	return e->value;
+}
+
+/* The host time for the RTCs */
+time_t replay_time(void)
+{
+	time_t t;
+
+	if (replay_mode == REPLAY_PLAY)
+		return replay_next(REPLAY_TIME);
+	t = time(NULL);
+	if (replay_mode == REPLAY_RECORD)
+		replay_log(REPLAY_TIME, replay_now(), t);
+	return t;
+}
@@ -0,0 +1,24 @@
+/*
+ *	Record and replay of the input that comes from outside the machine:
+ *	console bytes and the host time read by the RTCs. Each is logged with
+ *	the emulated clock at which the machine first saw it, and on replay
+ *	is handed back at that same point, so a replayed run is identical to
+ *	the recorded one whatever the host does.
+ */
+
+#define REPLAY_OFF	0
+#define REPLAY_RECORD	1
+#define REPLAY_PLAY	2
+
+/* Types of input */
+#define REPLAY_CONSOLE	1
+#define REPLAY_TIME	2
+
+extern unsigned replay_mode;
+
+void replay_open(const char *path, unsigned mode, uint64_t (*now)(void));
+uint64_t replay_now(void);
+void replay_log(unsigned type, uint64_t when, uint64_t value);
+int replay_ready(unsigned type);
+uint64_t replay_next(unsigned type);
+time_t replay_time(void);
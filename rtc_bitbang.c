@@ -7,6 +7,7 @@
 #include <fcntl.h>
 #include "system.h"
 #include "rtc_bitbang.h"
+#include "replay.h"
 
 
 /* Real time clock state machine and related state.
@@ -212,7 +213,7 @@ void rtc_write(struct rtc *rtc, uint8_t val)
 			rtc->state = 0;
 		} else {
 			/* Latch imaginary registers on rising edge */
-			time_t t = time(NULL);
+			time_t t = replay_time();
 			rtc->tm = localtime(&t);
 			if (rtc->trace)
 				fprintf(stderr, "RTC CE raised and latched time.\n");
@@ -43,6 +43,7 @@
 #include <unistd.h>
 
 #include "sasi.h"
+#include "diskio.h"
 
 #define NR_LUN	8
 
@@ -93,18 +94,14 @@ struct sasi_bus {
 
 static int do_read(struct sasi_disk *sd)
 {
-	if (lseek(sd->fd, sd->lba * sd->sectorsize, SEEK_SET) < 0)
-		return -1;
-	if (read(sd->fd, sd->dbuf, sd->sectorsize) != sd->sectorsize)
+	if (disk_read(sd->fd, sd->dbuf, sd->sectorsize, (off_t)sd->lba * sd->sectorsize) != sd->sectorsize)
 		return -1;
 	return 0;
 }
 
 static int do_write(struct sasi_disk *sd)
 {
-	if (lseek(sd->fd, sd->lba * sd->sectorsize, SEEK_SET) < 0)
-		return -1;
-	if (write(sd->fd, sd->dbuf, sd->sectorsize) != sd->sectorsize)
+	if (disk_write(sd->fd, sd->dbuf, sd->sectorsize, (off_t)sd->lba * sd->sectorsize) != sd->sectorsize)
 		return -1;
 	return 0;
 }
@@ -701,6 +698,8 @@ struct sasi_bus *sasi_bus_create(void)
 void sasi_disk_attach(struct sasi_bus *bus, unsigned int lun, const char *path, unsigned int sectorsize)
 {
 	struct sasi_disk *sd = alloc(sizeof(struct sasi_disk));
+	off_t size;
+
 	sd->bus = bus;
 	sd->sectorsize = sectorsize;
 	sd->fd = open(path, O_RDWR);
@@ -708,17 +707,18 @@ void sasi_disk_attach(struct sasi_bus *bus, unsigned int lun, const char *path,
 		perror(path);
 		exit(1);
 	}
-	if (lseek(sd->fd, (off_t)0, 2) == -1) {
+	size = disk_size(sd->fd);
+	if (size == -1) {
 		perror(path);
 		exit(1);
 	}
-	sd->blocks = lseek(sd->fd, (off_t)0, 1) / sd->sectorsize;
+	sd->blocks = size / sd->sectorsize;
 	bus->device[lun] = sd;
 }
 
 static void sasi_disk_free(struct sasi_disk *sd)
 {
-	close(sd->fd);
+	disk_close(sd->fd);
 	free(sd);
 }
 
@@ -67,11 +67,29 @@ static volatile int done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
+
+/* Keep the CPU's page map in step with the banking. Memory tracing needs
+   every access to go through mem_read/mem_write so maps nothing */
+static void map_memory(void)
+{
+	uint8_t *low = ram + 32768 * banknum;
+
+	if (trace & TRACE_MEM)
+		return;
+	if (romen)
+		Z80MapPages(&cpu_z80, 0x0000, 0x4000, rom, NULL);
+	else
+		Z80MapPages(&cpu_z80, 0x0000, 0x4000, low, low);
+	Z80MapPages(&cpu_z80, 0x4000, 0x4000, low + 0x4000, low + 0x4000);
+	Z80MapPages(&cpu_z80, 0x8000, 0x8000, ram + 0x8000, ram + 0x8000);
+	/* Keep the scribble check in mem_write seeing its writes */
+	if (!romen && banknum == 0)
+		Z80MapPages(&cpu_z80, 0x1000, Z80_PAGE_SIZE, ram + 0x1000, NULL);
+}
 
 static uint8_t do_mem_read(uint16_t addr, unsigned quiet)
 {
-	static uint8_t rstate;
 	uint8_t r;
 
 	if (!quiet && (trace & TRACE_MEM))
@@ -88,24 +106,6 @@ static uint8_t do_mem_read(uint16_t addr, unsigned quiet)
 	if (trace & TRACE_MEM)
 		fprintf(stderr, " %04X <- %02X\n", addr, r);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r== 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
 	return r;
 }
 
@@ -219,7 +219,7 @@ static void control_rom(uint8_t val)
 	romen = 0;
 	if (trace & TRACE_BANK)
 		fprintf(stderr, "ROM paged out.\n");
-
+	map_memory();
 }
 
 static void ram_select(uint8_t val)
@@ -227,6 +227,7 @@ static void ram_select(uint8_t val)
 	banknum = val & 0x0F;
 	if (trace & TRACE_BANK)
 		fprintf(stderr, "RAM bank set to %d.\n", banknum);
+	map_memory();
 }
 
 static uint8_t io_read(int unused, uint16_t addr)
@@ -269,7 +270,7 @@ static void poll_irq_event(void)
 	Z80INT(&cpu_z80, v);
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	sio_reti(sio);
 	poll_irq_event();
@@ -290,7 +291,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "sbc2g: [-f] [-b] [-t] [-i path] [-r path] [-d debug]\n");
+	fprintf(stderr, "sbc2g: [-f] [-b] [-t] [-i path] [-r path] [-d debug] [-J engine]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -302,8 +303,9 @@ int main(int argc, char *argv[])
 	int l;
 	char *rompath = "sbc2g.rom";
 	char *idepath = "sbc2g.cf";
+	int engine = Z80_ENGINE_SWITCH;
 
-	while ((opt = getopt(argc, argv, "d:i:r:ft")) != -1) {
+	while ((opt = getopt(argc, argv, "d:i:r:ftJ:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -321,6 +323,13 @@ int main(int argc, char *argv[])
 		case 't':
 			timerhack = 1;
 			break;
+		case 'J':
+			engine = Z80EngineByName(optarg);
+			if (engine == -1) {
+				fprintf(stderr, "sbc2g: unknown engine '%s'.\n", optarg);
+				exit(EXIT_FAILURE);
+			}
+			break;
 		default:
 			usage();
 		}
@@ -387,7 +396,13 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
+	map_memory();
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "sbc2g: unable to set up CPU engine.\n");
+		exit(EXIT_FAILURE);
+	}
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
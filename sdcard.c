@@ -5,6 +5,22 @@
 #include <stdint.h>
 #include <string.h>
 #include "sdcard.h"
+#include "diskio.h"
+#include "snapshot.h"
+
+#define SD_READ_AHEAD	8	/* Blocks fetched at a time for CMD18 */
+
+/*
+ *	Card modes
+ *
+ *	0	idle, waiting for a command
+ *	1	collecting a command
+ *	2	sending a response or single block
+ *	3	receiving a data block
+ *	4	waiting for the CMD24 start token
+ *	5	sending blocks for CMD18 until CMD12
+ *	6	waiting for a CMD25 start or stop token
+ */
 
 struct sdcard {
 	int sd_mode;
@@ -25,6 +41,10 @@ struct sdcard {
 	const char *sd_name;
 	int debug;
 	unsigned block;
+	/* Read ahead for CMD18. Only a cache so not in snapshots */
+	uint8_t sd_ra[SD_READ_AHEAD * 512];
+	off_t sd_ra_lba;
+	int sd_ra_len;
 };
 
 static const uint8_t sd_csd[17] = {
@@ -58,6 +78,56 @@ static const uint8_t sd_cid[] = {
 	0xFF	/* should be a checksum */
 };
 
+static off_t sd_cmd_lba(struct sdcard *c)
+{
+	off_t lba = c->sd_cmd[4] + 256 * c->sd_cmd[3] + 65536 * c->sd_cmd[2] +
+		16777216 * c->sd_cmd[1];
+	if (c->block)
+		lba <<= 9;
+	return lba;
+}
+
+/* Read the block at sd_lba, going through the read ahead buffer. On a
+   miss fetch up to ahead blocks */
+static int sd_read_block(struct sdcard *c, uint8_t *buf, unsigned ahead)
+{
+	off_t pos = c->sd_lba;
+
+	if (pos < c->sd_ra_lba || pos + 512 > c->sd_ra_lba + c->sd_ra_len) {
+		c->sd_ra_len = disk_read(c->sd_fd, c->sd_ra, ahead * 512, pos);
+		c->sd_ra_lba = pos;
+		if (c->sd_ra_len < 512) {
+			c->sd_ra_len = 0;
+			if (c->debug)
+				fprintf(stderr, "%s: Read LBA failed.\n", c->sd_name);
+			return -1;
+		}
+	}
+	memcpy(buf, c->sd_ra + (pos - c->sd_ra_lba), 512);
+	return 0;
+}
+
+/* Queue up the next block of a CMD18: a gap, the start token, the data
+   and a dummy CRC. Past the end of the card send an error token instead
+   and stop */
+static void sd_next_block(struct sdcard *c)
+{
+	c->sd_out[0] = 0xFF;
+	c->sd_outp = 0;
+	if (sd_read_block(c, c->sd_out + 2, SD_READ_AHEAD) < 0) {
+		c->sd_out[1] = 0x08;	/* Out of range */
+		c->sd_outlen = 2;
+		c->sd_mode = 2;
+		return;
+	}
+	c->sd_out[1] = 0xFE;
+	c->sd_out[514] = 0xFF;
+	c->sd_out[515] = 0xFF;
+	c->sd_outlen = 516;
+	c->sd_lba += 512;
+	c->sd_mode = 5;
+}
+
 static uint8_t sd_process_command(struct sdcard *c)
 {
 	c->sd_stuff = 2 + (rand() & 7);
@@ -88,6 +158,9 @@ static uint8_t sd_process_command(struct sdcard *c)
 		c->sd_outp = 0;
 		c->sd_mode = 2;
 		return 0x01;
+	case 0x40+12:		/* CMD 12 - stop transmission */
+		/* The stream was stopped when the command began */
+		return 0x00;
 	case 0x40+9:		/* CMD 9 - read the CSD */
 		if (c->block)
 			memcpy(c->sd_out,sdhc_csd, 17);
@@ -119,32 +192,42 @@ static uint8_t sd_process_command(struct sdcard *c)
 		/* Sync mark then data */
 		c->sd_out[0] = 0xFF;
 		c->sd_out[1] = 0xFE;
-		c->sd_lba = c->sd_cmd[4] + 256 * c->sd_cmd[3] + 65536 * c->sd_cmd[2] +
-			16777216 * c->sd_cmd[1];
-		if (c->block)
-			c->sd_lba <<= 9;
+		c->sd_lba = sd_cmd_lba(c);
 		if (c->debug)
 			fprintf(stderr, "%s: Read LBA %lx\n", c->sd_name, (long)c->sd_lba);
-		if (lseek(c->sd_fd, c->sd_lba, SEEK_SET) < 0 || read(c->sd_fd, c->sd_out + 2, 512) != 512) {
-			if (c->debug)
-				fprintf(stderr, "%s: Read LBA failed.\n", c->sd_name);
+		if (sd_read_block(c, c->sd_out + 2, 1) < 0)
 			return 0x01;
-		}
 		c->sd_mode = 2;
 		/* Result */
 		return 0x00;
+	case 0x40+18:		/* Read multiple */
+		c->sd_lba = sd_cmd_lba(c);
+		if (c->debug)
+			fprintf(stderr, "%s: Read multiple LBA %lx\n", c->sd_name, (long)c->sd_lba);
+		sd_next_block(c);
+		if (c->sd_mode != 5) {
+			c->sd_mode = 0;
+			return 0x01;
+		}
+		return 0x00;
 	case 0x40+24:		/* Write */
 		/* Will send us FE data FF FF */
 		c->sd_inlen = 515;	/* Data FF FF FF */
-		c->sd_lba = c->sd_cmd[4] + 256 * c->sd_cmd[3] + 65536 * c->sd_cmd[2] +
-			16777216 * c->sd_cmd[1];
-		if (c->block)
-			c->sd_lba <<= 9;
+		c->sd_lba = sd_cmd_lba(c);
 		if (c->debug)
 			fprintf(stderr, "%s: Write LBA %lx\n", c->sd_name, (long)c->sd_lba);
 		c->sd_inp = 0;
 		c->sd_mode = 4;	/* Send a pad then go to mode 3 */
 		return 0x00;	/* The expected OK */
+	case 0x40+25:		/* Write multiple */
+		/* Each block is FC data CRC CRC, then FD to stop */
+		c->sd_inlen = 515;
+		c->sd_lba = sd_cmd_lba(c);
+		if (c->debug)
+			fprintf(stderr, "%s: Write multiple LBA %lx\n", c->sd_name, (long)c->sd_lba);
+		c->sd_inp = 0;
+		c->sd_mode = 6;
+		return 0x00;
 	case 0x40+55:
 		c->sd_ext = 1;
 		return 0x01;
@@ -167,16 +250,28 @@ static uint8_t sd_process_command(struct sdcard *c)
 
 static uint8_t sd_process_data(struct sdcard *c)
 {
+	/* Whatever is read ahead may now be stale */
+	c->sd_ra_len = 0;
 	switch(c->sd_cmd[0]) {
 	case 0x40+24:		/* Write */
 		c->sd_mode = 0;
-		if (lseek(c->sd_fd, c->sd_lba, SEEK_SET) < 0 ||
-			write(c->sd_fd, c->sd_in, 512) != 512) {
+		if (disk_write(c->sd_fd, c->sd_in, 512, c->sd_lba) != 512) {
 			if (c->debug)
 				fprintf(stderr, "%s: Write failed.\n", c->sd_name);
 			return 0x1E;	/* Need to look up real values */
 		}
 		return 0x05;	/* Indicate it worked */
+	case 0x40+25:		/* Write multiple */
+		c->sd_mode = 0;
+		if (disk_write(c->sd_fd, c->sd_in, 512, c->sd_lba) != 512) {
+			if (c->debug)
+				fprintf(stderr, "%s: Write failed.\n", c->sd_name);
+			return 0x1E;
+		}
+		c->sd_lba += 512;
+		c->sd_inp = 0;
+		c->sd_mode = 6;	/* Next token */
+		return 0x05;
 	default:
 		c->sd_mode = 0;
 		return 0xFF;
@@ -238,6 +333,28 @@ static uint8_t sd_card_byte(struct sdcard *c, uint8_t in)
 			c->sd_mode = 3;
 		return 0xFF;
 	}
+	/* Blocks for CMD18 until a command (CMD12) turns up */
+	if (c->sd_mode == 5) {
+		uint8_t r;
+		if ((in & 0xC0) == 0x40) {
+			c->sd_mode = 1;
+			c->sd_cmdp = 1;
+			c->sd_cmd[0] = in;
+			return 0xFF;
+		}
+		r = c->sd_out[c->sd_outp++];
+		if (c->sd_outp == c->sd_outlen)
+			sd_next_block(c);
+		return r;
+	}
+	/* Between CMD25 blocks */
+	if (c->sd_mode == 6) {
+		if (in == 0xFC)
+			c->sd_mode = 3;
+		else if (in == 0xFD)
+			c->sd_mode = 0;
+		return 0xFF;
+	}
 	return 0xFF;
 }
 
@@ -265,7 +382,7 @@ uint8_t sd_spi_in(struct sdcard *c, uint8_t v)
 void sd_detach(struct sdcard *c)
 {
 	if (c->sd_fd != -1) {
-		close(c->sd_fd);
+		disk_close(c->sd_fd);
 		c->sd_fd = -1;
 	}
 }
@@ -274,6 +391,7 @@ void sd_attach(struct sdcard *c, int fd)
 {
 	sd_detach(c);
 	c->sd_fd = fd;
+	c->sd_ra_len = 0;
 }
 
 void sd_trace(struct sdcard *c, int onoff)
@@ -311,3 +429,27 @@ void sd_blockmode(struct sdcard *c)
 {
 	c->block = 1;
 }
+
+/* The card contents stay in the image file, this is just the interface */
+void sd_snapshot(struct sdcard *c, struct snapshot *s)
+{
+	uint64_t lba = c->sd_lba;
+
+	snapshot_int(s, &c->sd_mode);
+	snapshot_int(s, &c->sd_cmdp);
+	snapshot_int(s, &c->sd_ext);
+	snapshot_bytes(s, c->sd_cmd, sizeof(c->sd_cmd));
+	snapshot_bytes(s, c->sd_in, sizeof(c->sd_in));
+	snapshot_int(s, &c->sd_inlen);
+	snapshot_int(s, &c->sd_inp);
+	snapshot_bytes(s, c->sd_out, sizeof(c->sd_out));
+	snapshot_int(s, &c->sd_outlen);
+	snapshot_int(s, &c->sd_outp);
+	snapshot_u64(s, &lba);
+	c->sd_lba = lba;
+	snapshot_int(s, &c->sd_stuff);
+	snapshot_u8(s, &c->sd_poststuff);
+	snapshot_int(s, &c->sd_cs);
+	snapshot_uint(s, &c->block);
+	c->sd_ra_len = 0;
+}
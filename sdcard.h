@@ -3,6 +3,7 @@
  */
 
 struct sdcard;
+struct snapshot;
 
 extern struct sdcard *sd_create(const char *name);
 extern void sd_reset(struct sdcard *c);
@@ -11,6 +12,7 @@ extern void sd_trace(struct sdcard *c, int onoff);
 extern void sd_attach(struct sdcard *c, int fd);
 extern void sd_detach(struct sdcard *c);
 extern void sd_blockmode(struct sdcard *c);
+extern void sd_snapshot(struct sdcard *c, struct snapshot *s);
 
 extern uint8_t sd_spi_in(struct sdcard *c, uint8_t v);
 extern void sd_spi_raise_cs(struct sdcard *c);
@@ -78,7 +78,22 @@ static volatile int done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
+
+/* Keep the CPU's page map in step with the banking. Memory tracing needs
+   every access to go through mem_read/mem_write so maps nothing */
+static void map_memory(void)
+{
+	uint8_t *p = banken ? ram + 65536 : ram;
+
+	if (trace & TRACE_MEM)
+		return;
+	if (romen) {
+		Z80MapPages(&cpu_z80, 0x0000, 0x4000, rom + rombank * 0x4000, NULL);
+		Z80MapPages(&cpu_z80, 0x4000, 0xC000, p + 0x4000, p + 0x4000);
+	} else
+		Z80MapPages(&cpu_z80, 0x0000, 0x10000, p, p);
+}
 
 static uint8_t do_mem_read(uint16_t addr, unsigned quiet)
 {
@@ -107,28 +122,7 @@ static uint8_t do_mem_read(uint16_t addr, unsigned quiet)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate;
-	uint8_t r = do_mem_read(addr, 0);
-
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r== 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
-	return r;
+	return do_mem_read(addr, 0);
 }
 
 static void mem_write(int unused, uint16_t addr, uint8_t val)
@@ -239,7 +233,7 @@ static void control_rom(uint8_t val)
 		romen = 0;
 	if (olden != romen && (trace & TRACE_BANK))
 		fprintf(stderr, "ROM enabled %d.\n", romen);
-
+	map_memory();
 }
 
 static uint8_t io_read(int unused, uint16_t addr)
@@ -263,8 +257,10 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 	addr &= 0xFF;
 	if (addr >= 0x00 && addr <= 0x03) {
 		sio_write(sio, sio_port[addr & 3], val);
-		if (bankhack == 1)
+		if (bankhack == 1) {
 			banken = !sio_get_wr(sio, 0, 0x40);
+			map_memory();
+		}
 	} else if (addr >= 0x10 && addr <= 0x17)
 		my_ide_write(addr & 7, val);
 	else if (addr == 0x38)
@@ -280,11 +276,13 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 			if (trace & TRACE_BANK)
 				fprintf(stderr, "rombank now %d.\n", rombank);
 		}
+		map_memory();
 	} else if (addr == 0x3F && rombanken) {
 		rombank &= 2;
 		rombank |= (val & 1);
 		if (trace & TRACE_BANK)
 			fprintf(stderr, "rombank now %d.\n", rombank);
+		map_memory();
 	} else if (trace & TRACE_UNK)
 		fprintf(stderr,
 			"Unknown write to port %04X of %02X\n", addr, val);
@@ -298,7 +296,7 @@ static void poll_irq_event(void)
 	Z80INT(&cpu_z80, v);
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	sio_reti(sio);
 	poll_irq_event();
@@ -319,7 +317,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "searle: [-f] [-b] [-t] [-T] [-i path] [-r path] [-d debug]\n");
+	fprintf(stderr, "searle: [-f] [-b] [-t] [-T] [-i path] [-r path] [-d debug] [-J engine]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -331,8 +329,9 @@ int main(int argc, char *argv[])
 	int l;
 	char *rompath = "searle.rom";
 	char *idepath = "searle.cf";
+	int engine = Z80_ENGINE_SWITCH;
 
-	while ((opt = getopt(argc, argv, "d:i:r:fbBtT")) != -1) {
+	while ((opt = getopt(argc, argv, "d:i:r:fbBtTJ:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -360,6 +359,13 @@ int main(int argc, char *argv[])
 		case 'B':
 			bankhack = 2;
 			break;
+		case 'J':
+			engine = Z80EngineByName(optarg);
+			if (engine == -1) {
+				fprintf(stderr, "searle: unknown engine '%s'.\n", optarg);
+				exit(EXIT_FAILURE);
+			}
+			break;
 		default:
 			usage();
 		}
@@ -435,7 +441,13 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
+	map_memory();
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "searle: unable to set up CPU engine.\n");
+		exit(EXIT_FAILURE);
+	}
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
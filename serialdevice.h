@@ -4,5 +4,7 @@ struct serial_device {
 	void *private;
 	uint8_t (*get)(struct serial_device *d);
 	void (*put)(struct serial_device *d, uint8_t ch);
+	/* 1 a byte can be read, 2 a byte can be written, 4 a byte will be
+	   ready shortly so ask again soon */
 	unsigned (*ready)(struct serial_device *d);
 };
@@ -91,9 +91,24 @@ static volatile int done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
 static void poll_irq_event(void);
 
+/* Keep the CPU's page map in step with the banking. While the ROM is in
+   every access goes through mem_read/mem_write for the hazard checks, as
+   do all of them when tracing memory */
+static void map_memory(void)
+{
+	uint8_t *p = ram + 65536 * banknum;
+
+	if (trace & TRACE_MEM)
+		return;
+	if (romen)
+		Z80MapPages(&cpu_z80, 0x0000, 0x10000, NULL, NULL);
+	else
+		Z80MapPages(&cpu_z80, 0x0000, 0x10000, (ramen && ramen2) ? p : NULL, p);
+}
+
 static uint8_t do_mem_read(uint16_t addr, bool debug)
 {
 	uint8_t r;
@@ -114,7 +129,6 @@ static uint8_t do_mem_read(uint16_t addr, bool debug)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate;
 	uint8_t r;
 
 	if (trace & TRACE_MEM)
@@ -125,24 +139,6 @@ static uint8_t mem_read(int unused, uint16_t addr)
 	if (trace & TRACE_MEM)
 		fprintf(stderr, " %04X <- %02X\n", addr, r);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r== 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
 	return r;
 }
 
@@ -246,6 +242,7 @@ static void simple80_sermod(void)
 				fprintf(stderr, "[banknum = %d, RAMen2 = %d.]\n", banknum, ramen2);
 		}
 	}
+	map_memory();
 }
 
 static int ide = 0;
@@ -538,7 +535,7 @@ static void io_write(int unused, uint16_t addr, uint8_t val)
 			"Unknown write to port %04X of %02X\n", addr, val);
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	sio_reti(sio);
 	ctc_reti(0);
@@ -564,7 +561,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "simple80: [-b] [-f] [-1] [-5] [-S] [-f] [-i path] [-r path] [-d debug]\n");
+	fprintf(stderr, "simple80: [-b] [-f] [-1] [-5] [-S] [-f] [-i path] [-r path] [-d debug] [-J engine]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -576,8 +573,9 @@ int main(int argc, char *argv[])
 	int l;
 	char *rompath = "simple80.rom";
 	char *idepath = "simple80.cf";
+	int engine = Z80_ENGINE_SWITCH;
 
-	while ((opt = getopt(argc, argv, "d:i:r:fb15S")) != -1) {
+	while ((opt = getopt(argc, argv, "d:i:r:fb15SJ:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -610,6 +608,13 @@ int main(int argc, char *argv[])
 		case 'S':
 			sioa15 = 1;
 			break;
+		case 'J':
+			engine = Z80EngineByName(optarg);
+			if (engine == -1) {
+				fprintf(stderr, "simple80: unknown engine '%s'.\n", optarg);
+				exit(EXIT_FAILURE);
+			}
+			break;
 		default:
 			usage();
 		}
@@ -679,7 +684,12 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = simple80_trace;
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "simple80: unable to set up CPU engine.\n");
+		exit(EXIT_FAILURE);
+	}
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
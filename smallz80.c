@@ -53,6 +53,24 @@ static volatile int done;
 
 static int trace = 0;
 
+/* Keep the CPU's page map in step with the banking. Memory tracing needs
+   every access to go through mem_read/mem_write so maps nothing */
+static void map_memory(void)
+{
+	uint8_t *bank = bankedram[gpreg & 0x0F];
+
+	if (trace & TRACE_MEM)
+		return;
+	if ((gpreg & 0x80) == 0) {
+		Z80MapPages(&cpu_z80, 0x0000, 0x8000, eeprom, NULL);
+		Z80MapPages(&cpu_z80, 0x8000, 0x4000, bank + 0x4000, bank + 0x4000);
+	} else {
+		Z80MapPages(&cpu_z80, 0x0000, 0x4000, fixedram, fixedram);
+		Z80MapPages(&cpu_z80, 0x4000, 0x8000, bank, bank);
+	}
+	Z80MapPages(&cpu_z80, 0xC000, 0x4000, fixedram + 0x4000, fixedram + 0x4000);
+}
+
 static uint8_t mem_read(int unused, uint16_t addr)
 {
 	uint8_t r;
@@ -560,6 +578,8 @@ void gp_write(uint8_t val)
 			ledmod("Green", val & 0x40);
 	}
 	gpreg = val;
+	if (delta & 0x8F)
+		map_memory();
 }
 
 static uint8_t io_read(int unused, uint16_t addr)
@@ -633,7 +653,7 @@ static void exit_cleanup(void)
 
 static void usage(void)
 {
-	fprintf(stderr, "smallz80: [-f] [-r rompath] [-i idepath] [-d tracemask]\n");
+	fprintf(stderr, "smallz80: [-f] [-r rompath] [-i idepath] [-d tracemask] [-J engine]\n");
 	exit(EXIT_FAILURE);
 }
 
@@ -644,8 +664,9 @@ int main(int argc, char *argv[])
 	int fd;
 	char *rompath = "smallz80.rom";
 	char *idepath[2] = { NULL, NULL };
+	int engine = Z80_ENGINE_SWITCH;
 
-	while((opt = getopt(argc, argv, "r:i:d:f")) != -1) {
+	while((opt = getopt(argc, argv, "r:i:d:fJ:")) != -1) {
 		switch(opt) {
 			case 'r':
 				rompath = optarg;
@@ -662,6 +683,13 @@ int main(int argc, char *argv[])
 			case 'f':
 				fast = 1;
 				break;
+			case 'J':
+				engine = Z80EngineByName(optarg);
+				if (engine == -1) {
+					fprintf(stderr, "smallz80: unknown engine '%s'.\n", optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
 			default:
 				usage();
 		}
@@ -730,6 +758,11 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	map_memory();
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "smallz80: unable to set up CPU engine.\n");
+		exit(EXIT_FAILURE);
+	}
 
 	/* This is the wrong way to do it but it's easier for the moment. We
 	   should track how much real time has occurred and try to keep cycle
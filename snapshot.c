@@ -0,0 +1,313 @@
+/*
+ *	Machine snapshots
+ *
+ *	The file is a header followed by one section per registered hook
+ *
+ *	"EMUSNAP" 0		magic
+ *	u32			format version
+ *	u8 len, name		the machine it was taken on
+ *	{ u8 len, name, u32 size, data }	each section
+ *	u8 0			end
+ *
+ *	All values are little endian. On load every section in the file
+ *	must have a hook and every hook must have a section, and each hook
+ *	must use exactly the bytes that were saved. Anything else means the
+ *	snapshot came from a different version or configuration.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "snapshot.h"
+
+#define SNAPSHOT_VERSION	1
+
+static const uint8_t snap_magic[8] = "EMUSNAP";
+
+struct snapshot_hook {
+	struct snapshot_hook *next;
+	const char *name;
+	snapshot_fn fn;
+	void *priv;
+	unsigned loaded;
+};
+
+struct snapshot {
+	uint8_t *buf;
+	uint32_t len;
+	uint32_t ptr;
+	unsigned loading;
+	unsigned error;
+};
+
+static struct snapshot_hook *hooks;
+
+void snapshot_register(const char *name, snapshot_fn fn, void *priv)
+{
+	struct snapshot_hook *h = malloc(sizeof(*h));
+	struct snapshot_hook **p = &hooks;
+
+	if (h == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	h->next = NULL;
+	h->name = name;
+	h->fn = fn;
+	h->priv = priv;
+	h->loaded = 0;
+	/* Keep them in order so the file is laid out the same each time */
+	while (*p)
+		p = &(*p)->next;
+	*p = h;
+}
+
+unsigned snapshot_loading(struct snapshot *s)
+{
+	return s->loading;
+}
+
+void snapshot_bytes(struct snapshot *s, void *p, unsigned len)
+{
+	if (s->loading) {
+		if (s->ptr + len > s->len) {
+			s->error = 1;
+			memset(p, 0, len);
+			return;
+		}
+		memcpy(p, s->buf + s->ptr, len);
+		s->ptr += len;
+		return;
+	}
+	if (s->ptr + len > s->len) {
+		s->len = (s->ptr + len) * 2;
+		s->buf = realloc(s->buf, s->len);
+		if (s->buf == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+	}
+	memcpy(s->buf + s->ptr, p, len);
+	s->ptr += len;
+}
+
+static uint64_t snap_value(struct snapshot *s, uint64_t v, unsigned len)
+{
+	uint8_t b[8];
+	unsigned i;
+
+	for (i = 0; i < len; i++)
+		b[i] = v >> (8 * i);
+	snapshot_bytes(s, b, len);
+	v = 0;
+	for (i = 0; i < len; i++)
+		v |= (uint64_t)b[i] << (8 * i);
+	return v;
+}
+
+void snapshot_u8(struct snapshot *s, uint8_t *v)
+{
+	snapshot_bytes(s, v, 1);
+}
+
+void snapshot_u16(struct snapshot *s, uint16_t *v)
+{
+	*v = snap_value(s, *v, 2);
+}
+
+void snapshot_u32(struct snapshot *s, uint32_t *v)
+{
+	*v = snap_value(s, *v, 4);
+}
+
+void snapshot_u64(struct snapshot *s, uint64_t *v)
+{
+	*v = snap_value(s, *v, 8);
+}
+
+void snapshot_uint(struct snapshot *s, unsigned *v)
+{
+	*v = snap_value(s, *v, 4);
+}
+
+void snapshot_int(struct snapshot *s, int *v)
+{
+	*v = (int32_t)snap_value(s, (uint32_t)*v, 4);
+}
+
+/* A setting that must be the same on load, such as the board type */
+void snapshot_match(struct snapshot *s, uint32_t v)
+{
+	uint32_t saved = v;
+	snapshot_u32(s, &saved);
+	if (saved != v)
+		s->error = 1;
+}
+
+static void snap_name(struct snapshot *s, const char *name)
+{
+	uint8_t n = strlen(name);
+	snapshot_u8(s, &n);
+	snapshot_bytes(s, (void *)name, n);
+}
+
+int snapshot_save(const char *path, const char *machine)
+{
+	struct snapshot s;
+	struct snapshot_hook *h;
+	uint32_t v = SNAPSHOT_VERSION;
+	uint32_t start;
+	uint32_t size;
+	uint8_t end = 0;
+	char *tmp;
+	FILE *f;
+
+	memset(&s, 0, sizeof(s));
+	snapshot_bytes(&s, (void *)snap_magic, 8);
+	snapshot_u32(&s, &v);
+	snap_name(&s, machine);
+	for (h = hooks; h; h = h->next) {
+		snap_name(&s, h->name);
+		/* Fill in the size once we know it */
+		start = s.ptr;
+		snapshot_u32(&s, &v);
+		h->fn(&s, h->priv);
+		size = s.ptr - start - 4;
+		s.buf[start] = size;
+		s.buf[start + 1] = size >> 8;
+		s.buf[start + 2] = size >> 16;
+		s.buf[start + 3] = size >> 24;
+	}
+	snapshot_u8(&s, &end);
+
+	/* Write it aside and rename it so a failed save leaves the old one */
+	tmp = malloc(strlen(path) + 5);
+	if (tmp == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	sprintf(tmp, "%s.new", path);
+	f = fopen(tmp, "w");
+	if (f == NULL) {
+		perror(tmp);
+		goto fail;
+	}
+	if (fwrite(s.buf, s.ptr, 1, f) != 1) {
+		perror(tmp);
+		fclose(f);
+		goto fail;
+	}
+	if (fclose(f) || rename(tmp, path)) {
+		perror(path);
+		goto fail;
+	}
+	free(tmp);
+	free(s.buf);
+	return 0;
+fail:
+	remove(tmp);
+	free(tmp);
+	free(s.buf);
+	return -1;
+}
+
+static int snap_get_name(struct snapshot *s, char *name)
+{
+	uint8_t n;
+	snapshot_u8(s, &n);
+	snapshot_bytes(s, name, n);
+	name[n] = 0;
+	return n;
+}
+
+int snapshot_load(const char *path, const char *machine)
+{
+	struct snapshot s, sec;
+	struct snapshot_hook *h;
+	uint8_t magic[8];
+	uint32_t v;
+	uint32_t size;
+	char name[256];
+	long len;
+	FILE *f;
+
+	f = fopen(path, "r");
+	if (f == NULL) {
+		perror(path);
+		return -1;
+	}
+	memset(&s, 0, sizeof(s));
+	if (fseek(f, 0L, SEEK_END) == 0 && (len = ftell(f)) > 0) {
+		s.len = len;
+		s.buf = malloc(s.len);
+		if (s.buf == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+		rewind(f);
+		if (fread(s.buf, s.len, 1, f) != 1)
+			s.error = 1;
+	}
+	fclose(f);
+	s.loading = 1;
+
+	snapshot_bytes(&s, magic, 8);
+	snapshot_u32(&s, &v);
+	if (s.error || memcmp(magic, snap_magic, 8)) {
+		fprintf(stderr, "%s: not a snapshot.\n", path);
+		goto fail;
+	}
+	if (v != SNAPSHOT_VERSION) {
+		fprintf(stderr, "%s: snapshot version %u is not supported.\n", path, v);
+		goto fail;
+	}
+	snap_get_name(&s, name);
+	if (strcmp(name, machine)) {
+		fprintf(stderr, "%s: snapshot is of a %s not a %s.\n", path, name, machine);
+		goto fail;
+	}
+	for (h = hooks; h; h = h->next)
+		h->loaded = 0;
+	while (snap_get_name(&s, name)) {
+		snapshot_u32(&s, &size);
+		if (size > s.len - s.ptr)
+			s.error = 1;
+		if (s.error)
+			break;
+		for (h = hooks; h; h = h->next)
+			if (strcmp(h->name, name) == 0)
+				break;
+		if (h == NULL) {
+			fprintf(stderr, "%s: snapshot has %s which this machine does not.\n", path, name);
+			goto fail;
+		}
+		/* Hand the hook just its own section */
+		sec = s;
+		sec.buf = s.buf + s.ptr;
+		sec.len = size;
+		sec.ptr = 0;
+		h->fn(&sec, h->priv);
+		if (sec.error || sec.ptr != size) {
+			fprintf(stderr, "%s: %s state does not match.\n", path, name);
+			goto fail;
+		}
+		h->loaded = 1;
+		s.ptr += size;
+	}
+	if (s.error) {
+		fprintf(stderr, "%s: snapshot is truncated.\n", path);
+		goto fail;
+	}
+	for (h = hooks; h; h = h->next) {
+		if (!h->loaded) {
+			fprintf(stderr, "%s: snapshot has no %s state.\n", path, h->name);
+			goto fail;
+		}
+	}
+	free(s.buf);
+	return 0;
+fail:
+	free(s.buf);
+	return -1;
+}
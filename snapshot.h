@@ -0,0 +1,27 @@
+/*
+ *	Machine snapshots. Each part of the machine registers a hook under a
+ *	name. The same hook is used to save and to load: it hands each field
+ *	in turn to the snapshot_ calls below which either write it out or
+ *	fill it in, so the two cannot get out of step.
+ *
+ *	Only emulated state goes in a snapshot. Disk images and the like stay
+ *	where they are so must be the same ones the snapshot was taken with.
+ */
+
+struct snapshot;
+
+typedef void (*snapshot_fn)(struct snapshot *s, void *priv);
+
+void snapshot_register(const char *name, snapshot_fn fn, void *priv);
+int snapshot_save(const char *path, const char *machine);
+int snapshot_load(const char *path, const char *machine);
+
+unsigned snapshot_loading(struct snapshot *s);
+void snapshot_bytes(struct snapshot *s, void *p, unsigned len);
+void snapshot_u8(struct snapshot *s, uint8_t *v);
+void snapshot_u16(struct snapshot *s, uint16_t *v);
+void snapshot_u32(struct snapshot *s, uint32_t *v);
+void snapshot_u64(struct snapshot *s, uint64_t *v);
+void snapshot_uint(struct snapshot *s, unsigned *v);
+void snapshot_int(struct snapshot *s, int *v);
+void snapshot_match(struct snapshot *s, uint32_t v);
@@ -116,7 +116,7 @@ static unsigned live_irq;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
 
 static int check_chario(void)
 {
@@ -190,27 +190,8 @@ static void mem_write(int unused, uint16_t addr, uint8_t val)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate;
 	uint8_t r = do_mem_read(addr, 0);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r == 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
 	if ((addr & 0xF000) == 0xE000)
 		romlatch = 0;
 	return r;
@@ -455,7 +436,7 @@ static void poll_irq_event(void)
 #endif
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	live_irq = 0;
 	poll_irq_event();
@@ -832,6 +813,7 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
 
 	romlatch = 1;
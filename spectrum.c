@@ -113,8 +113,6 @@ static unsigned int_recalc;
 
 static int trace = 0;
 
-static void reti_event(void);
-
 static uint8_t *divbank(unsigned bank, unsigned page, unsigned off)
 {
 	bank <<= 2;
@@ -207,7 +205,6 @@ static void mem_write(int unused, uint16_t addr, uint8_t val)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate;
 	uint8_t r;
 
 	/* DivIDE+ modes other than 00 don't autopage */
@@ -222,32 +219,14 @@ static uint8_t mem_read(int unused, uint16_t addr)
 
 	r = do_mem_read(addr, 0);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		if (!(divplus_latch & 0xC0)) {
-			/* ROM paging logic */
-			if (divide && addr >= 0x1FF8 && addr <= 0x1FFF)
-				divide_mapped = 0;
-			if (divide && (addr == 0x0000 || addr == 0x0008 || addr == 0x0038 ||
-				addr == 0x0066 || addr == 0x04C6 || addr == 0x0562))
-				divide_mapped = 1;
-		}
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r == 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
+	if (cpu_z80.M1 && !(divplus_latch & 0xC0)) {
+		/* ROM paging logic */
+		if (divide && addr >= 0x1FF8 && addr <= 0x1FFF)
+			divide_mapped = 0;
+		if (divide && (addr == 0x0000 || addr == 0x0008 || addr == 0x0038 ||
+			addr == 0x0066 || addr == 0x04C6 || addr == 0x0562))
+			divide_mapped = 1;
 	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
 	return r;
 }
 
@@ -527,10 +506,6 @@ static void poll_irq_event(void)
 {
 }
 
-static void reti_event(void)
-{
-}
-
 static void raster_byte(unsigned lines, unsigned cols, uint8_t byte, uint8_t attr)
 {
 	uint32_t *pixp;
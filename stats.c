@@ -0,0 +1,204 @@
+/*
+ *	Performance counters
+ *
+ *	Counting is cheap and always on. Timing the device timers costs a
+ *	clock read either side of each callback so that is only done when a
+ *	report at exit has been asked for.
+ *
+ *	Wall time is taken from stats_init. Anything not spent in the real
+ *	time pacing sleep is counted as executing, which includes the device
+ *	work and console I/O done on the emulator thread.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include "stats.h"
+
+#define STATS_SOURCES	4
+
+struct stats stats;
+unsigned stats_timing;
+volatile sig_atomic_t stats_wanted;
+
+static const char *stats_machine = "";
+static double stats_mhz;
+static unsigned stats_format = STATS_TEXT;
+static uint64_t stats_start;
+static unsigned stats_at_exit;
+
+static struct {
+	void (*fn)(void *priv);
+	void *priv;
+} sources[STATS_SOURCES];
+static unsigned nsources;
+static unsigned ndevices;
+
+uint64_t stats_clock(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* A fixed nap for boards that pace themselves, counted as a pacing wait */
+int stats_nap(const struct timespec *ts)
+{
+	uint64_t start = stats_clock();
+	int r = nanosleep(ts, NULL);
+
+	stats.sleeps++;
+	stats.sleep_ns += stats_clock() - start;
+	return r;
+}
+
+static void stats_signal(int sig)
+{
+	stats_wanted = 1;
+}
+
+static void stats_atexit(void)
+{
+	stats_exit();
+}
+
+unsigned stats_mode(const char *p)
+{
+	if (strcmp(p, "text") == 0)
+		return STATS_TEXT;
+	if (strcmp(p, "json") == 0)
+		return STATS_JSON;
+	fprintf(stderr, "Stats format must be text or json.\n");
+	exit(1);
+}
+
+/* mhz is the speed the machine is meant to run at, or 0 if it varies */
+void stats_init(const char *machine, double mhz, unsigned mode)
+{
+	stats_machine = machine;
+	stats_mhz = mhz;
+	stats_start = stats_clock();
+	signal(SIGUSR1, stats_signal);
+	if (mode != STATS_OFF) {
+		stats_format = mode;
+		stats_timing = 1;
+		stats_at_exit = 1;
+		atexit(stats_atexit);
+	}
+}
+
+/* Something that will call stats_device for each device it times */
+void stats_source(void (*fn)(void *priv), void *priv)
+{
+	if (nsources == STATS_SOURCES) {
+		fprintf(stderr, "Too many stats sources.\n");
+		exit(1);
+	}
+	sources[nsources].fn = fn;
+	sources[nsources++].priv = priv;
+}
+
+void stats_forget(void *priv)
+{
+	unsigned i;
+
+	for (i = 0; i < nsources; i++) {
+		if (sources[i].priv == priv) {
+			sources[i] = sources[--nsources];
+			return;
+		}
+	}
+}
+
+void stats_device(const char *name, uint64_t calls, uint64_t ns)
+{
+	if (calls == 0)
+		return;
+	if (stats_format == STATS_JSON)
+		fprintf(stderr, "%s{\"name\":\"%s\",\"calls\":%llu,\"ns\":%llu}",
+			ndevices ? "," : "", name,
+			(unsigned long long)calls, (unsigned long long)ns);
+	else
+		fprintf(stderr, "  %-12s %12llu calls %10.3fs %8.1fns/call\n",
+			name, (unsigned long long)calls, ns / 1E9,
+			(double)ns / calls);
+	ndevices++;
+}
+
+static void stats_devices(void)
+{
+	unsigned i;
+
+	ndevices = 0;
+	for (i = 0; i < nsources; i++)
+		sources[i].fn(sources[i].priv);
+}
+
+void stats_report(void)
+{
+	uint64_t wall = stats_clock() - stats_start;
+	uint64_t sleep_ns = stats.sleep_ns;
+	uint64_t run_ns = wall > sleep_ns ? wall - sleep_ns : 0;
+	double secs = wall / 1E9;
+	double mhz = secs ? stats.cycles / secs / 1E6 : 0;
+	double nspi = stats.instructions ? (double)run_ns / stats.instructions : 0;
+
+	stats_wanted = 0;
+	if (stats_format == STATS_JSON) {
+		fprintf(stderr, "{\"machine\":\"%s\",\"seconds\":%.3f,"
+			"\"cycles\":%llu,\"instructions\":%llu,"
+			"\"mhz\":%.3f,\"target_mhz\":%.3f,\"ns_per_instruction\":%.2f,"
+			"\"run_seconds\":%.3f,\"sleep_seconds\":%.3f,\"sleeps\":%llu,"
+			"\"frames\":%llu,\"syscalls\":{\"poll\":%llu,\"read\":%llu,"
+			"\"write\":%llu,\"disk_read\":%llu,\"disk_write\":%llu},"
+			"\"devices\":[",
+			stats_machine, secs,
+			(unsigned long long)stats.cycles,
+			(unsigned long long)stats.instructions,
+			mhz, stats_mhz, nspi, run_ns / 1E9, sleep_ns / 1E9,
+			(unsigned long long)stats.sleeps,
+			(unsigned long long)stats.frames,
+			(unsigned long long)stats.polls,
+			(unsigned long long)stats.reads,
+			(unsigned long long)stats.writes,
+			(unsigned long long)stats.disk_reads,
+			(unsigned long long)stats.disk_writes);
+		if (stats_timing)
+			stats_devices();
+		fprintf(stderr, "]}\n");
+		return;
+	}
+	fprintf(stderr, "[%s: %.3fs, %llu clocks, %.3fMHz", stats_machine, secs,
+		(unsigned long long)stats.cycles, mhz);
+	if (stats_mhz)
+		fprintf(stderr, " (target %.3fMHz, %.0f%%)", stats_mhz,
+			100 * mhz / stats_mhz);
+	fprintf(stderr, "]\n");
+	if (stats.instructions)
+		fprintf(stderr, "  %llu instructions, %.1fns each\n",
+			(unsigned long long)stats.instructions, nspi);
+	fprintf(stderr, "  running %.3fs, sleeping %.3fs in %llu waits\n",
+		run_ns / 1E9, sleep_ns / 1E9, (unsigned long long)stats.sleeps);
+	fprintf(stderr, "  %llu frames; poll %llu, read %llu, write %llu; disk read %llu, write %llu\n",
+		(unsigned long long)stats.frames,
+		(unsigned long long)stats.polls,
+		(unsigned long long)stats.reads,
+		(unsigned long long)stats.writes,
+		(unsigned long long)stats.disk_reads,
+		(unsigned long long)stats.disk_writes);
+	if (stats_timing)
+		stats_devices();
+}
+
+/* Boards that tear down before exit call this first so the report still
+   has the devices in it */
+void stats_exit(void)
+{
+	if (stats_at_exit) {
+		stats_at_exit = 0;
+		stats_report();
+	}
+}
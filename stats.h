@@ -0,0 +1,40 @@
+/*
+ *	Performance counters. The board and the shared code bump these as
+ *	they run and stats_report prints where the time went, either when
+ *	SIGUSR1 arrives or at exit.
+ */
+
+struct stats {
+	uint64_t cycles;	/* Emulated clocks run */
+	uint64_t instructions;	/* Left at 0 if the CPU core can't count them */
+	uint64_t frames;	/* Display frames rendered */
+	uint64_t sleeps;	/* Real time pacing waits */
+	uint64_t sleep_ns;
+	uint64_t disk_reads;
+	uint64_t disk_writes;
+	/* Bumped from the console threads so use stats_count */
+	uint64_t polls;
+	uint64_t reads;
+	uint64_t writes;
+};
+
+extern struct stats stats;
+/* Set if device timers should be timed */
+extern unsigned stats_timing;
+extern volatile sig_atomic_t stats_wanted;
+
+#define STATS_OFF	0	/* Report only on SIGUSR1 */
+#define STATS_TEXT	1
+#define STATS_JSON	2
+
+#define stats_count(x)	__atomic_fetch_add(&stats.x, 1, __ATOMIC_RELAXED)
+
+void stats_init(const char *machine, double mhz, unsigned mode);
+unsigned stats_mode(const char *p);
+uint64_t stats_clock(void);
+int stats_nap(const struct timespec *ts);
+void stats_source(void (*fn)(void *priv), void *priv);
+void stats_forget(void *priv);
+void stats_device(const char *name, uint64_t calls, uint64_t ns);
+void stats_report(void);
+void stats_exit(void);
@@ -0,0 +1,282 @@
+/*
+ *	Device timing queue
+ *
+ *	A binary min heap of timers keyed on the emulated clock. Ties fire in
+ *	the order they were set so devices with the same period keep running
+ *	in the order they were registered.
+ *
+ *	Periodic timers that fall behind (because the CPU was allowed to run
+ *	past them while idle) fire once and skip the periods they missed. The
+ *	callback is told how many clocks really went by.
+ *
+ *	When stats are being kept each timer counts its calls and the host
+ *	time they took, which is reported under its name.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include "timerq.h"
+#include "stats.h"
+
+struct timerq_timer {
+	struct timerq *q;
+	struct timerq_timer *next;
+	const char *name;
+	timerq_fn fn;
+	void *priv;
+	unsigned flags;
+	uint64_t when;
+	uint64_t last;		/* When it last fired or was set */
+	uint64_t seq;
+	unsigned long period;
+	int slot;		/* Position in the heap or -1 */
+	uint64_t calls;
+	uint64_t ns;
+};
+
+struct timerq {
+	uint64_t now;
+	uint64_t seq;
+	struct timerq_timer **heap;
+	unsigned n;
+	unsigned size;
+	struct timerq_timer *timers;
+};
+
+static int timerq_before(struct timerq_timer *a, struct timerq_timer *b)
+{
+	if (a->when != b->when)
+		return a->when < b->when;
+	return a->seq < b->seq;
+}
+
+static void timerq_place(struct timerq *q, struct timerq_timer *t, unsigned slot)
+{
+	q->heap[slot] = t;
+	t->slot = slot;
+}
+
+static void timerq_up(struct timerq *q, unsigned slot)
+{
+	struct timerq_timer *t = q->heap[slot];
+	while (slot) {
+		unsigned parent = (slot - 1) / 2;
+		if (!timerq_before(t, q->heap[parent]))
+			break;
+		timerq_place(q, q->heap[parent], slot);
+		slot = parent;
+	}
+	timerq_place(q, t, slot);
+}
+
+static void timerq_down(struct timerq *q, unsigned slot)
+{
+	struct timerq_timer *t = q->heap[slot];
+	while (1) {
+		unsigned c = slot * 2 + 1;
+		if (c >= q->n)
+			break;
+		if (c + 1 < q->n && timerq_before(q->heap[c + 1], q->heap[c]))
+			c++;
+		if (!timerq_before(q->heap[c], t))
+			break;
+		timerq_place(q, q->heap[c], slot);
+		slot = c;
+	}
+	timerq_place(q, t, slot);
+}
+
+static void timerq_remove(struct timerq_timer *t)
+{
+	struct timerq *q = t->q;
+	struct timerq_timer *moved;
+	unsigned slot = t->slot;
+
+	t->slot = -1;
+	if (--q->n == slot)
+		return;
+	/* Move the last entry into the hole and let it find its level */
+	moved = q->heap[q->n];
+	timerq_place(q, moved, slot);
+	timerq_up(q, slot);
+	timerq_down(q, moved->slot);
+}
+
+static void timerq_insert(struct timerq_timer *t, uint64_t when)
+{
+	struct timerq *q = t->q;
+
+	if (t->slot != -1)
+		timerq_remove(t);
+	if (q->n == q->size) {
+		q->size = q->size ? q->size * 2 : 16;
+		q->heap = realloc(q->heap, q->size * sizeof(*q->heap));
+		if (q->heap == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+	}
+	t->when = when;
+	t->seq = q->seq++;
+	timerq_place(q, t, q->n++);
+	timerq_up(q, t->slot);
+}
+
+/* Fire t in clocks time. A periodic timer stops being periodic */
+void timerq_in(struct timerq_timer *t, unsigned long clocks)
+{
+	t->period = 0;
+	t->last = t->q->now;
+	timerq_insert(t, t->q->now + clocks);
+}
+
+/* As timerq_in but leave t alone if it is due sooner already. Returns 1
+   if the deadline was moved */
+int timerq_by(struct timerq_timer *t, unsigned long clocks)
+{
+	if (t->slot != -1 && t->when <= t->q->now + clocks)
+		return 0;
+	timerq_in(t, clocks);
+	return 1;
+}
+
+/* Fire t every period clocks starting period clocks from now */
+void timerq_every(struct timerq_timer *t, unsigned long period)
+{
+	t->period = period;
+	t->last = t->q->now;
+	timerq_insert(t, t->q->now + period);
+}
+
+void timerq_cancel(struct timerq_timer *t)
+{
+	t->period = 0;
+	if (t->slot != -1)
+		timerq_remove(t);
+}
+
+/* Whether t is just polling (TQ_IDLE) or has real work coming up */
+void timerq_idle(struct timerq_timer *t, int idle)
+{
+	if (idle)
+		t->flags |= TQ_IDLE;
+	else
+		t->flags &= ~TQ_IDLE;
+}
+
+/* The current time. Inside a callback this is the deadline being fired */
+uint64_t timerq_now(struct timerq *q)
+{
+	return q->now;
+}
+
+/* Clocks the CPU can run before the next deadline, at most limit. If idle
+   is set then TQ_IDLE timers are ignored */
+unsigned long timerq_due(struct timerq *q, unsigned long limit, unsigned idle)
+{
+	uint64_t when = q->now + limit;
+	unsigned i;
+
+	if (!idle) {
+		if (q->n && q->heap[0]->when < when)
+			when = q->heap[0]->when;
+	} else {
+		for (i = 0; i < q->n; i++) {
+			struct timerq_timer *t = q->heap[i];
+			if (!(t->flags & TQ_IDLE) && t->when < when)
+				when = t->when;
+		}
+	}
+	if (when <= q->now)
+		return 0;
+	return when - q->now;
+}
+
+/* The CPU has run for clocks: fire everything that is now due */
+void timerq_run(struct timerq *q, unsigned long clocks)
+{
+	uint64_t end = q->now + clocks;
+
+	while (q->n && q->heap[0]->when <= end) {
+		struct timerq_timer *t = q->heap[0];
+		uint64_t when = t->when;
+		unsigned long elapsed = when - t->last;
+
+		timerq_remove(t);
+		q->now = when;
+		t->last = when;
+		if (t->period) {
+			uint64_t next = when + t->period;
+			if (next <= end)
+				next += ((end - next) / t->period + 1) * t->period;
+			timerq_insert(t, next);
+		}
+		/* May re-arm or cancel itself */
+		if (stats_timing) {
+			/* Pacing sleeps are counted on their own */
+			uint64_t start = stats_clock() - stats.sleep_ns;
+			t->fn(t->priv, elapsed);
+			t->ns += stats_clock() - stats.sleep_ns - start;
+			t->calls++;
+		} else
+			t->fn(t->priv, elapsed);
+	}
+	q->now = end;
+}
+
+/* Report the time each timer has taken */
+static void timerq_stats(void *priv)
+{
+	struct timerq *q = priv;
+	struct timerq_timer *t;
+
+	for (t = q->timers; t; t = t->next)
+		stats_device(t->name, t->calls, t->ns);
+}
+
+struct timerq_timer *timerq_timer(struct timerq *q, const char *name, timerq_fn fn, void *priv, unsigned flags)
+{
+	struct timerq_timer *t = malloc(sizeof(struct timerq_timer));
+	if (t == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	memset(t, 0, sizeof(*t));
+	t->q = q;
+	t->name = name;
+	t->fn = fn;
+	t->priv = priv;
+	t->flags = flags;
+	t->slot = -1;
+	t->next = q->timers;
+	q->timers = t;
+	return t;
+}
+
+struct timerq *timerq_create(void)
+{
+	struct timerq *q = malloc(sizeof(struct timerq));
+	if (q == NULL) {
+		fprintf(stderr, "Out of memory.\n");
+		exit(1);
+	}
+	memset(q, 0, sizeof(*q));
+	stats_source(timerq_stats, q);
+	return q;
+}
+
+void timerq_free(struct timerq *q)
+{
+	struct timerq_timer *t = q->timers;
+	stats_forget(q);
+	while (t) {
+		struct timerq_timer *n = t->next;
+		free(t);
+		t = n;
+	}
+	free(q->heap);
+	free(q);
+}
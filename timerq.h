@@ -0,0 +1,27 @@
+/*
+ *	Device timing queue. Time is counted in CPU clocks. Each device that
+ *	needs to do work at some point in emulated time owns a timer and sets
+ *	its next deadline. The main loop runs the CPU up to the earliest
+ *	deadline and then calls timerq_run to fire whatever is due.
+ */
+
+struct timerq;
+struct timerq_timer;
+
+/* Called with the clocks since the timer last fired (or was set) */
+typedef void (*timerq_fn)(void *priv, unsigned long clocks);
+
+struct timerq *timerq_create(void);
+void timerq_free(struct timerq *q);
+struct timerq_timer *timerq_timer(struct timerq *q, const char *name, timerq_fn fn, void *priv, unsigned flags);
+void timerq_in(struct timerq_timer *t, unsigned long clocks);
+int timerq_by(struct timerq_timer *t, unsigned long clocks);
+void timerq_every(struct timerq_timer *t, unsigned long period);
+void timerq_cancel(struct timerq_timer *t);
+void timerq_idle(struct timerq_timer *t, int idle);
+uint64_t timerq_now(struct timerq *q);
+unsigned long timerq_due(struct timerq *q, unsigned long limit, unsigned idle);
+void timerq_run(struct timerq *q, unsigned long clocks);
+
+/* Polling work that can be put off while the CPU is idle (eg halted) */
+#define TQ_IDLE		1
@@ -14,6 +14,11 @@
 #include <arpa/inet.h>
 #include "ide.h"
 #include "duart.h"
+#include "serialdevice.h"
+#include "ttycon.h"
+#include "realtime.h"
+#include "trigger.h"
+#include "stats.h"
 
 /* 16MB RAM except for the top 32K which is I/O */
 
@@ -152,6 +157,8 @@ static unsigned int do_io_readb(unsigned int address)
 
 static void do_io_writeb(unsigned int address, unsigned int value)
 {
+	if (trigger_pending & TRIGGER_IO)
+		trigger_io(address);
 	if (address == 0xFFFFFF) {
 		printf("<%c>", value);
 		return;
@@ -311,6 +318,9 @@ void cpu_write_pd(unsigned int address, unsigned int value)
 
 void cpu_instr_callback(void)
 {
+	stats.instructions++;
+	if (trigger_pending & TRIGGER_PC)
+		trigger_pc(m68k_get_reg(NULL, M68K_REG_PC));
 	if (trace & TRACE_CPU) {
 		char buf[128];
 		unsigned int pc = m68k_get_reg(NULL, M68K_REG_PC);
@@ -319,6 +329,25 @@ void cpu_instr_callback(void)
 	}
 }
 
+static uint64_t duart_calls;
+static uint64_t duart_ns;
+
+static void duart_stats(void *priv)
+{
+	stats_device("duart", duart_calls, duart_ns);
+}
+
+static void tick_duart(void)
+{
+	if (stats_timing) {
+		uint64_t start = stats_clock();
+		duart_tick(duart);
+		duart_ns += stats_clock() - start;
+		duart_calls++;
+	} else
+		duart_tick(duart);
+}
+
 static void device_init(void)
 {
 	irq_pending = 0;
@@ -341,15 +370,6 @@ static void exit_cleanup(void)
 }
 
 
-static void take_a_nap(void)
-{
-	struct timespec t;
-	t.tv_sec = 0;
-	t.tv_nsec = 100000;
-	if (nanosleep(&t, NULL))
-		perror("nanosleep");
-}
-
 void cpu_pulse_reset(void)
 {
 	device_init();
@@ -361,7 +381,7 @@ void cpu_set_fc(int fc)
 
 void usage(void)
 {
-	fprintf(stderr, "tiny68k [-0][-1][-2][-e][-R][-r rompath][-i idepath][-d debug].\n");
+	fprintf(stderr, "tiny68k [-0][-1][-2][-e][-R][-f][-o][-x speed][-t trigger][-r rompath][-i idepath][-d debug][-j text|json].\n");
 	exit(1);
 }
 
@@ -370,11 +390,14 @@ int main(int argc, char *argv[])
 	int fd;
 	int cputype = M68K_CPU_TYPE_68000;
 	int fast = 0;
+	unsigned statsmode = STATS_OFF;
+	double speed = 1.0;
+	unsigned i;
 	int opt;
 	const char *romname = "tiny68k.rom";
 	const char *diskname = "tiny68k.ide";
 
-	while((opt = getopt(argc, argv, "012eRfd:i:r:")) != -1) {
+	while((opt = getopt(argc, argv, "012eRfd:i:j:or:t:x:")) != -1) {
 		switch(opt) {
 		case '0':
 			cputype = M68K_CPU_TYPE_68000;
@@ -394,12 +417,27 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'o':
+			console_unbuffered();
+			break;
+		case 'x':
+			speed = atof(optarg);
+			if (speed <= 0)
+				usage();
+			break;
+		case 't':
+			if (trigger_set(optarg))
+				usage();
+			break;
 		case 'd':
 			trace = atoi(optarg);
 			break;
 		case 'i':
 			diskname = optarg;
 			break;
+		case 'j':
+			statsmode = stats_mode(optarg);
+			break;
 		case 'r':
 			romname = optarg;
 			break;
@@ -463,14 +501,25 @@ int main(int argc, char *argv[])
 	/* Init devices */
 	device_init();
 
+	realtime_init(speed);
+	if (!fast)
+		atexit(realtime_report);
+	stats_source(duart_stats, NULL);
+	stats_init("tiny68k", fast ? 0 : 10 * speed, statsmode);
+
 	while (1) {
 		/* A 10MHz 68000 should do 1000 cycles per 1/10000th of a
-		   second. We do a blind 0.01 second sleep so we are actually
-		   emulating a bit under 10Mhz - which will do fine for
-		   testing this stuff */
-		m68k_execute(1000);
-		duart_tick(duart);
-		if (!fast)
-			take_a_nap();
+		   second. Keep in step with real time every 10ms */
+		for (i = 0; i < 100; i++) {
+			stats.cycles += m68k_execute(1000);
+			tick_duart();
+		}
+		if (stats_wanted)
+			stats_report();
+		if (trigger_pending & TRIGGER_TIME)
+			trigger_elapsed(10000000);
+		if (!fast && !trigger_pending)
+			realtime_sleep(10000000);
+		console_flush();
 	}
 }
@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include "tms9918a.h"
+#include "snapshot.h"
 
 struct tms9918a {
 	uint8_t reg[8];	/* We just ignore invalid bits, you can't read them
@@ -641,3 +642,15 @@ uint32_t tms9918a_get_background(struct tms9918a *vdp)
 {
 	return vdp->colourmap[vdp->reg[7] & 0xF];
 }
+
+/* The raster is rebuilt on the next frame so only the chip state is kept */
+void tms9918a_snapshot(struct tms9918a *vdp, struct snapshot *s)
+{
+	snapshot_bytes(s, vdp->reg, sizeof(vdp->reg));
+	snapshot_u8(s, &vdp->status);
+	snapshot_bytes(s, vdp->framebuffer, sizeof(vdp->framebuffer));
+	snapshot_uint(s, &vdp->latch);
+	snapshot_uint(s, &vdp->read);
+	snapshot_u16(s, &vdp->addr);
+	snapshot_u16(s, &vdp->memmask);
+}
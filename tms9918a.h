@@ -1,4 +1,5 @@
 struct tms9918a;
+struct snapshot;
 
 extern void tms9918a_rasterize(struct tms9918a *vdp);
 extern void tms9918a_write(struct tms9918a *vdp, uint8_t addr, uint8_t val);
@@ -11,3 +12,4 @@ extern int tms9918a_irq_pending(struct tms9918a *vdp);
 extern uint32_t *tms9918a_get_raster(struct tms9918a *vdp);
 extern void tms9918a_set_colourmap(struct tms9918a *vdp, uint32_t *ctab);
 extern uint32_t tms9918a_get_background(struct tms9918a *vdp);
+extern void tms9918a_snapshot(struct tms9918a *vdp, struct snapshot *s);
@@ -0,0 +1,114 @@
+/*
+ *	Boot triggers
+ *
+ *	While a trigger is pending the board skips its real time pacing. When
+ *	it goes off we restart the pacing clock from now so the machine does
+ *	not then try to make up for the time it ran ahead.
+ *
+ *	The hooks are cheap but the boards only call them while the matching
+ *	bit of trigger_pending is set.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "serialdevice.h"
+#include "ttycon.h"
+#include "realtime.h"
+#include "trigger.h"
+
+unsigned trigger_pending;
+
+static char *match;
+static unsigned matchlen;
+static char *seen;		/* The last matchlen bytes of output */
+static unsigned seenptr;
+static uint32_t value;
+static uint64_t ns_left;
+
+static void trigger_fire(void)
+{
+	trigger_pending = 0;
+	console_snoop = NULL;
+	fprintf(stderr, "[Trigger reached: now running in real time.]\n");
+	realtime_resync();
+}
+
+static void trigger_output(uint8_t c)
+{
+	unsigned i;
+	unsigned p;
+
+	seen[seenptr] = c;
+	seenptr = (seenptr + 1) % matchlen;
+	/* The oldest byte is now at seenptr */
+	p = seenptr;
+	for (i = 0; i < matchlen; i++) {
+		if (seen[p] != match[i])
+			return;
+		p = (p + 1) % matchlen;
+	}
+	trigger_fire();
+}
+
+void trigger_pc(uint32_t pc)
+{
+	if (pc == value)
+		trigger_fire();
+}
+
+void trigger_io(uint32_t port)
+{
+	if (port == value)
+		trigger_fire();
+}
+
+void trigger_elapsed(unsigned long ns)
+{
+	if (ns >= ns_left)
+		trigger_fire();
+	else
+		ns_left -= ns;
+}
+
+/* Returns -1 if the trigger is not understood */
+int trigger_set(const char *spec)
+{
+	char *end;
+
+	if (strncmp(spec, "out:", 4) == 0) {
+		matchlen = strlen(spec + 4);
+		if (matchlen == 0)
+			return -1;
+		match = strdup(spec + 4);
+		seen = calloc(1, matchlen);
+		if (match == NULL || seen == NULL) {
+			fprintf(stderr, "Out of memory.\n");
+			exit(1);
+		}
+		console_snoop = trigger_output;
+		trigger_pending = TRIGGER_OUT;
+		return 0;
+	}
+	if (strncmp(spec, "time:", 5) == 0) {
+		double t = strtod(spec + 5, &end);
+		if (*end || t <= 0)
+			return -1;
+		ns_left = t * 1000000000.0;
+		trigger_pending = TRIGGER_TIME;
+		return 0;
+	}
+	if (strncmp(spec, "pc:", 3) == 0)
+		trigger_pending = TRIGGER_PC;
+	else if (strncmp(spec, "io:", 3) == 0)
+		trigger_pending = TRIGGER_IO;
+	else
+		return -1;
+	value = strtoul(spec + 3, &end, 16);
+	if (spec[3] == 0 || *end) {
+		trigger_pending = 0;
+		return -1;
+	}
+	return 0;
+}
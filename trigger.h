@@ -0,0 +1,22 @@
+/*
+ *	Run flat out until the machine reaches a given point and then switch
+ *	to real time. The trigger is given as one of
+ *
+ *	out:text	the console prints text (eg out:login:)
+ *	pc:addr		the CPU starts an instruction at addr (hex)
+ *	io:port		the CPU writes to the I/O port or I/O address (hex)
+ *	time:secs	that many seconds of emulated time have run
+ */
+
+#define TRIGGER_OUT	1
+#define TRIGGER_PC	2
+#define TRIGGER_IO	4
+#define TRIGGER_TIME	8
+
+/* The type of trigger still to be reached, 0 once it has gone off */
+extern unsigned trigger_pending;
+
+int trigger_set(const char *spec);
+void trigger_pc(uint32_t pc);
+void trigger_io(uint32_t port);
+void trigger_elapsed(unsigned long ns);
@@ -3,42 +3,294 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
-#include <sys/select.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
 #include "serialdevice.h"
 #include "ttycon.h"
+#include "replay.h"
+#include "stats.h"
 
 /*
  *	This replaces the old hard coded serial to tty link
+ *
+ *	The guest polls the UART status far more often than anything
+ *	arrives so rather than select() on every poll the tty is handled by
+ *	a reader and a writer thread. They exchange bytes with the emulator
+ *	through single producer/single consumer rings so checking status is
+ *	just a couple of loads. The threads are only started when the
+ *	console is first used.
+ *
+ *	Output is batched: the writer sleeps until something is queued, then
+ *	gives the batch up to 20ms to fill. A newline, a ring that is filling
+ *	up, an input read or a console_flush() (which the boards do each
+ *	frame) send it at once. console_unbuffered() goes back to writing
+ *	every byte as it comes.
  */
+
+void (*console_snoop)(uint8_t c);
+
+static unsigned con_batch = 1;
+
+/* Lock step input, see console_lockstep() */
+#define CON_PACE	256	/* Status polls between bytes */
+
+static unsigned con_lockstep;
+static int con_peek = -1;
+static unsigned con_pace;
+
+/* When a recording first saw the byte waiting */
+static unsigned con_seen;
+static uint64_t con_seen_at;
+
+#define CON_RING	4096	/* Must be a power of two */
+
+struct con_ring {
+	uint8_t buf[CON_RING];
+	unsigned head;		/* Only written by the producer */
+	unsigned tail;		/* Only written by the consumer */
+	pthread_mutex_t lock;
+	pthread_cond_t wake;	/* Sleeping side waiting for a change */
+	unsigned waiting;
+	unsigned started;
+	unsigned flush;		/* Output wanted now rather than batched */
+};
+
+static struct con_ring con_in = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.wake = PTHREAD_COND_INITIALIZER
+};
+
+static struct con_ring con_out = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.wake = PTHREAD_COND_INITIALIZER
+};
+
+/*
+ *	head and tail are only written by their owner. The waiting flag and
+ *	the indices are all sequentially consistent so that a side going to
+ *	sleep either sees the other side's update or the other side sees that
+ *	it needs waking.
+ */
+static unsigned ring_used(struct con_ring *r)
+{
+	return __atomic_load_n(&r->head, __ATOMIC_SEQ_CST) -
+		__atomic_load_n(&r->tail, __ATOMIC_SEQ_CST);
+}
+
+/* Wait until the other side moves the ring on from n bytes used */
+static void ring_wait(struct con_ring *r, unsigned n)
+{
+	pthread_mutex_lock(&r->lock);
+	__atomic_store_n(&r->waiting, 1, __ATOMIC_SEQ_CST);
+	while (ring_used(r) == n)
+		pthread_cond_wait(&r->wake, &r->lock);
+	__atomic_store_n(&r->waiting, 0, __ATOMIC_SEQ_CST);
+	pthread_mutex_unlock(&r->lock);
+}
+
+/* Wait until a flush is asked for, giving up after ms milliseconds */
+static void ring_wait_flush(struct con_ring *r, unsigned ms)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_nsec += ms * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	pthread_mutex_lock(&r->lock);
+	__atomic_store_n(&r->waiting, 1, __ATOMIC_SEQ_CST);
+	while (!__atomic_load_n(&r->flush, __ATOMIC_SEQ_CST))
+		if (pthread_cond_timedwait(&r->wake, &r->lock, &ts))
+			break;
+	__atomic_store_n(&r->waiting, 0, __ATOMIC_SEQ_CST);
+	pthread_mutex_unlock(&r->lock);
+}
+
+/* Wake the other side if it is asleep */
+static void ring_kick(struct con_ring *r)
+{
+	if (__atomic_load_n(&r->waiting, __ATOMIC_SEQ_CST)) {
+		pthread_mutex_lock(&r->lock);
+		pthread_cond_signal(&r->wake);
+		pthread_mutex_unlock(&r->lock);
+	}
+}
+
+/* Ask the writer for what is queued now */
+static void ring_flush(struct con_ring *r)
+{
+	__atomic_store_n(&r->flush, 1, __ATOMIC_SEQ_CST);
+	ring_kick(r);
+}
+
+/* Move head or tail on and wake the other side if it is asleep */
+static void ring_move(struct con_ring *r, unsigned *p, unsigned n)
+{
+	__atomic_store_n(p, *p + n, __ATOMIC_SEQ_CST);
+	ring_kick(r);
+}
+
+static void *con_reader(void *unused)
+{
+	struct con_ring *r = &con_in;
+	struct pollfd p;
+	uint8_t buf[256];
+	unsigned space;
+	int n, i;
+
+	while (1) {
+		if (ring_used(r) == CON_RING)
+			ring_wait(r, CON_RING);
+		p.fd = 0;
+		p.events = POLLIN;
+		stats_count(polls);
+		if (poll(&p, 1, -1) == -1) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		/* Hung up with nothing left to read: poll won't block again */
+		if ((p.revents & (POLLHUP | POLLERR | POLLNVAL)) &&
+			!(p.revents & POLLIN))
+			break;
+		space = CON_RING - ring_used(r);
+		stats_count(reads);
+		n = read(0, buf, space < sizeof(buf) ? space : sizeof(buf));
+		if (n == -1) {
+			if (errno == EINTR || errno == EAGAIN)
+				continue;
+			break;
+		}
+		/* A tty in VMIN=0 mode returns 0 for no data, anything else
+		   (or a tty that has hung up) is the end of the input */
+		if (n == 0) {
+			if (isatty(0) && !(p.revents & POLLHUP))
+				continue;
+			break;
+		}
+		for (i = 0; i < n; i++)
+			r->buf[(r->head + i) & (CON_RING - 1)] = buf[i];
+		ring_move(r, &r->head, n);
+	}
+	return NULL;
+}
+
+static void *con_writer(void *unused)
+{
+	struct con_ring *r = &con_out;
+	unsigned n, off, was;
+	int l;
+
+	while (1) {
+		/* con_put wakes us for the first byte queued */
+		was = ring_used(r);
+		if (was == 0) {
+			ring_wait(r, 0);
+			continue;
+		}
+		/* Give a batch a while to fill unless it is wanted now */
+		if (con_batch && !__atomic_load_n(&r->flush, __ATOMIC_SEQ_CST))
+			ring_wait_flush(r, 20);
+		__atomic_store_n(&r->flush, 0, __ATOMIC_SEQ_CST);
+		was = ring_used(r);
+		/* Write out as much as we can in one go */
+		off = r->tail & (CON_RING - 1);
+		n = CON_RING - off;
+		if (n > was)
+			n = was;
+		stats_count(writes);
+		l = write(1, r->buf + off, n);
+		if (l == -1) {
+			if (errno == EINTR || errno == EAGAIN)
+				continue;
+			/* Nowhere for it to go so throw it away */
+			l = n;
+		}
+		ring_move(r, &r->tail, l);
+	}
+	return NULL;
+}
+
+/* Don't lose output that is still queued when we exit */
+void console_drain(void)
+{
+	unsigned n = 0;
+	console_flush();
+	while (ring_used(&con_out) && n++ < 1000)
+		usleep(1000);
+}
+
+static void con_start(struct con_ring *r, void *(*fn)(void *))
+{
+	pthread_t t;
+	sigset_t all, old;
+
+	r->started = 1;
+	/* Signals are for the emulator thread */
+	sigfillset(&all);
+	pthread_sigmask(SIG_BLOCK, &all, &old);
+	if (pthread_create(&t, NULL, fn, NULL)) {
+		perror("pthread_create");
+		exit(1);
+	}
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	pthread_detach(t);
+	if (r == &con_out)
+		atexit(console_drain);
+}
+
+/* Read the input ourselves and only offer a byte every CON_PACE polls so
+   when the guest sees it depends on emulated time alone */
+static unsigned con_step_ready(void)
+{
+	uint8_t c;
+
+	if (con_peek == -1) {
+		stats_count(reads);
+		if (read(0, &c, 1) == 1)
+			con_peek = c;
+	}
+	if (con_peek == -1)
+		return 0;
+	if (con_pace) {
+		con_pace--;
+		return 4;
+	}
+	return 1;
+}
+
 static unsigned con_ready(struct serial_device *dev)
 {
-	fd_set i, o;
-	struct timeval tv;
 	unsigned int r = 0;
 
-	FD_ZERO(&i);
-	FD_SET(0, &i);
-	FD_ZERO(&o);
-	FD_SET(1, &o);
-	tv.tv_sec = 0;
-	tv.tv_usec = 0;
-
-	if (select(2, &i, &o, NULL, &tv) == -1) {
-		if (errno == EINTR)
-			return 0;
-		perror("select");
-		exit(1);
+	if (replay_mode == REPLAY_PLAY)
+		r |= replay_ready(REPLAY_CONSOLE);
+	else if (con_lockstep)
+		r |= con_step_ready();
+	else {
+		if (!con_in.started)
+			con_start(&con_in, con_reader);
+		if (ring_used(&con_in))
+			r |= 1;
+	}
+	if ((r & 1) && replay_mode == REPLAY_RECORD && !con_seen) {
+		con_seen = 1;
+		con_seen_at = replay_now();
 	}
-	if (FD_ISSET(0, &i))
-		r |= 1;
-	if (FD_ISSET(1, &o))
+	if (ring_used(&con_out) < CON_RING)
 		r |= 2;
 	return r;
 }
 
 static unsigned con_wready(struct serial_device *dev)
 {
-	return con_ready(dev) & 2;
+	if (ring_used(&con_out) < CON_RING)
+		return 2;
+	return 0;
 }
 
 static unsigned con_noready(struct serial_device *dev)
@@ -49,8 +301,32 @@ static unsigned con_noready(struct serial_device *dev)
 static uint8_t con_get(struct serial_device *dev)
 {
 	static uint8_t c;
-	if (read(0, (char *) &c, 1) != 1)
-		return c;
+	struct con_ring *r = &con_in;
+
+	/* The guest may be waiting on a prompt it has yet to see */
+	console_flush();
+	if (replay_mode == REPLAY_PLAY) {
+		if (!replay_ready(REPLAY_CONSOLE))
+			return c;
+		c = replay_next(REPLAY_CONSOLE);
+	} else if (con_lockstep) {
+		if (con_peek == -1 || con_pace)
+			return c;
+		c = con_peek;
+		con_peek = -1;
+		con_pace = CON_PACE;
+	} else {
+		if (!r->started)
+			con_start(r, con_reader);
+		if (ring_used(r) == 0)
+			return c;
+		c = r->buf[r->tail & (CON_RING - 1)];
+		ring_move(r, &r->tail, 1);
+	}
+	if (replay_mode == REPLAY_RECORD) {
+		replay_log(REPLAY_CONSOLE, con_seen ? con_seen_at : replay_now(), c);
+		con_seen = 0;
+	}
 	if (c == 0x0A)
 		c = '\r';
 	return c;
@@ -63,7 +339,62 @@ static uint8_t con_noget(struct serial_device *dev)
 
 static void con_put(struct serial_device *dev, uint8_t c)
 {
-	write(1, &c, 1);
+	struct con_ring *r = &con_out;
+
+	if (console_snoop)
+		console_snoop(c);
+	if (!r->started)
+		con_start(r, con_writer);
+	/* Full: wait for the tty to catch up as a blocking write would */
+	if (ring_used(r) == CON_RING)
+		ring_wait(r, CON_RING);
+	r->buf[r->head & (CON_RING - 1)] = c;
+	__atomic_store_n(&r->head, r->head + 1, __ATOMIC_SEQ_CST);
+	if (!con_batch || c == '\n' || ring_used(r) >= CON_RING / 2)
+		ring_flush(r);
+	else if (ring_used(r) == 1)
+		ring_kick(r);
+}
+
+/* Get any batched output on its way */
+void console_flush(void)
+{
+	if (con_out.started)
+		ring_flush(&con_out);
+}
+
+static void con_ring_reset(struct con_ring *r)
+{
+	r->head = 0;
+	r->tail = 0;
+	r->waiting = 0;
+	r->started = 0;
+	r->flush = 0;
+	pthread_mutex_init(&r->lock, NULL);
+	pthread_cond_init(&r->wake, NULL);
+}
+
+/* In a forked child: the threads stayed behind so start again afresh
+   on whatever stdin and stdout now are */
+void console_forked(void)
+{
+	con_ring_reset(&con_in);
+	con_ring_reset(&con_out);
+}
+
+/* Take input in step with the emulation instead of as it arrives. Used
+   when the input is a script so that runs are repeatable */
+void console_lockstep(void)
+{
+	con_lockstep = 1;
+	con_peek = -1;
+	con_pace = 0;
+}
+
+/* Write each byte as it comes, for when latency matters more */
+void console_unbuffered(void)
+{
+	con_batch = 0;
 }
 
 static void con_noput(struct serial_device *dev, uint8_t c)
@@ -1,3 +1,12 @@
 extern struct serial_device console;
 extern struct serial_device console_wo;
 extern struct serial_device nulldev;
+
+/* If set sees every byte written to the console */
+extern void (*console_snoop)(uint8_t c);
+
+void console_flush(void);
+void console_unbuffered(void);
+void console_drain(void);
+void console_forked(void);
+void console_lockstep(void);
@@ -89,34 +89,12 @@ static uint8_t *mem_addr(uint16_t addr, unsigned is_write)
 
 static uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate = 0;
 	uint8_t r;
 
 	r = *mem_addr(addr, 0);
 	if (trace & TRACE_MEM)
 		fprintf(stderr, "R %04X = %02X\n", addr, r);
 
-	/* Look for ED with M1, followed directly by 4D and if so trigger
-	   the interrupt chain */
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r== 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1) {
-		if (trace & TRACE_IRQ)
-			fprintf(stderr, "RETI seen.\n");
-		reti_event();
-	}
-	rstate = 0;
 	return r;
 }
 
@@ -1069,6 +1047,13 @@ static void reti_event(void)
 	   processing within the normal flow */
 }
 
+static void z80_reti(int unused)
+{
+	if (trace & TRACE_IRQ)
+		fprintf(stderr, "RETI seen.\n");
+	reti_event();
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -1231,6 +1216,7 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = z80_reti;
 	cpu_z80.trace = z80_trace;
 
 	/* This is the wrong way to do it but it's easier for the moment. We
@@ -21,6 +21,7 @@ struct z80dma {
 	uint8_t enabled;
 	uint8_t trace;
 	uint8_t idle;
+	Z80Context *cpu;	/* Told about memory we write, if set */
 };
 
 #define	RR0		0
@@ -99,7 +100,9 @@ static void z80dma_wr(struct z80dma *dma, uint8_t val)
 
 void z80dma_reset(struct z80dma *dma)
 {
+	Z80Context *cpu = dma->cpu;
 	memset(dma, 0, sizeof(struct z80dma));
+	dma->cpu = cpu;
 	/* TODO */
 }
 
@@ -281,8 +284,12 @@ static uint8_t z80_dma_one_cycle(struct z80dma *dma)
 			byte = mem_read(0, addr_a);
 		if (port_b)
 			io_write(0, addr_b, byte);
-		else
+		else {
 			mem_write(0, addr_b, byte);
+			/* The CPU may have code from there cached */
+			if (dma->cpu)
+				Z80NoteWrite(dma->cpu, addr_b);
+		}
 	} else {
 		if (port_b)
 			byte = io_read(0, addr_b);
@@ -290,8 +297,12 @@ static uint8_t z80_dma_one_cycle(struct z80dma *dma)
 			byte = mem_read(0, addr_b);
 		if (port_a)
 			io_write(0, addr_a, byte);
-		else
+		else {
 			mem_write(0, addr_a, byte);
+			/* The CPU may have code from there cached */
+			if (dma->cpu)
+				Z80NoteWrite(dma->cpu, addr_a);
+		}
 	}
 
 	/* Adjust addresses and counters */
@@ -386,6 +397,7 @@ struct z80dma *z80dma_create(void)
 		fprintf(stderr, "Out of memory.\n");
 		exit(1);
 	}
+	dma->cpu = NULL;
 	z80dma_reset(dma);
 	return dma;
 }
@@ -399,3 +411,8 @@ void z80dma_trace(struct z80dma *dma, int on)
 {
 	dma->trace = on;
 }
+
+void z80dma_set_cpu(struct z80dma *dma, Z80Context *cpu)
+{
+	dma->cpu = cpu;
+}
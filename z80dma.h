@@ -1,3 +1,5 @@
+#include "libz80/z80.h"
+
 struct z80dma;
 
 extern void z80dma_write(struct z80dma *dma, uint8_t val);
@@ -6,6 +8,7 @@ extern int z80_dma_run(struct z80dma *dma, int cycles);
 extern struct z80dma *z80dma_create(void);
 extern void z80dma_free(struct z80dma *d);
 extern void z80dma_trace(struct z80dma *d, int onoff);
+extern void z80dma_set_cpu(struct z80dma *d, Z80Context *cpu);
 
 
 
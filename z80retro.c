@@ -43,6 +43,7 @@
 #include "serialdevice.h"
 #include "ttycon.h"
 #include "z80sio.h"
+#include "timerq.h"
 
 static uint8_t ramrom[256 * 16384];
 
@@ -59,6 +60,9 @@ static struct z80_sio *sio;
 
 static uint16_t tstate_steps = 730;	/* 14.4MHz speed */
 
+static struct timerq *timers;
+static struct timespec tc;
+
 /* IRQ source that is live in IM2 */
 static uint8_t live_irq;
 
@@ -90,7 +94,7 @@ volatile int emulator_done;
 
 static int trace = 0;
 
-static void reti_event(void);
+static void reti_event(int unused);
 
 /* TODO : > 3F don't exist */
 static uint8_t *map_addr(uint16_t addr, unsigned is_write)
@@ -106,6 +110,18 @@ static uint8_t *map_addr(uint16_t addr, unsigned is_write)
 	return ramrom + 16384 * bankreg[bank] + (addr & 0x3FFF);
 }
 
+/* Keep the CPU's page map in step with the banking. Memory tracing needs
+   every access to go through mem_read/mem_write so maps nothing */
+static void map_memory(void)
+{
+	unsigned addr;
+
+	if (trace & TRACE_MEM)
+		return;
+	for (addr = 0; addr < 0x10000; addr += 0x4000)
+		Z80MapPages(&cpu_z80, addr, 0x4000, map_addr(addr, 0), map_addr(addr, 1));
+}
+
 static uint8_t do_mem_read(uint16_t addr, int quiet)
 {
 	uint8_t *p = map_addr(addr, 0);
@@ -129,26 +145,7 @@ void mem_write(int unused, uint16_t addr, uint8_t val)
 
 uint8_t mem_read(int unused, uint16_t addr)
 {
-	static uint8_t rstate = 0;
-	uint8_t r = do_mem_read(addr, 0);
-
-	if (cpu_z80.M1) {
-		/* DD FD CB see the Z80 interrupt manual */
-		if (r == 0xDD || r == 0xFD || r == 0xCB) {
-			rstate = 2;
-			return r;
-		}
-		/* Look for ED with M1, followed directly by 4D and if so trigger
-		   the interrupt chain */
-		if (r == 0xED && rstate == 0) {
-			rstate = 1;
-			return r;
-		}
-	}
-	if (r == 0x4D && rstate == 1)
-		reti_event();
-	rstate = 0;
-	return r;
+	return do_mem_read(addr, 0);
 }
 
 static unsigned int nbytes;
@@ -463,6 +460,8 @@ static void genio_write(uint16_t addr, uint8_t val)
 {
 	uint8_t delta = genio_data ^ val;
 	genio_data = val;
+	if (delta & 1)
+		map_memory();
 	if (delta & 4) {
 		if (genio_data & 4)
 			sd_spi_lower_cs(sdcard);
@@ -537,6 +536,7 @@ void io_write(int unused, uint16_t addr, uint8_t val)
 		if (trace & TRACE_BANK)
 			fprintf(stderr, "Bank %d set to %02X [%02X %02X %02X %02X]\n", addr & 3, val,
 				bankreg[0], bankreg[1], bankreg[2], bankreg[3]);
+		map_memory();
 	}
 	else if (addr >= 0x40 && addr <= 0x43)
 		ctc_write(addr & 3, val);
@@ -570,7 +570,7 @@ static void poll_irq_event(void)
 	}
 }
 
-static void reti_event(void)
+static void reti_event(int unused)
 {
 	if (live_irq && (trace & TRACE_IRQ))
 		fprintf(stderr, "RETI\n");
@@ -589,6 +589,45 @@ static void reti_event(void)
 	poll_irq_event();
 }
 
+static void tick_sio(void *priv, unsigned long clocks)
+{
+	sio_timer(sio);
+}
+
+static void tick_ctc(void *priv, unsigned long clocks)
+{
+	/* The CTC sees a tenth of the CPU clock */
+	ctc_tick(clocks / 10);
+}
+
+static void tick_frame(void *priv, unsigned long clocks)
+{
+	/* Do 20ms of I/O and delays */
+	if (!fast)
+		nanosleep(&tc, NULL);
+	console_flush();
+	if (int_recalc) {
+		/* If there is no pending Z80 vector IRQ but we think
+		   there now might be one we use the same logic as for
+		   reti */
+		if (!live_irq)
+			poll_irq_event();
+		/* Clear this after because reti_event may set the
+		   flags to indicate there is more happening. We will
+		   pick up the next state changes on the reti if so */
+		if (!(cpu_z80.IFF1|cpu_z80.IFF2))
+			int_recalc = 0;
+	}
+}
+
+static void setup_timers(void)
+{
+	timers = timerq_create();
+	timerq_every(timerq_timer(timers, "sio", tick_sio, NULL, 0), (tstate_steps + 5) / 10);
+	timerq_every(timerq_timer(timers, "ctc", tick_ctc, NULL, 0), tstate_steps * 10);
+	timerq_every(timerq_timer(timers, "frame", tick_frame, NULL, 0), tstate_steps * 400);
+}
+
 static struct termios saved_term, term;
 
 static void cleanup(int sig)
@@ -605,12 +644,13 @@ static void exit_cleanup(void)
 static void usage(void)
 {
 	fprintf(stderr,
-		"z80retro: [-b cpath] [-c config] [-r rompath] [-S sdpath] [-N nvpath] [-f] [-d debug]\n"
+		"z80retro: [-b cpath] [-c config] [-r rompath] [-S sdpath] [-N nvpath] [-f] [-o] [-d debug] [-J engine]\n"
 			"   config:  State of DIP switches (0-7)\n"
 			"   rompath: 512K binary file\n"
 			"   sdpath:  Path to file containing SDCard data\n"
 			"   debug:   Comma separated list of: MEM,IO,INFO,UNK,CPU,BANK,SIO,CTC,IRQ,SPI,SD,I2C,RTC\n"
 			"   nvpath:  file to store DS1307+ RTC non-volatile memory\n"
+			"   engine:  CPU engine: switch, table, block or jit\n"
 			);
 	exit(EXIT_FAILURE);
 	/*
@@ -622,14 +662,14 @@ static void usage(void)
 
 int main(int argc, char *argv[])
 {
-	static struct timespec tc;
 	int opt;
 	int fd;
 	char *rompath = "z80retro.rom";
 	char *nvpath = "z80retrom.nvram";
 	char *sdpath = NULL;
+	int engine = Z80_ENGINE_SWITCH;
 
-	while ((opt = getopt(argc, argv, "d:fr:S:")) != -1) {
+	while ((opt = getopt(argc, argv, "d:for:S:J:")) != -1) {
 		switch (opt) {
 		case 'r':
 			rompath = optarg;
@@ -651,6 +691,16 @@ int main(int argc, char *argv[])
 		case 'f':
 			fast = 1;
 			break;
+		case 'o':
+			console_unbuffered();
+			break;
+		case 'J':
+			engine = Z80EngineByName(optarg);
+			if (engine == -1) {
+				fprintf(stderr, "z80retro: unknown engine '%s'.\n", optarg);
+				exit(EXIT_FAILURE);
+			}
+			break;
 		default:
 			usage();
 		}
@@ -726,16 +776,17 @@ int main(int argc, char *argv[])
 	cpu_z80.ioWrite = io_write;
 	cpu_z80.memRead = mem_read;
 	cpu_z80.memWrite = mem_write;
+	cpu_z80.on_reti = reti_event;
 	cpu_z80.trace = z80_trace;
+	map_memory();
+	if (Z80SetEngine(&cpu_z80, engine)) {
+		fprintf(stderr, "z80retro: unable to set up CPU engine.\n");
+		exit(EXIT_FAILURE);
+	}
 
-	/* This is the wrong way to do it but it's easier for the moment. We
-	   should track how much real time has occurred and try to keep cycle
-	   matched with that. The scheme here works fine except when the host
-	   is loaded though */
-
-	/* We run 7372000 t-states per second */
-	/* We run 365 cycles per I/O check, do that 50 times then poll the
-	   slow stuff and nap for 20ms to get 50Hz on the TMS99xx */
+	/* The CPU runs up to the next device deadline, then the devices that
+	   are due are run. Every 20ms we nap to keep to real time */
+	setup_timers();
 	while (!emulator_done) {
 		if (cpu_z80.halted && ! cpu_z80.IFF1) {
 			/* HALT with interrupts disabled, so nothing left
@@ -744,35 +795,11 @@ int main(int argc, char *argv[])
 			emulator_done = 1;
 			break;
 		}
-		int i;
-		/* 36400 T states for base RC2014 - varies for others */
-		for (i = 0; i < 40; i++) {
-			int j;
-			for (j = 0; j < 100; j++) {
-				Z80ExecuteTStates(&cpu_z80, (tstate_steps + 5)/ 10);
-				sio_timer(sio);
-			}
-			ctc_tick(tstate_steps);
-			/* We want to run UI events regularly it seems */
-		}
-
-		/* Do 20ms of I/O and delays */
-		if (!fast)
-			nanosleep(&tc, NULL);
-		if (int_recalc) {
-			/* If there is no pending Z80 vector IRQ but we think
-			   there now might be one we use the same logic as for
-			   reti */
-			if (!live_irq)
-				poll_irq_event();
-			/* Clear this after because reti_event may set the
-			   flags to indicate there is more happening. We will
-			   pick up the next state changes on the reti if so */
-			if (!(cpu_z80.IFF1|cpu_z80.IFF2))
-				int_recalc = 0;
-		}
+		timerq_run(timers, Z80ExecuteTStates(&cpu_z80,
+			timerq_due(timers, tstate_steps * 400, 0)));
 	}
 	if (nvpath!=NULL)
 		rtc_save(rtcdev, nvpath);
+	timerq_free(timers);
 	exit(0);
 }
@@ -6,6 +6,7 @@
 #include "serialdevice.h"
 #include "system.h"
 #include "z80sio.h"
+#include "snapshot.h"
 
 struct z80_sio_chan {
 	uint8_t wr[8];
@@ -169,7 +170,7 @@ static void sio_queue(struct z80_sio_chan *chan, uint8_t c)
 	/* Need to deal with interrupt results */
 }
 
-static void sio_channel_timer(struct z80_sio_chan *chan, uint8_t ab)
+static int sio_channel_timer(struct z80_sio_chan *chan, uint8_t ab)
 {
 	int c = chan->dev->ready(chan->dev);
 	if (c & 1)
@@ -181,6 +182,7 @@ static void sio_channel_timer(struct z80_sio_chan *chan, uint8_t ab)
 				sio_raise_int(chan, INT_TX, 0);
 		}
 	}
+	return (c & 5) || !(chan->rr[0] & 0x04);
 }
 
 static void sio_channel_reset(struct z80_sio_chan *chan)
@@ -345,10 +347,12 @@ void sio_set_dcd(struct z80_sio *sio, unsigned chan, unsigned onoff)
 		sio_raise_int(sio->chan + chan, INT_ERR, 0);	/* External/status */
 }
 
-void sio_timer(struct z80_sio *sio)
+/* Returns non zero while either channel has a byte on the move, in which
+   case it wants another look a character time later */
+int sio_timer(struct z80_sio *sio)
 {
-	sio_channel_timer(sio->chan, 0);
-	sio_channel_timer(sio->chan + 1, 1);
+	int busy = sio_channel_timer(sio->chan, 0);
+	return sio_channel_timer(sio->chan + 1, 1) | busy;
 }
 
 void sio_reset(struct z80_sio *sio)
@@ -412,3 +416,27 @@ uint8_t sio_get_wr(struct z80_sio *sio, unsigned chan, unsigned r)
 {
 	return sio->chan[chan].wr[r];
 }
+
+void sio_snapshot(struct z80_sio *sio, struct snapshot *s)
+{
+	struct z80_sio_chan *chan = sio->chan;
+	int live = sio->irqchan ? sio->irqchan - sio->chan : -1;
+	unsigned i;
+
+	for (i = 0; i < 2; i++) {
+		snapshot_bytes(s, chan->wr, sizeof(chan->wr));
+		snapshot_bytes(s, chan->rr, sizeof(chan->rr));
+		snapshot_bytes(s, chan->data, sizeof(chan->data));
+		snapshot_u8(s, &chan->dptr);
+		snapshot_u8(s, &chan->irq);
+		snapshot_u8(s, &chan->rxint);
+		snapshot_u8(s, &chan->txint);
+		snapshot_u8(s, &chan->intbits);
+		snapshot_u8(s, &chan->vector);
+		chan++;
+	}
+	/* The live channel goes by number */
+	snapshot_int(s, &live);
+	sio->irqchan = (live == 0 || live == 1) ? sio->chan + live : NULL;
+	snapshot_u8(s, &sio->vector);
+}
@@ -1,12 +1,14 @@
 struct z80_sio;
+struct snapshot;
 
 extern struct z80_sio *sio_create(void);
 extern void sio_destroy(struct z80_sio *sio);
 extern void sio_trace(struct z80_sio *sio, unsigned chan, unsigned trace);
 extern void sio_attach(struct z80_sio *sio, unsigned chan, struct serial_device *dev);
 extern void sio_reset(struct z80_sio *sio);
+extern void sio_snapshot(struct z80_sio *sio, struct snapshot *s);
 
-extern void sio_timer(struct z80_sio *sio);
+extern int sio_timer(struct z80_sio *sio);
 extern void sio_reti(struct z80_sio *sio);
 extern void sio_set_dcd(struct z80_sio *sio, unsigned chan, unsigned onoff);
 